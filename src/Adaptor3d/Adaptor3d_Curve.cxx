@@ -26,6 +26,7 @@
 #include <gp_Parab.hxx>
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Curve, Standard_Transient)
@@ -171,6 +172,21 @@ void Adaptor3d_Curve::D0(const Standard_Real , gp_Pnt& ) const
   throw Standard_NotImplemented("Adaptor3d_Curve::D0");
 }
 
+//=======================================================================
+//function : BatchD0
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Curve::BatchD0 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theParams.Lower() != thePoints.Lower() || theParams.Upper() != thePoints.Upper(),
+                                       "Adaptor3d_Curve::BatchD0");
+  for (Standard_Integer anIndex = theParams.Lower(); anIndex <= theParams.Upper(); ++anIndex)
+  {
+    D0 (theParams.Value (anIndex), thePoints.ChangeValue (anIndex));
+  }
+}
+
 
 //=======================================================================
 //function : D1
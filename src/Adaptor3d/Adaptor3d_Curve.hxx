@@ -26,6 +26,7 @@
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 #include <GeomAbs_CurveType.hxx>
 
 class gp_Pnt;
@@ -91,6 +92,12 @@ public:
   
   //! Computes the point of parameter U on the curve.
   Standard_EXPORT virtual void D0 (const Standard_Real U, gp_Pnt& P) const;
+
+  //! Computes the points of the curve for the array of parameters.
+  //! The arrays should have the same bounds.
+  //! The default implementation calls D0() for each point;
+  //! adaptors of B-spline curves evaluate the points lying in the same span at once.
+  Standard_EXPORT virtual void BatchD0 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const;
   
   //! Computes the point of parameter U on the curve with its
   //! first derivative.
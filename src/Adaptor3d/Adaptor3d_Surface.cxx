@@ -28,6 +28,7 @@
 #include <gp_Sphere.hxx>
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_NotImplemented.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(Adaptor3d_Surface, Standard_Transient)
@@ -276,6 +277,22 @@ void Adaptor3d_Surface::D0(const Standard_Real , const Standard_Real , gp_Pnt& )
   throw Standard_NotImplemented("Adaptor3d_Surface::D0");
 }
 
+//=======================================================================
+//function : BatchD0
+//purpose  : 
+//=======================================================================
+
+void Adaptor3d_Surface::BatchD0 (const TColgp_Array1OfPnt2d& theUV, TColgp_Array1OfPnt& thePoints) const
+{
+  Standard_DimensionMismatch_Raise_if (theUV.Lower() != thePoints.Lower() || theUV.Upper() != thePoints.Upper(),
+                                       "Adaptor3d_Surface::BatchD0");
+  for (Standard_Integer anIndex = theUV.Lower(); anIndex <= theUV.Upper(); ++anIndex)
+  {
+    const gp_Pnt2d& aUV = theUV.Value (anIndex);
+    D0 (aUV.X(), aUV.Y(), thePoints.ChangeValue (anIndex));
+  }
+}
+
 
 //=======================================================================
 //function : D1
@@ -30,6 +30,8 @@
 #include <Standard_DefineAlloc.hxx>
 #include <Standard_Handle.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 
 class Geom_BezierSurface;
 class Geom_BSplineSurface;
@@ -121,6 +123,12 @@ public:
 
   //! Computes the point of parameters U,V on the surface.
   Standard_EXPORT virtual void D0 (const Standard_Real U, const Standard_Real V, gp_Pnt& P) const;
+
+  //! Computes the points of the surface for the array of parameters.
+  //! The arrays should have the same bounds.
+  //! The default implementation calls D0() for each point;
+  //! adaptors of B-spline surfaces evaluate the points lying in the same span at once.
+  Standard_EXPORT virtual void BatchD0 (const TColgp_Array1OfPnt2d& theUV, TColgp_Array1OfPnt& thePoints) const;
   
   //! Computes the point  and the first derivatives on the surface.
   //! Raised if the continuity of the current intervals is not C1.
@@ -392,6 +392,7 @@ void BOPAlgo_BOP::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetFaceFaceCache(myFaceFaceCache);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -199,6 +199,7 @@ void BOPAlgo_Builder::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetFaceFaceCache(myFaceFaceCache);
   //
   pPF->Perform(aPS.Next(9));
   //
@@ -36,6 +36,7 @@
 #include <BRepLib.hxx>
 #include <BRep_Tool.hxx>
 #include <GeomLib.hxx>
+#include <NCollection_DataMap.hxx>
 #include <NCollection_IncAllocator.hxx>
 #include <NCollection_Vector.hxx>
 #include <IntTools_Context.hxx>
@@ -57,6 +58,9 @@ static
                              const TopTools_DataMapOfShapeListOfShape& theImages,
                              Handle(IntTools_Context)& theCtx,
                              const Handle(Message_Report)& theReport);
+static
+  Standard_Boolean HasSplitClosedEdges(const TopoDS_Face& theFace,
+                                       const TopTools_DataMapOfShapeListOfShape& theImages);
 
 //=======================================================================
 //class    : BOPAlgo_PairOfShapeBoolean
@@ -149,6 +153,74 @@ private:
 };
 typedef NCollection_Vector<BOPAlgo_SplitFace> BOPAlgo_VectorOfBuilderFace;
 
+//=======================================================================
+//class   : BOPAlgo_DraftFace
+//purpose : Auxiliary class for building the draft face of the face
+//          having only the splits of its bounding edges
+//=======================================================================
+class BOPAlgo_DraftFace : public BOPAlgo_ParallelAlgo {
+
+ public:
+  DEFINE_STANDARD_ALLOC
+
+  BOPAlgo_DraftFace() :
+    BOPAlgo_ParallelAlgo(),
+    myIndex(-1),
+    myImages(NULL) {
+  }
+  //
+  virtual ~BOPAlgo_DraftFace() {
+  }
+  //
+  void SetIndex(const Standard_Integer theIndex) {
+    myIndex = theIndex;
+  }
+  //
+  Standard_Integer Index() const {
+    return myIndex;
+  }
+  //
+  void SetFace(const TopoDS_Face& theFace) {
+    myFace = theFace;
+  }
+  //
+  void SetImages(const TopTools_DataMapOfShapeListOfShape& theImages) {
+    myImages = &theImages;
+  }
+  //
+  void SetContext(const Handle(IntTools_Context)& aContext) {
+    myContext = aContext;
+  }
+  //
+  const Handle(IntTools_Context)& Context()const {
+    return myContext;
+  }
+  //
+  //! Returns the draft face, null if the face has to be split
+  //! by the BuilderFace algorithm
+  const TopoDS_Face& DraftFace() const {
+    return myDraftFace;
+  }
+  //
+  virtual void Perform() {
+    Message_ProgressScope aPS(myProgressRange, NULL, 1);
+    if (UserBreak(aPS))
+    {
+      return;
+    }
+    myDraftFace = BuildDraftFace(myFace, *myImages, myContext, myReport);
+  }
+  //
+ protected:
+  Standard_Integer myIndex;
+  TopoDS_Face myFace;
+  TopoDS_Face myDraftFace;
+  const TopTools_DataMapOfShapeListOfShape* myImages;
+  Handle(IntTools_Context) myContext;
+};
+//
+typedef NCollection_Vector<BOPAlgo_DraftFace> BOPAlgo_VectorOfDraftFace;
+
 //=======================================================================
 //class    : BOPAlgo_VFI
 //purpose  : 
@@ -268,6 +340,13 @@ void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
   //
   aNbS=myDS->NbSourceShapes();
   //
+  // 1. Select the faces to be rebuilt. The faces, for which only the
+  //    bounding edges have been split, are rebuilt as draft faces.
+  //    Such faces are independent on each other, so build them in parallel.
+  TColStd_ListOfInteger aLFaces;
+  BOPAlgo_VectorOfDraftFace aVDF;
+  NCollection_DataMap<Standard_Integer, TopoDS_Face> aMDraftFaces;
+  //
   for (i=0; i<aNbS; ++i) {
     const BOPDS_ShapeInfo& aSI=myDS->ShapeInfo(i);
     if (aSI.ShapeType()!=TopAbs_FACE) {
@@ -279,9 +358,6 @@ void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
     }
     //
     const TopoDS_Face& aF=(*(TopoDS_Face*)(&aSI.Shape()));
-    Standard_Boolean isUClosed = Standard_False,
-                     isVClosed = Standard_False,
-                     isChecked = Standard_False;
     //
     bHasFaceInfo=myDS->HasFaceInfo(i);
     if(!bHasFaceInfo) {
@@ -346,14 +422,72 @@ void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
         // the draft face will be null, as such sub-shapes may split the face on parts
         // (as in the case "bugs modalg_5 bug25245_1").
         // The BuilderFace algorithm will be called in this case.
-        TopoDS_Face aFD = BuildDraftFace(aF, myImages, myContext, myReport);
-        if (!aFD.IsNull())
+        if (HasSplitClosedEdges(aF, myImages))
         {
-          aFacesIm(aFacesIm.Add(i, TopTools_ListOfShape())).Append(aFD);
-          continue;
+          // Building of the draft face may update the splits of the
+          // closed edges, thus build it here, not in parallel.
+          aMDraftFaces.Bind(i, BuildDraftFace(aF, myImages, myContext, myReport));
+        }
+        else
+        {
+          BOPAlgo_DraftFace& aDF = aVDF.Appended();
+          aDF.SetIndex(i);
+          aDF.SetFace(aF);
+          aDF.SetImages(myImages);
+          aDF.SetRunParallel(myRunParallel);
         }
       }
     }
+    aLFaces.Append(i);
+  }
+  //
+  Standard_Integer aNbDF = aVDF.Length();
+  // Set progress range for each task to be run in parallel
+  Message_ProgressScope aPSDraft(aPSOuter.Next(), "Building draft faces", aNbDF);
+  for (k = 0; k < aNbDF; ++k)
+  {
+    aVDF.ChangeValue(k).SetProgressRange(aPSDraft.Next());
+  }
+  //===================================================
+  BOPTools_Parallel::Perform (myRunParallel, aVDF, myContext);
+  //===================================================
+  if (UserBreak(aPSOuter))
+  {
+    return;
+  }
+  for (k = 0; k < aNbDF; ++k)
+  {
+    const BOPAlgo_DraftFace& aDF = aVDF(k);
+    myReport->Merge(aDF.GetReport());
+    aMDraftFaces.Bind(aDF.Index(), aDF.DraftFace());
+  }
+  //
+  // 2. Prepare the splitting of the faces, which could not
+  //    be rebuilt as draft faces, keeping the order of the faces
+  TColStd_ListIteratorOfListOfInteger aItLF(aLFaces);
+  for (; aItLF.More(); aItLF.Next()) {
+    i = aItLF.Value();
+    if (UserBreak(aPSOuter))
+    {
+      return;
+    }
+    //
+    const TopoDS_Face& aF=(*(TopoDS_Face*)(&myDS->Shape(i)));
+    const TopoDS_Face* pFD = aMDraftFaces.Seek(i);
+    if (pFD && !pFD->IsNull())
+    {
+      aFacesIm(aFacesIm.Add(i, TopTools_ListOfShape())).Append(*pFD);
+      continue;
+    }
+    //
+    const BOPDS_FaceInfo& aFI=myDS->FaceInfo(i);
+    const BOPDS_IndexedMapOfPaveBlock& aMPBIn=aFI.PaveBlocksIn();
+    const BOPDS_IndexedMapOfPaveBlock& aMPBSc=aFI.PaveBlocksSc();
+    aNbPBIn=aMPBIn.Extent();
+    aNbPBSc=aMPBSc.Extent();
+    Standard_Boolean isUClosed = Standard_False,
+                     isVClosed = Standard_False,
+                     isChecked = Standard_False;
 
     aMFence.Clear();
     //
@@ -496,10 +630,8 @@ void BOPAlgo_Builder::BuildSplitFaces(const Message_ProgressRange& theRange)
     aBF.SetShapes(aLE);
     aBF.SetRunParallel(myRunParallel);
     //
-  }// for (i=0; i<aNbS; ++i) {
+  }// for (; aItLF.More(); aItLF.Next()) {
 
-  // close preparation task
-  aPSOuter.Next();
   //
   Standard_Integer aNbBF = aVBF.Length();
   // Set progress range for each task to be run in parallel
@@ -916,6 +1048,22 @@ void BOPAlgo_Builder::FillInternalVertices(const Message_ProgressRange& theRange
   }
 }
 //=======================================================================
+//function : HasSplitClosedEdges
+//purpose  : Checks if the face contains the split edges closed on it.
+//=======================================================================
+Standard_Boolean HasSplitClosedEdges(const TopoDS_Face& theFace,
+                                     const TopTools_DataMapOfShapeListOfShape& theImages)
+{
+  TopExp_Explorer anExp(theFace, TopAbs_EDGE);
+  for (; anExp.More(); anExp.Next())
+  {
+    const TopoDS_Edge& aE = TopoDS::Edge(anExp.Current());
+    if (theImages.IsBound(aE) && BRep_Tool::IsClosed(aE, theFace))
+      return Standard_True;
+  }
+  return Standard_False;
+}
+//=======================================================================
 //function : HasMultiConnected
 //purpose  : Checks if the edge has multi-connected vertices.
 //=======================================================================
@@ -1027,7 +1175,7 @@ TopoDS_Face BuildDraftFace(const TopoDS_Face& theFace,
       TopTools_ListIteratorOfListOfShape aItLEIm(*pLEIm);
       for (; aItLEIm.More(); aItLEIm.Next())
       {
-        TopoDS_Edge& aSp = TopoDS::Edge(aItLEIm.Value());
+        TopoDS_Edge aSp = TopoDS::Edge(aItLEIm.Value());
 
         // Check if the split has multi-connected vertices
         if (!bIsDegenerated && HasMultiConnected(aSp, aVerticesCounter))
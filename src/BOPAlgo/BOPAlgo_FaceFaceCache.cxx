@@ -0,0 +1,221 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BOPAlgo_FaceFaceCache.hxx>
+
+#include <BRep_Tool.hxx>
+#include <Geom_Curve.hxx>
+#include <Geom2d_Curve.hxx>
+#include <IntTools_Curve.hxx>
+#include <IntTools_PntOn2Faces.hxx>
+#include <TopTools_OrientedShapeMapHasher.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+namespace
+{
+  //! Makes the copy of the intersection curve not sharing the geometry with the original
+  IntTools_Curve copyCurve (const IntTools_Curve& theCurve)
+  {
+    IntTools_Curve aCurve = theCurve;
+    if (!theCurve.Curve().IsNull())
+      aCurve.SetCurve (Handle(Geom_Curve)::DownCast (theCurve.Curve()->Copy()));
+    if (!theCurve.FirstCurve2d().IsNull())
+      aCurve.SetFirstCurve2d (Handle(Geom2d_Curve)::DownCast (theCurve.FirstCurve2d()->Copy()));
+    if (!theCurve.SecondCurve2d().IsNull())
+      aCurve.SetSecondCurve2d (Handle(Geom2d_Curve)::DownCast (theCurve.SecondCurve2d()->Copy()));
+    return aCurve;
+  }
+
+  //! Returns the surface of the face not taking into account its location
+  Handle(Geom_Surface) faceSurface (const TopoDS_Face& theFace)
+  {
+    TopLoc_Location aLoc;
+    return BRep_Tool::Surface (theFace, aLoc);
+  }
+
+  //! Copies the intersection curves
+  void copyCurves (const IntTools_SequenceOfCurves& theFrom,
+                   IntTools_SequenceOfCurves& theTo)
+  {
+    theTo.Clear();
+    for (IntTools_SequenceOfCurves::Iterator anIt (theFrom); anIt.More(); anIt.Next())
+      theTo.Append (copyCurve (anIt.Value()));
+  }
+}
+
+//=======================================================================
+//function : Key
+//purpose  :
+//=======================================================================
+BOPAlgo_FaceFaceCache::Key::Key (const TopoDS_Face& theFace1,
+                                 const TopoDS_Face& theFace2,
+                                 const Standard_Real theFuzzyValue,
+                                 const BOPAlgo_SectionAttribute& theSecAttr)
+: Face1 (theFace1),
+  Face2 (theFace2),
+  Surface1 (faceSurface (theFace1)),
+  Surface2 (faceSurface (theFace2)),
+  Tolerance1 (BRep_Tool::Tolerance (theFace1)),
+  Tolerance2 (BRep_Tool::Tolerance (theFace2)),
+  FuzzyValue (theFuzzyValue),
+  Flags ((theSecAttr.Approximation() ? 1 : 0) |
+         (theSecAttr.PCurveOnS1()    ? 2 : 0) |
+         (theSecAttr.PCurveOnS2()    ? 4 : 0))
+{
+}
+
+//=======================================================================
+//function : HashCode
+//purpose  :
+//=======================================================================
+Standard_Integer BOPAlgo_FaceFaceCache::KeyHasher::HashCode (const Key& theKey,
+                                                             const Standard_Integer theUpperBound)
+{
+  const unsigned int aH1 = (unsigned int )TopTools_OrientedShapeMapHasher::HashCode (theKey.Face1, IntegerLast());
+  const unsigned int aH2 = (unsigned int )TopTools_OrientedShapeMapHasher::HashCode (theKey.Face2, IntegerLast());
+  return ::HashCode ((Standard_Integer )((aH1 * 31u + aH2) & IntegerLast()), theUpperBound);
+}
+
+//=======================================================================
+//function : IsEqual
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_FaceFaceCache::KeyHasher::IsEqual (const Key& theKey1,
+                                                            const Key& theKey2)
+{
+  return theKey1.Face1.IsEqual (theKey2.Face1)
+      && theKey1.Face2.IsEqual (theKey2.Face2)
+      && theKey1.Surface1 == theKey2.Surface1
+      && theKey1.Surface2 == theKey2.Surface2
+      && theKey1.Tolerance1 == theKey2.Tolerance1
+      && theKey1.Tolerance2 == theKey2.Tolerance2
+      && theKey1.FuzzyValue == theKey2.FuzzyValue
+      && theKey1.Flags      == theKey2.Flags;
+}
+
+//=======================================================================
+//function : BOPAlgo_FaceFaceCache
+//purpose  :
+//=======================================================================
+BOPAlgo_FaceFaceCache::BOPAlgo_FaceFaceCache (const Standard_Integer theMaxSize)
+: myMaxSize (Max (theMaxSize, 1)),
+  myNbHits (0),
+  myNbMisses (0)
+{
+}
+
+//=======================================================================
+//function : Find
+//purpose  :
+//=======================================================================
+Standard_Boolean BOPAlgo_FaceFaceCache::Find (const TopoDS_Face& theFace1,
+                                              const TopoDS_Face& theFace2,
+                                              const Standard_Real theFuzzyValue,
+                                              const BOPAlgo_SectionAttribute& theSecAttr,
+                                              IntTools_SequenceOfCurves& theCurves,
+                                              IntTools_SequenceOfPntOn2Faces& thePoints,
+                                              Standard_Boolean& theTangentFaces)
+{
+  const Key aKey (theFace1, theFace2, theFuzzyValue, theSecAttr);
+
+  Standard_Mutex::Sentry aSentry (myMutex);
+  const Result* aResult = myResults.Seek (aKey);
+  if (!aResult)
+  {
+    ++myNbMisses;
+    return Standard_False;
+  }
+
+  ++myNbHits;
+  copyCurves (aResult->Curves, theCurves);
+  thePoints = aResult->Points;
+  theTangentFaces = aResult->TangentFaces;
+  return Standard_True;
+}
+
+//=======================================================================
+//function : Add
+//purpose  :
+//=======================================================================
+void BOPAlgo_FaceFaceCache::Add (const TopoDS_Face& theFace1,
+                                 const TopoDS_Face& theFace2,
+                                 const Standard_Real theFuzzyValue,
+                                 const BOPAlgo_SectionAttribute& theSecAttr,
+                                 const IntTools_SequenceOfCurves& theCurves,
+                                 const IntTools_SequenceOfPntOn2Faces& thePoints,
+                                 const Standard_Boolean theTangentFaces)
+{
+  const Key aKey (theFace1, theFace2, theFuzzyValue, theSecAttr);
+
+  Result aResult;
+  copyCurves (theCurves, aResult.Curves);
+  aResult.Points = thePoints;
+  aResult.TangentFaces = theTangentFaces;
+
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if (myResults.IsBound (aKey))
+    return;
+
+  // Remove the results stored first to keep the size of the cache limited
+  while (myResults.Extent() >= myMaxSize)
+  {
+    myResults.UnBind (myKeys.First());
+    myKeys.RemoveFirst();
+  }
+  myResults.Bind (aKey, aResult);
+  myKeys.Append (aKey);
+}
+
+//=======================================================================
+//function : NbHits
+//purpose  :
+//=======================================================================
+Standard_Integer BOPAlgo_FaceFaceCache::NbHits() const
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  return myNbHits;
+}
+
+//=======================================================================
+//function : NbMisses
+//purpose  :
+//=======================================================================
+Standard_Integer BOPAlgo_FaceFaceCache::NbMisses() const
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  return myNbMisses;
+}
+
+//=======================================================================
+//function : Extent
+//purpose  :
+//=======================================================================
+Standard_Integer BOPAlgo_FaceFaceCache::Extent() const
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  return myResults.Extent();
+}
+
+//=======================================================================
+//function : Clear
+//purpose  :
+//=======================================================================
+void BOPAlgo_FaceFaceCache::Clear()
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  myResults.Clear();
+  myKeys.Clear();
+  myNbHits = 0;
+  myNbMisses = 0;
+}
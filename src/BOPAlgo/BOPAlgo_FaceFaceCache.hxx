@@ -0,0 +1,149 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BOPAlgo_FaceFaceCache_HeaderFile
+#define _BOPAlgo_FaceFaceCache_HeaderFile
+
+#include <Standard.hxx>
+#include <Standard_Handle.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+
+#include <BOPAlgo_SectionAttribute.hxx>
+#include <Geom_Surface.hxx>
+#include <IntTools_SequenceOfCurves.hxx>
+#include <IntTools_SequenceOfPntOn2Faces.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <TopoDS_Face.hxx>
+
+class BOPAlgo_FaceFaceCache;
+DEFINE_STANDARD_HANDLE(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+//! The class is the cache of the results of Face/Face intersections
+//! performed by the Intersection algorithm (*BOPAlgo_PaveFiller*).
+//!
+//! The results are stored for the pair of faces (taking into account their
+//! locations and orientations), the tolerances of the faces, the fuzzy value
+//! and the section attributes of the operation. Thus, the cache allows avoiding
+//! recomputation of the intersection of the same faces in the different operations
+//! performed in the same process, e.g. when the same features are combined repeatedly.
+//!
+//! The intersections started from the given points (which depend on the other
+//! interferences of the operation) are not cached.
+//!
+//! The geometry of the cached curves is copied on storing and on retrieving,
+//! so the cache does not share the curves with the results of the operations.
+//! The cache is protected by mutex and may be shared between the operations
+//! performed in different threads.
+//!
+//! The faces are identified by their TShapes, which are kept alive by the cache.
+//! Replacement of the surface of the face and change of its tolerance are taken
+//! into account, but other in-place modifications of the faces (modification of
+//! the surface itself, e.g. Geom_BSplineSurface::SetPole(), or of the boundaries
+//! of the face) are not detected - the cache has to be cleared in such case.
+//!
+//! The number of stored results is limited; when the limit is reached,
+//! the results stored first are removed from the cache.
+class BOPAlgo_FaceFaceCache : public Standard_Transient
+{
+public:
+
+  DEFINE_STANDARD_RTTIEXT(BOPAlgo_FaceFaceCache, Standard_Transient)
+
+  //! Constructor.
+  //! @param theMaxSize [in] maximal number of the stored intersection results
+  Standard_EXPORT BOPAlgo_FaceFaceCache (const Standard_Integer theMaxSize = 10000);
+
+  //! Looks for the results of intersection of the given faces.
+  //! Returns true and the copies of the intersection curves and points
+  //! in case of success, otherwise returns false.
+  //! Updates the statistics of the cache usage.
+  Standard_EXPORT Standard_Boolean Find (const TopoDS_Face& theFace1,
+                                         const TopoDS_Face& theFace2,
+                                         const Standard_Real theFuzzyValue,
+                                         const BOPAlgo_SectionAttribute& theSecAttr,
+                                         IntTools_SequenceOfCurves& theCurves,
+                                         IntTools_SequenceOfPntOn2Faces& thePoints,
+                                         Standard_Boolean& theTangentFaces);
+
+  //! Stores the results of intersection of the given faces.
+  Standard_EXPORT void Add (const TopoDS_Face& theFace1,
+                            const TopoDS_Face& theFace2,
+                            const Standard_Real theFuzzyValue,
+                            const BOPAlgo_SectionAttribute& theSecAttr,
+                            const IntTools_SequenceOfCurves& theCurves,
+                            const IntTools_SequenceOfPntOn2Faces& thePoints,
+                            const Standard_Boolean theTangentFaces);
+
+  //! Returns the number of stored intersection results
+  Standard_EXPORT Standard_Integer Extent() const;
+
+  //! Returns the maximal number of stored intersection results
+  Standard_Integer MaxSize() const { return myMaxSize; }
+
+  //! Returns the number of successful look-ups
+  Standard_EXPORT Standard_Integer NbHits() const;
+
+  //! Returns the number of failed look-ups
+  Standard_EXPORT Standard_Integer NbMisses() const;
+
+  //! Clears the cache and its statistics
+  Standard_EXPORT void Clear();
+
+private:
+
+  //! Key of the cached intersection
+  struct Key
+  {
+    TopoDS_Face Face1;
+    TopoDS_Face Face2;
+    Handle(Geom_Surface) Surface1;
+    Handle(Geom_Surface) Surface2;
+    Standard_Real Tolerance1;
+    Standard_Real Tolerance2;
+    Standard_Real FuzzyValue;
+    Standard_Integer Flags;
+
+    Key (const TopoDS_Face& theFace1,
+         const TopoDS_Face& theFace2,
+         const Standard_Real theFuzzyValue,
+         const BOPAlgo_SectionAttribute& theSecAttr);
+  };
+
+  //! Hasher for the keys
+  struct KeyHasher
+  {
+    static Standard_Integer HashCode (const Key& theKey, const Standard_Integer theUpperBound);
+    static Standard_Boolean IsEqual (const Key& theKey1, const Key& theKey2);
+  };
+
+  //! Cached results of intersection
+  struct Result
+  {
+    IntTools_SequenceOfCurves Curves;
+    IntTools_SequenceOfPntOn2Faces Points;
+    Standard_Boolean TangentFaces;
+  };
+
+private:
+
+  NCollection_DataMap<Key, Result, KeyHasher> myResults;
+  NCollection_List<Key> myKeys; //!< Keys of the results in the order of storing
+  Standard_Integer myMaxSize;
+  Standard_Integer myNbHits;
+  Standard_Integer myNbMisses;
+  mutable Standard_Mutex myMutex;
+};
+
+#endif // _BOPAlgo_FaceFaceCache_HeaderFile
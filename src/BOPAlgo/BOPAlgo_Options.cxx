@@ -26,6 +26,12 @@ namespace
 {
   Standard_Boolean myGlobalRunParallel = Standard_False;
 
+  Handle(BOPAlgo_FaceFaceCache)& globalFaceFaceCache()
+  {
+    static Handle(BOPAlgo_FaceFaceCache) THE_CACHE;
+    return THE_CACHE;
+  }
+
   // Initialize textual messages for errors and warnings defined in BOPAlgo
   #include "BOPAlgo_BOPAlgo_msg.pxx"
   bool BOPAlgo_InitMessages = false;
@@ -52,7 +58,8 @@ BOPAlgo_Options::BOPAlgo_Options()
   myReport(new Message_Report),
   myRunParallel(myGlobalRunParallel),
   myFuzzyValue(Precision::Confusion()),
-  myUseOBB(Standard_False)
+  myUseOBB(Standard_False),
+  myFaceFaceCache(globalFaceFaceCache())
 {
   BOPAlgo_LoadMessages();
 }
@@ -68,7 +75,8 @@ BOPAlgo_Options::BOPAlgo_Options
   myReport(new Message_Report),
   myRunParallel(myGlobalRunParallel),
   myFuzzyValue(Precision::Confusion()),
-  myUseOBB(Standard_False)
+  myUseOBB(Standard_False),
+  myFaceFaceCache(globalFaceFaceCache())
 {
   BOPAlgo_LoadMessages();
 }
@@ -118,6 +126,24 @@ Standard_Boolean BOPAlgo_Options::GetParallelMode()
 }
 
 
+//=======================================================================
+//function : GetGlobalFaceFaceCache
+//purpose  : 
+//=======================================================================
+const Handle(BOPAlgo_FaceFaceCache)& BOPAlgo_Options::GetGlobalFaceFaceCache()
+{
+  return globalFaceFaceCache();
+}
+
+//=======================================================================
+//function : SetGlobalFaceFaceCache
+//purpose  : 
+//=======================================================================
+void BOPAlgo_Options::SetGlobalFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache)
+{
+  globalFaceFaceCache() = theCache;
+}
+
 //=======================================================================
 //function : SetFuzzyValue
 //purpose  : 
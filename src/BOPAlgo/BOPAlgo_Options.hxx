@@ -15,6 +15,7 @@
 #ifndef _BOPAlgo_Options_HeaderFile
 #define _BOPAlgo_Options_HeaderFile
 
+#include <BOPAlgo_FaceFaceCache.hxx>
 #include <Message_Report.hxx>
 #include <Standard_OStream.hxx>
 
@@ -32,6 +33,8 @@ class Message_ProgressScope;
 //!                       touching or coinciding cases;
 //! - *Using the Oriented Bounding Boxes* - Allows using the Oriented Bounding Boxes of the shapes
 //!                          for filtering the intersections.
+//! - *Caching of Face/Face intersections* - allows reusing the results of intersection
+//!                          of the same faces in different operations.
 //!
 class BOPAlgo_Options
 {
@@ -165,6 +168,31 @@ public:
     return myUseOBB;
   }
 
+public:
+  //!@name Caching of Face/Face intersections
+
+  //! Gets the global cache of Face/Face intersections,
+  //! used by default by all algorithms created in the process
+  Standard_EXPORT static const Handle(BOPAlgo_FaceFaceCache)& GetGlobalFaceFaceCache();
+
+  //! Sets the global cache of Face/Face intersections.
+  //! Null handle (default) disables the caching by default.
+  Standard_EXPORT static void SetGlobalFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache);
+
+  //! Sets the cache of Face/Face intersections to be used by the algorithm.
+  //! Null handle disables the caching.
+  void SetFaceFaceCache(const Handle(BOPAlgo_FaceFaceCache)& theCache)
+  {
+    myFaceFaceCache = theCache;
+  }
+
+  //! Returns the cache of Face/Face intersections used by the algorithm.
+  //! The cache provides the statistics of its usage (numbers of hits and misses).
+  const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache() const
+  {
+    return myFaceFaceCache;
+  }
+
 protected:
 
   //! Adds error to the report if the break signal was caught. Returns true in this case, false otherwise.
@@ -177,6 +205,7 @@ protected:
   Standard_Boolean myRunParallel;
   Standard_Real myFuzzyValue;
   Standard_Boolean myUseOBB;
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache;
 
 };
 
@@ -21,10 +21,12 @@
 #include <BOPAlgo_Alerts.hxx>
 #include <BOPDS_DS.hxx>
 #include <BOPDS_Iterator.hxx>
+#include <BRep_Tool.hxx>
 #include <IntTools_Context.hxx>
 #include <NCollection_BaseAllocator.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
+#include <TopoDS.hxx>
 
 namespace
 {
@@ -149,6 +151,7 @@ Standard_Boolean BOPAlgo_PaveFiller::IsPrimary() const
 //=======================================================================
 void BOPAlgo_PaveFiller::Clear()
 {
+  UpdateSharedContext();
   BOPAlgo_Algo::Clear();
   if (myIterator) {
     delete myIterator;
@@ -185,6 +188,14 @@ const Handle (IntTools_Context)& BOPAlgo_PaveFiller::Context()
   return myContext;
 }
 //=======================================================================
+//function : SetContext
+//purpose  : 
+//=======================================================================
+void BOPAlgo_PaveFiller::SetContext (const Handle (IntTools_Context)& theContext)
+{
+  mySharedContext = theContext;
+}
+//=======================================================================
 //function : SectionAttribute
 //purpose  : 
 //=======================================================================
@@ -222,7 +233,9 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   myDS->Init (myFuzzyValue);
   //
   // 2 myContext
-  myContext = new IntTools_Context;
+  myContext = mySharedContext;
+  if (myContext.IsNull())
+    myContext = new IntTools_Context;
   //
   // 3.myIterator 
   myIterator = new BOPDS_Iterator (myAllocator);
@@ -232,6 +245,81 @@ void BOPAlgo_PaveFiller::Init (const Message_ProgressRange& theRange)
   //
   // 4 NonDestructive flag
   SetNonDestructive();
+  //
+  // 5 Keep the tolerances of the sub-shapes which may be
+  //   modified in place to keep the shared context valid
+  if (!mySharedContext.IsNull() && !myNonDestructive)
+  {
+    const Standard_Integer aNbS = myDS->NbSourceShapes();
+    for (Standard_Integer i = 0; i < aNbS; ++i)
+    {
+      const TopoDS_Shape& aS = myDS->Shape (i);
+      const TopAbs_ShapeEnum aType = aS.ShapeType();
+      if (aType == TopAbs_VERTEX || aType == TopAbs_EDGE || aType == TopAbs_FACE)
+        myTolerances.Bind (aS, shapeTolerance (aS));
+    }
+  }
+}
+
+//=======================================================================
+// function: UpdateSharedContext
+// purpose: 
+//=======================================================================
+void BOPAlgo_PaveFiller::UpdateSharedContext()
+{
+  if (myTolerances.IsEmpty())
+    return;
+  //
+  if (myDS && !mySharedContext.IsNull())
+  {
+    // Status of the source shapes: 0 - not checked, 1 - not modified, 2 - modified
+    const Standard_Integer aNbS = myDS->NbSourceShapes();
+    NCollection_Array1<Standard_Integer> aStatus (0, aNbS - 1);
+    aStatus.Init (0);
+    for (Standard_Integer i = 0; i < aNbS; ++i)
+      isModifiedInPlace (i, aStatus);
+  }
+  myTolerances.Clear();
+}
+
+//=======================================================================
+// function: isModifiedInPlace
+// purpose: Checks if the tolerance of the source shape or of any of its
+//          sub-shapes has been modified, and removes its data from the
+//          shared context if so
+//=======================================================================
+Standard_Boolean BOPAlgo_PaveFiller::isModifiedInPlace (const Standard_Integer theIndex,
+                                                       NCollection_Array1<Standard_Integer>& theStatus)
+{
+  if (theStatus (theIndex) == 0)
+  {
+    const BOPDS_ShapeInfo& aSI = myDS->ShapeInfo (theIndex);
+    const Standard_Real* pTol = myTolerances.Seek (aSI.Shape());
+    Standard_Boolean bModified = (pTol && *pTol != shapeTolerance (aSI.Shape()));
+    for (TColStd_ListIteratorOfListOfInteger aIt (aSI.SubShapes()); aIt.More() && !bModified; aIt.Next())
+      bModified = isModifiedInPlace (aIt.Value(), theStatus);
+    //
+    if (bModified)
+      mySharedContext->Remove (aSI.Shape());
+    theStatus (theIndex) = bModified ? 2 : 1;
+  }
+  return theStatus (theIndex) == 2;
+}
+
+//=======================================================================
+// function: shapeTolerance
+// purpose: 
+//=======================================================================
+Standard_Real BOPAlgo_PaveFiller::shapeTolerance (const TopoDS_Shape& theS)
+{
+  switch (theS.ShapeType())
+  {
+    case TopAbs_VERTEX: return BRep_Tool::Tolerance (TopoDS::Vertex (theS));
+    case TopAbs_EDGE:   return BRep_Tool::Tolerance (TopoDS::Edge (theS));
+    case TopAbs_FACE:   return BRep_Tool::Tolerance (TopoDS::Face (theS));
+    default: break;
+  }
+  return 0.;
 }
 
 //=======================================================================
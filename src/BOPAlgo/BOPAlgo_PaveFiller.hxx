@@ -48,6 +48,7 @@
 #include <TColStd_MapOfInteger.hxx>
 #include <TopAbs_ShapeEnum.hxx>
 #include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_DataMapOfShapeReal.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_ListOfShape.hxx>
@@ -141,6 +142,28 @@ public:
   }
   
   Standard_EXPORT const Handle(IntTools_Context)& Context();
+
+  //! Sets the context to be used by the algorithm instead of creating the new one.
+  //! The context keeps the auxiliary data computed for the sub-shapes of the arguments
+  //! (2D classifiers of faces, solid classifiers, projectors, bounding boxes).
+  //! Passing the same context into consecutive operations sharing the same (large)
+  //! argument allows avoiding recomputation of such data for its unmodified sub-shapes.
+  //! In destructive mode the tolerances of the sub-shapes of the arguments may be
+  //! increased in place by the operation. The data of such sub-shapes and of the shapes
+  //! containing them is removed from the shared context by UpdateSharedContext(),
+  //! which is called automatically when the filler is cleared or destroyed.
+  //! Other in-place modifications of the arguments are not tracked; the context has to
+  //! be cleared by the caller in such case (see IntTools_Context::Clear()).
+  //! Note that only the context is shared: the data structure of the intersection
+  //! (BOPDS_DS) is still built from scratch for each operation.
+  Standard_EXPORT void SetContext(const Handle(IntTools_Context)& theContext);
+
+  //! Removes from the shared context the data of the sub-shapes of the arguments
+  //! whose tolerance has been modified in place since the initialization of the
+  //! algorithm, and of the shapes containing them.
+  //! Has to be called explicitly only if the filler is kept alive while the shared
+  //! context is used by the other operation.
+  Standard_EXPORT void UpdateSharedContext();
   
   Standard_EXPORT void SetSectionAttribute (const BOPAlgo_SectionAttribute& theSecAttr);
   
@@ -631,6 +654,20 @@ protected:
     {}
   };
 
+protected: //! Keeping the shared context valid
+
+  //! Checks if the tolerance of the source shape with the given index or of any of
+  //! its sub-shapes has been modified in place, and removes the data of the shape
+  //! from the shared context if so.
+  //! @param theIndex [in] index of the source shape in the DS
+  //! @param theStatus [in/out] status of the source shapes:
+  //!        0 - not checked, 1 - not modified, 2 - modified
+  Standard_EXPORT Standard_Boolean isModifiedInPlace (const Standard_Integer theIndex,
+                                                      NCollection_Array1<Standard_Integer>& theStatus);
+
+  //! Returns the tolerance of the vertex, edge or face
+  Standard_EXPORT static Standard_Real shapeTolerance (const TopoDS_Shape& theS);
+
 protected: //! Analyzing Progress steps
 
   //! Filling steps for constant operations
@@ -644,6 +681,9 @@ protected: //! Fields
   BOPDS_PDS myDS;
   BOPDS_PIterator myIterator;
   Handle(IntTools_Context) myContext;
+  Handle(IntTools_Context) mySharedContext;
+  TopTools_DataMapOfShapeReal myTolerances; //!< Initial tolerances of the sub-shapes of the arguments
+                                            //! modifiable in place while the shared context is used
   BOPAlgo_SectionAttribute mySectionAttribute;
   Standard_Boolean myNonDestructive;
   Standard_Boolean myIsPrimary;
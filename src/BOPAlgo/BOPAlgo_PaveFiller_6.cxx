@@ -94,7 +94,7 @@ class BOPAlgo_FaceFace :
   BOPAlgo_FaceFace() : 
     IntTools_FaceFace(),  
     BOPAlgo_ParallelAlgo(),
-    myIF1(-1), myIF2(-1), myTolFF(1.e-7) {
+    myIF1(-1), myIF2(-1), myTolFF(1.e-7), myIsCached(Standard_False) {
   }
   //
   virtual ~BOPAlgo_FaceFace() {
@@ -146,12 +146,40 @@ class BOPAlgo_FaceFace :
   //
   const gp_Trsf& Trsf() const { return myTrsf; }
   //
+  //! Returns true if the intersection is started from the given points
+  Standard_Boolean HasStartPoints() const {
+    return !myListOfPnts.IsEmpty();
+  }
+  //
+  //! Sets the results of intersection taken from the cache,
+  //! so that no intersection is performed
+  void SetCachedResult(const IntTools_SequenceOfCurves& theCurves,
+                       const IntTools_SequenceOfPntOn2Faces& thePoints,
+                       const Standard_Boolean theTangentFaces) {
+    mySeqOfCurve = theCurves;
+    myPnts = thePoints;
+    myTangentFaces = theTangentFaces;
+    myFace1 = myF1;
+    myFace2 = myF2;
+    myIsDone = Standard_True;
+    myIsCached = Standard_True;
+  }
+  //
+  //! Returns true if the results of intersection have been taken from the cache
+  Standard_Boolean IsCached() const {
+    return myIsCached;
+  }
+  //
   virtual void Perform() {
     Message_ProgressScope aPS(myProgressRange, NULL, 1);
     if (UserBreak(aPS))
     {
       return;
     }
+    if (myIsCached)
+    {
+      return;
+    }
     try
     {
       OCC_CATCH_SIGNALS
@@ -219,6 +247,7 @@ class BOPAlgo_FaceFace :
   Bnd_Box myBox1;
   Bnd_Box myBox2;
   gp_Trsf myTrsf;
+  Standard_Boolean myIsCached;
 };
 //
 //=======================================================================
@@ -427,6 +456,18 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
       //
       aFaceFace.SetParameters(bApprox, bCompC2D1, bCompC2D2, anApproxTol);
       aFaceFace.SetFuzzyValue(myFuzzyValue);
+      //
+      if (!myFaceFaceCache.IsNull() && !aNbLP) {
+        // Take the results of intersection of the same faces
+        // computed in the previous operations
+        IntTools_SequenceOfCurves aCvs;
+        IntTools_SequenceOfPntOn2Faces aPnts;
+        Standard_Boolean bTangentFaces = Standard_False;
+        if (myFaceFaceCache->Find(aFShifted1, aFShifted2, myFuzzyValue,
+                                  mySectionAttribute, aCvs, aPnts, bTangentFaces)) {
+          aFaceFace.SetCachedResult(aCvs, aPnts, bTangentFaces);
+        }
+      }
     }
     else {
       // for the Glue mode just add all interferences of that type
@@ -473,9 +514,17 @@ void BOPAlgo_PaveFiller::PerformFF(const Message_ProgressRange& theRange)
     Standard_Boolean bTangentFaces = aFaceFace.TangentFaces();
     Standard_Real aTolFF = aFaceFace.TolFF();
     //
-    aFaceFace.PrepareLines3D(bSplitCurve);
-    //
-    aFaceFace.ApplyTrsf();
+    if (!aFaceFace.IsCached()) {
+      aFaceFace.PrepareLines3D(bSplitCurve);
+      //
+      aFaceFace.ApplyTrsf();
+      //
+      if (!myFaceFaceCache.IsNull() && !aFaceFace.HasStartPoints()) {
+        myFaceFaceCache->Add(aFaceFace.Face1(), aFaceFace.Face2(), myFuzzyValue,
+                             mySectionAttribute, aFaceFace.Lines(),
+                             aFaceFace.Points(), bTangentFaces);
+      }
+    }
     //
     const IntTools_SequenceOfCurves& aCvsX = aFaceFace.Lines();
     const IntTools_SequenceOfPntOn2Faces& aPntsX = aFaceFace.Points();
@@ -94,6 +94,7 @@ void BOPAlgo_Splitter::Perform(const Message_ProgressRange& theRange)
   pPF->SetNonDestructive(myNonDestructive);
   pPF->SetGlue(myGlue);
   pPF->SetUseOBB(myUseOBB);
+  pPF->SetFaceFaceCache(myFaceFaceCache);
   //
   Message_ProgressScope aPS(theRange, "Performing Split operation", 10);
   pPF->Perform(aPS.Next(9));
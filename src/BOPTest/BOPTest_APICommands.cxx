@@ -144,6 +144,8 @@ Standard_Integer bapibop(Draw_Interpretor& di,
   pBuilder->SetGlue(aGlue);
   pBuilder->SetCheckInverted(BOPTest_Objects::CheckInverted());
   pBuilder->SetUseOBB(BOPTest_Objects::UseOBB());
+  pBuilder->SetContext(BOPTest_Objects::SharedContext());
+  pBuilder->SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   pBuilder->SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -212,6 +214,8 @@ Standard_Integer bapibuild(Draw_Interpretor& di,
   aBuilder.SetGlue(aGlue);
   aBuilder.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aBuilder.SetUseOBB(BOPTest_Objects::UseOBB());
+  aBuilder.SetContext(BOPTest_Objects::SharedContext());
+  aBuilder.SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   aBuilder.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator(di, 1);
@@ -272,6 +276,8 @@ Standard_Integer bapisplit(Draw_Interpretor& di,
   aSplitter.SetGlue(BOPTest_Objects::Glue());
   aSplitter.SetCheckInverted(BOPTest_Objects::CheckInverted());
   aSplitter.SetUseOBB(BOPTest_Objects::UseOBB());
+  aSplitter.SetContext(BOPTest_Objects::SharedContext());
+  aSplitter.SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   aSplitter.SetToFillHistory(BRepTest_Objects::IsHistoryNeeded());
   //
   // performing operation
@@ -159,6 +159,8 @@ Standard_Integer bop(Draw_Interpretor& di,
   pPF->SetNonDestructive(bNonDestructive);
   pPF->SetGlue(aGlue);
   pPF->SetUseOBB(BOPTest_Objects::UseOBB());
+  pPF->SetContext(BOPTest_Objects::SharedContext());
+  pPF->SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   //
   pPF->Perform(aProgress->Start());
   BOPTest::ReportAlerts(pPF->GetReport());
@@ -19,6 +19,8 @@
 #include <BRep_GCurve.hxx>
 #include <BRep_TEdge.hxx>
 #include <BRep_Tool.hxx>
+#include <BRepBndLib.hxx>
+#include <BRepClass3d_PreparedSolid.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
 #include <BRepClass_FaceClassifier.hxx>
 #include <DBRep.hxx>
@@ -27,6 +29,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Pnt2d.hxx>
 #include <IntTools_FClass2d.hxx>
+#include <math_BullardGenerator.hxx>
 #include <TopAbs_State.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Shape.hxx>
@@ -48,6 +51,7 @@ static
                                       Standard_Real& Last);
 
 static  Standard_Integer bclassify   (Draw_Interpretor& , Standard_Integer , const char** );
+static  Standard_Integer bclassifypoints (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassify (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer b2dclassifx (Draw_Interpretor& , Standard_Integer , const char** );
 static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , const char** );
@@ -65,6 +69,11 @@ static  Standard_Integer bhaspc      (Draw_Interpretor& , Standard_Integer , con
   const char* g = "BOPTest commands";
   theCommands.Add("bclassify"    , "use bclassify Solid Point [Tolerance=1.e-7]",
                   __FILE__, bclassify   , g);
+  theCommands.Add("bclassifypoints", "use bclassifypoints Solid NbPoints [Tolerance=1.e-7] [-serial]\n"
+    "Classifies random points of the bounding box of the <Solid> by BRepClass3d_PreparedSolid\n"
+    "in a single batch and compares the states with BRepClass3d_SolidClassifier.\n"
+    "<-serial> : classify the points of the batch sequentially.",
+                  __FILE__, bclassifypoints, g);
   theCommands.Add("b2dclassify"  , "use b2dclassify Face Point2d [Tol] [UseBox] [GapCheckTol]\n" 
     "Classify  the Point  Point2d  with  Tolerance <Tol> on the face described by <Face>.\n" 
     "<UseBox> == 1/0 (default <UseBox> = 0): switch on/off the use Bnd_Box in the classification.\n"
@@ -190,6 +199,87 @@ Standard_Integer bclassify (Draw_Interpretor& theDI,
   return 0;
 }
 
+//=======================================================================
+//function : bclassifypoints
+//purpose  : 
+//=======================================================================
+Standard_Integer bclassifypoints (Draw_Interpretor& theDI,
+                                  Standard_Integer  theArgNb,
+                                  const char**      theArgVec)
+{
+  if (theArgNb < 3)  {
+    theDI << " use bclassifypoints Solid NbPoints [Tolerance=1.e-7] [-serial]\n";
+    return 1;
+  }
+
+  TopoDS_Shape aS = DBRep::Get (theArgVec[1]);
+  if (aS.IsNull())  {
+    theDI << " Null Shape is not allowed\n";
+    return 1;
+  }
+  else if (aS.ShapeType() != TopAbs_SOLID)  {
+    theDI << " Shape type must be SOLID\n";
+    return 1;
+  }
+
+  const Standard_Integer aNbPnts = Draw::Atoi (theArgVec[2]);
+  if (aNbPnts < 1)  {
+    theDI << " Number of points must be positive\n";
+    return 1;
+  }
+
+  Standard_Real aTol = 1.e-7;
+  Standard_Boolean isParallel = Standard_True;
+  for (Standard_Integer i = 3; i < theArgNb; ++i)  {
+    if (!strcmp (theArgVec[i], "-serial"))  {
+      isParallel = Standard_False;
+    }
+    else {
+      aTol = Draw::Atof (theArgVec[i]);
+    }
+  }
+
+  // random points in the bounding box enlarged by 10%
+  Bnd_Box aBox;
+  BRepBndLib::Add (aS, aBox);
+  Standard_Real aXmin, aYmin, aZmin, aXmax, aYmax, aZmax;
+  aBox.Get (aXmin, aYmin, aZmin, aXmax, aYmax, aZmax);
+  const gp_XYZ aMin (aXmin, aYmin, aZmin), aSize (aXmax - aXmin, aYmax - aYmin, aZmax - aZmin);
+  math_BullardGenerator aRandom;
+  TColgp_Array1OfPnt aPoints (1, aNbPnts);
+  for (Standard_Integer i = 1; i <= aNbPnts; ++i)  {
+    const gp_XYZ aCoef (1.2 * aRandom.NextReal() - 0.1,
+                        1.2 * aRandom.NextReal() - 0.1,
+                        1.2 * aRandom.NextReal() - 0.1);
+    aPoints.SetValue (i, aMin + aSize.Multiplied (aCoef));
+  }
+
+  Handle(BRepClass3d_PreparedSolid) aPrepared = new BRepClass3d_PreparedSolid (aS, aTol);
+  NCollection_Array1<TopAbs_State> aStates (1, aNbPnts);
+  aPrepared->Classify (aPoints, aStates, isParallel);
+
+  Standard_Integer aNbIn = 0, aNbOut = 0, aNbOn = 0, aNbMismatches = 0;
+  BRepClass3d_SolidClassifier aSC (aS);
+  for (Standard_Integer i = 1; i <= aNbPnts; ++i)  {
+    aSC.Perform (aPoints.Value (i), aTol);
+    const TopAbs_State aState = aStates.Value (i);
+    if (aState != aSC.State())  {
+      ++aNbMismatches;
+    }
+    switch (aState) {
+     case TopAbs_IN:  ++aNbIn;  break;
+     case TopAbs_OUT: ++aNbOut; break;
+     case TopAbs_ON:  ++aNbOn;  break;
+     default: break;
+    }
+  }
+
+  theDI << "Coarse test: " << (aPrepared->HasCoarseTest() ? "used" : "not used") << "\n";
+  theDI << "IN: " << aNbIn << ", OUT: " << aNbOut << ", ON: " << aNbOn << "\n";
+  theDI << "Mismatches with BRepClass3d_SolidClassifier: " << aNbMismatches << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : bhaspc
 //purpose  : 
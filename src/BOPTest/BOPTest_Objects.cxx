@@ -108,6 +108,8 @@ class BOPTest_Session {
     myDrawWarnShapes = Standard_False;
     myCheckInverted = Standard_True;
     myUseOBB = Standard_False;
+    myContext.Nullify();
+    myFaceFaceCache.Nullify();
     myUnifyEdges = Standard_False;
     myUnifyFaces = Standard_False;
     myAngTol = Precision::Angular();
@@ -168,6 +170,33 @@ class BOPTest_Session {
   Standard_Boolean UseOBB() const {
     return myUseOBB;
   };
+  //
+  void SetSharedContext(const Standard_Boolean bShare) {
+    if (!bShare) {
+      myContext.Nullify();
+    myFaceFaceCache.Nullify();
+    }
+    else if (myContext.IsNull()) {
+      myContext = new IntTools_Context;
+    }
+  };
+  //
+  const Handle(IntTools_Context)& SharedContext() const {
+    return myContext;
+  };
+  //
+  void SetFaceFaceCache(const Standard_Boolean bCache) {
+    if (!bCache) {
+      myFaceFaceCache.Nullify();
+    }
+    else if (myFaceFaceCache.IsNull()) {
+      myFaceFaceCache = new BOPAlgo_FaceFaceCache;
+    }
+  };
+  //
+  const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache() const {
+    return myFaceFaceCache;
+  };
 
   // Controls the Unification of Edges after BOP
   void SetUnifyEdges(const Standard_Boolean bUE) { myUnifyEdges = bUE; }
@@ -204,6 +233,8 @@ protected:
   Standard_Boolean myDrawWarnShapes;
   Standard_Boolean myCheckInverted;
   Standard_Boolean myUseOBB;
+  Handle(IntTools_Context) myContext;
+  Handle(BOPAlgo_FaceFaceCache) myFaceFaceCache;
   Standard_Boolean myUnifyEdges;
   Standard_Boolean myUnifyFaces;
   Standard_Real myAngTol;
@@ -457,6 +488,38 @@ Standard_Boolean BOPTest_Objects::UseOBB()
   return GetSession().UseOBB();
 }
 //=======================================================================
+//function : SetSharedContext
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetSharedContext(const Standard_Boolean bShare)
+{
+  GetSession().SetSharedContext(bShare);
+}
+//=======================================================================
+//function : SharedContext
+//purpose  : 
+//=======================================================================
+const Handle(IntTools_Context)& BOPTest_Objects::SharedContext()
+{
+  return GetSession().SharedContext();
+}
+//=======================================================================
+//function : SetFaceFaceCache
+//purpose  : 
+//=======================================================================
+void BOPTest_Objects::SetFaceFaceCache(const Standard_Boolean bCache)
+{
+  GetSession().SetFaceFaceCache(bCache);
+}
+//=======================================================================
+//function : FaceFaceCache
+//purpose  : 
+//=======================================================================
+const Handle(BOPAlgo_FaceFaceCache)& BOPTest_Objects::FaceFaceCache()
+{
+  return GetSession().FaceFaceCache();
+}
+//=======================================================================
 //function : SetUnifyEdges
 //purpose  : 
 //=======================================================================
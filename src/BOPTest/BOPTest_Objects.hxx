@@ -23,6 +23,8 @@
 #include <BOPAlgo_PBuilder.hxx>
 #include <BOPAlgo_CellsBuilder.hxx>
 #include <BOPAlgo_GlueEnum.hxx>
+#include <IntTools_Context.hxx>
+#include <BOPAlgo_FaceFaceCache.hxx>
 //
 class BOPAlgo_PaveFiller;
 class BOPAlgo_Builder;
@@ -94,6 +96,20 @@ public:
 
   Standard_EXPORT static Standard_Boolean UseOBB();
 
+  //! Enables/disables sharing of the intersection context between the operations.
+  //! Disabling releases the shared context.
+  Standard_EXPORT static void SetSharedContext(const Standard_Boolean bShare);
+
+  //! Returns the context shared between the operations (null if sharing is disabled)
+  Standard_EXPORT static const Handle(IntTools_Context)& SharedContext();
+
+  //! Enables/disables caching of Face/Face intersections in the operations.
+  //! Disabling releases the cache.
+  Standard_EXPORT static void SetFaceFaceCache(const Standard_Boolean bCache);
+
+  //! Returns the cache of Face/Face intersections (null if caching is disabled)
+  Standard_EXPORT static const Handle(BOPAlgo_FaceFaceCache)& FaceFaceCache();
+
   Standard_EXPORT static void SetUnifyEdges(const Standard_Boolean bUE);
   Standard_EXPORT static Standard_Boolean UnifyEdges();
 
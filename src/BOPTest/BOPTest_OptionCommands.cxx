@@ -28,6 +28,8 @@ static Standard_Integer bGlue(Draw_Interpretor&, Standard_Integer, const char**)
 static Standard_Integer bdrawwarnshapes(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bcheckinverted(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer buseobb(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bsharedcontext(Draw_Interpretor&, Standard_Integer, const char**);
+static Standard_Integer bfacefacecache(Draw_Interpretor&, Standard_Integer, const char**);
 static Standard_Integer bsimplify(Draw_Interpretor&, Standard_Integer, const char**);
 
 //=======================================================================
@@ -75,6 +77,15 @@ void BOPTest::OptionCommands(Draw_Interpretor& theCommands)
                              "\t\tUsage: buseobb 0 (off) / 1 (on)",
                   __FILE__, buseobb, g);
 
+  theCommands.Add("bsharedcontext", "Enables/disables sharing of the intersection context between the BOP operations\n"
+                                    "\t\tUsage: bsharedcontext 0 (off, the shared context is released) / 1 (on)",
+                  __FILE__, bsharedcontext, g);
+
+  theCommands.Add("bfacefacecache", "Enables/disables caching of Face/Face intersections in the BOP operations\n"
+                                    "\t\tUsage: bfacefacecache [0 (off, the cache is released) / 1 (on)]\n"
+                                    "\t\tWithout arguments prints the statistics of the cache usage",
+                  __FILE__, bfacefacecache, g);
+
   theCommands.Add("bsimplify", "Enables/Disables the result simplification after BOP\n"
                                "\t\tUsage: bsimplify [-e 0/1] [-f 0/1] [-a tol]\n"
                                "\t\t-e 0/1 - enables/disables edges unification\n"
@@ -134,6 +145,12 @@ Standard_Integer boptions(Draw_Interpretor& di,
   Sprintf(buf, " Use OBB: %s \t\t\t(%s)\n", BOPTest_Objects::UseOBB() ? "Yes" : "No",
                "use \"buseobb\" command to change");
   di << buf;
+  Sprintf(buf, " Shared context: %s \t\t(%s)\n", !BOPTest_Objects::SharedContext().IsNull() ? "Yes" : "No",
+               "use \"bsharedcontext\" command to change");
+  di << buf;
+  Sprintf(buf, " Face/Face cache: %s \t\t(%s)\n", !BOPTest_Objects::FaceFaceCache().IsNull() ? "Yes" : "No",
+               "use \"bfacefacecache\" command to change");
+  di << buf;
   Sprintf(buf, " Unify Edges: %s \t\t(%s)\n", BOPTest_Objects::UnifyEdges() ? "Yes" : "No",
                "use \"bsimplify -e\" command to change");
   di << buf;
@@ -285,6 +302,58 @@ Standard_Integer buseobb(Draw_Interpretor& di,
   return 0;
 }
 
+//=======================================================================
+//function : bsharedcontext
+//purpose  : 
+//=======================================================================
+Standard_Integer bsharedcontext(Draw_Interpretor& di,
+                                Standard_Integer n,
+                                const char** a)
+{
+  if (n != 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  Standard_Integer iShare = Draw::Atoi(a[1]);
+  BOPTest_Objects::SetSharedContext(iShare != 0);
+  return 0;
+}
+
+//=======================================================================
+//function : bfacefacecache
+//purpose  : 
+//=======================================================================
+Standard_Integer bfacefacecache(Draw_Interpretor& di,
+                                Standard_Integer n,
+                                const char** a)
+{
+  if (n > 2)
+  {
+    di.PrintHelp(a[0]);
+    return 1;
+  }
+
+  if (n == 2)
+  {
+    Standard_Integer iCache = Draw::Atoi(a[1]);
+    BOPTest_Objects::SetFaceFaceCache(iCache != 0);
+    return 0;
+  }
+
+  const Handle(BOPAlgo_FaceFaceCache)& aCache = BOPTest_Objects::FaceFaceCache();
+  if (aCache.IsNull())
+  {
+    di << "Face/Face cache is not used\n";
+    return 0;
+  }
+  di << "Stored: " << aCache->Extent() << "\n";
+  di << "Hits: " << aCache->NbHits() << "\n";
+  di << "Misses: " << aCache->NbMisses() << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : bsimplify
 //purpose  : 
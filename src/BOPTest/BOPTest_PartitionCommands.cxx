@@ -165,6 +165,8 @@ Standard_Integer bfillds(Draw_Interpretor& di,
   aPF.SetFuzzyValue(aTol);
   aPF.SetGlue(aGlue);
   aPF.SetUseOBB(BOPTest_Objects::UseOBB());
+  aPF.SetContext(BOPTest_Objects::SharedContext());
+  aPF.SetFaceFaceCache(BOPTest_Objects::FaceFaceCache());
   //
   OSD_Timer aTimer;
   aTimer.Start();
@@ -556,6 +556,23 @@ void BRep_Builder::UpdateFace (const TopoDS_Face& theFace,
   theFace.TShape()->Modified (Standard_True);
 }
 
+//=======================================================================
+//function : UpdateFace
+//purpose  : 
+//=======================================================================
+void BRep_Builder::UpdateFace (const TopoDS_Face& theFace,
+                               const Poly_ListOfTriangulation& theTriangulations,
+                               const Handle(Poly_Triangulation)& theActiveTriangulation) const
+{
+  const Handle(BRep_TFace)& aTFace = *((Handle(BRep_TFace)*) &theFace.TShape());
+  if(aTFace->Locked())
+  {
+    throw TopoDS_LockedShape("BRep_Builder::UpdateFace");
+  }
+  aTFace->Triangulations (theTriangulations, theActiveTriangulation);
+  theFace.TShape()->Modified (Standard_True);
+}
+
 //=======================================================================
 //function : UpdateFace
 //purpose  : 
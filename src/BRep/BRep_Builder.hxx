@@ -91,6 +91,11 @@ public:
   //!      else the active triangulation will be replaced to theTriangulation one.
   Standard_EXPORT void UpdateFace (const TopoDS_Face& theFace, const Handle(Poly_Triangulation)& theTriangulation, const Standard_Boolean theToReset = true) const;
 
+  //! Replaces face triangulations by the given list and sets the active one.
+  //! Use NULL active triangulation to set the first triangulation in list as active.
+  //! An empty list removes face triangulations.
+  Standard_EXPORT void UpdateFace (const TopoDS_Face& theFace, const Poly_ListOfTriangulation& theTriangulations, const Handle(Poly_Triangulation)& theActiveTriangulation = Handle(Poly_Triangulation)()) const;
+
   //! Updates the face Tolerance.
   Standard_EXPORT void UpdateFace (const TopoDS_Face& F, const Standard_Real Tol) const;
   
@@ -417,6 +417,27 @@ void BRepAdaptor_Curve::D0(const Standard_Real U, gp_Pnt& P) const
   P.Transform(myTrsf);
 }
 
+//=======================================================================
+//function : BatchD0
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Curve::BatchD0 (const TColStd_Array1OfReal& theParams,
+                                 TColgp_Array1OfPnt&         thePoints) const
+{
+  if (myConSurf.IsNull())
+    myCurve.BatchD0 (theParams, thePoints);
+  else
+    myConSurf->BatchD0 (theParams, thePoints);
+  if (myTrsf.Form() != gp_Identity)
+  {
+    for (Standard_Integer anIndex = thePoints.Lower(); anIndex <= thePoints.Upper(); ++anIndex)
+    {
+      thePoints.ChangeValue (anIndex).Transform (myTrsf);
+    }
+  }
+}
+
 //=======================================================================
 //function : D1
 //purpose  : 
@@ -148,6 +148,9 @@ public:
   
   //! Computes the point of parameter U.
   Standard_EXPORT void D0 (const Standard_Real U, gp_Pnt& P) const Standard_OVERRIDE;
+
+  //! Computes the points of the curve for the array of parameters.
+  Standard_EXPORT void BatchD0 (const TColStd_Array1OfReal& theParams, TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
   
   //! Computes the point of parameter U on the curve
   //! with its first derivative.
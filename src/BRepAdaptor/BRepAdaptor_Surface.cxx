@@ -237,6 +237,24 @@ void  BRepAdaptor_Surface::D0(const Standard_Real U,
   P.Transform(myTrsf);
 }
 
+//=======================================================================
+//function : BatchD0
+//purpose  : 
+//=======================================================================
+
+void BRepAdaptor_Surface::BatchD0 (const TColgp_Array1OfPnt2d& theUV,
+                                   TColgp_Array1OfPnt&         thePoints) const
+{
+  mySurf.BatchD0 (theUV, thePoints);
+  if (myTrsf.Form() != gp_Identity)
+  {
+    for (Standard_Integer anIndex = thePoints.Lower(); anIndex <= thePoints.Upper(); ++anIndex)
+    {
+      thePoints.ChangeValue (anIndex).Transform (myTrsf);
+    }
+  }
+}
+
 //=======================================================================
 //function : D1
 //purpose  : 
@@ -130,6 +130,8 @@ void BRepAlgoAPI_BuilderAlgo::IntersectShapes(const TopTools_ListOfShape& theArg
   myDSFiller->SetNonDestructive(myNonDestructive);
   myDSFiller->SetGlue(myGlue);
   myDSFiller->SetUseOBB(myUseOBB);
+  myDSFiller->SetFaceFaceCache(myFaceFaceCache);
+  myDSFiller->SetContext(myContext);
   // Set Face/Face intersection options to the intersection algorithm
   SetAttributes();
   // Perform intersection
@@ -150,6 +152,8 @@ void BRepAlgoAPI_BuilderAlgo::BuildResult(const Message_ProgressRange& theRange)
   myBuilder->SetToFillHistory(myFillHistory);
   // Perform building of the result with pre-calculated intersections
   myBuilder->PerformWithFiller(*myDSFiller, theRange);
+  // Remove the data invalidated by the operation from the shared context
+  myDSFiller->UpdateSharedContext();
   // Merge the warnings of the Building part
   GetReport()->Merge(myBuilder->GetReport());
   // Check for the errors
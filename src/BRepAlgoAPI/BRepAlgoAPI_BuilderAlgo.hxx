@@ -24,6 +24,7 @@
 #include <BOPAlgo_PBuilder.hxx>
 #include <BRepAlgoAPI_Algo.hxx>
 #include <BRepTools_History.hxx>
+#include <IntTools_Context.hxx>
 #include <Precision.hxx>
 #include <Standard_Real.hxx>
 #include <TopTools_ListOfShape.hxx>
@@ -133,6 +134,28 @@ public: //! @name Setting options
     return myCheckInverted;
   }
 
+  //! Sets the context to be used by the intersection algorithm.
+  //! Sharing the same context between consecutive operations with the same
+  //! large argument (e.g. cutting many small tools from the same body one by one)
+  //! allows reusing the auxiliary data (classifiers, projectors, bounding boxes)
+  //! computed for its unmodified sub-shapes. In destructive mode the data of the
+  //! sub-shapes whose tolerance has been increased in place by the operation is removed
+  //! from the context at the end of the operation. Other in-place modifications of the
+  //! arguments are not tracked, and the context has to be cleared by the caller in such
+  //! case (see IntTools_Context::Clear()). The context keeps the shapes it has been used
+  //! for alive, thus it should be released when the operations are finished.
+  //! The context is not used if the operation is performed with the given PaveFiller.
+  void SetContext(const Handle(IntTools_Context)& theContext)
+  {
+    myContext = theContext;
+  }
+
+  //! Returns the context set to be used by the intersection algorithm
+  const Handle(IntTools_Context)& Context() const
+  {
+    return myContext;
+  }
+
 
 public: //! @name Performing the operation
 
@@ -271,6 +294,7 @@ protected: //! @name Fields
   BOPAlgo_GlueEnum myGlue;           //!< Gluing mode management
   Standard_Boolean myCheckInverted;  //!< Check for inverted solids management
   Standard_Boolean myFillHistory;    //!< Controls the history collection
+  Handle(IntTools_Context) myContext; //!< Context shared between the operations
 
   // Tools
   Standard_Boolean myIsIntersectionNeeded; //!< Flag to control whether the intersection
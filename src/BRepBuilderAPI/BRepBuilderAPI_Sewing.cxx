@@ -76,6 +76,8 @@
 #include <gp_Vec.hxx>
 #include <Message_ProgressScope.hxx>
 #include <NCollection_UBTreeFiller.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Precision.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_NoSuchObject.hxx>
@@ -1494,7 +1496,31 @@ Standard_Boolean BRepBuilderAPI_Sewing::FindCandidates(TopTools_SequenceOfShape&
     TColStd_Array1OfReal arrDistance(1,nbSectionsNew);
     TColStd_Array1OfReal arrLen(1,nbSectionsNew);
     TColStd_Array1OfReal arrMinDist(1,nbSectionsNew);
-    EvaluateDistances(seqSectionsNew,arrForward,arrDistance,arrLen,arrMinDist,1);
+    Standard_Boolean isEvaluated = Standard_False;
+    if (const NCollection_List<SectionDistance>* aDistances = mySectionDistances.Seek(Edge1)) {
+      // Take distances evaluated in advance
+      arrForward.Init(Standard_True);
+      arrDistance.Init(-1.0);
+      arrLen.Init(0.);
+      arrMinDist.Init(Precision::Infinite());
+      isEvaluated = Standard_True;
+      for (i = 2; i <= nbSectionsNew && isEvaluated; i++) {
+        isEvaluated = Standard_False;
+        NCollection_List<SectionDistance>::Iterator anItD(*aDistances);
+        for (; anItD.More() && !isEvaluated; anItD.Next()) {
+          const SectionDistance& aDist = anItD.Value();
+          if (aDist.IsDone && aDist.Section.IsSame(seqSectionsNew(i))) {
+            arrForward(i) = aDist.IsForward;
+            arrDistance(i) = aDist.Distance;
+            arrLen(i) = aDist.Length;
+            arrMinDist(i) = aDist.MinDistance;
+            isEvaluated = Standard_True;
+          }
+        }
+      }
+    }
+    if (!isEvaluated)
+      EvaluateDistances(seqSectionsNew,arrForward,arrDistance,arrLen,arrMinDist,1);
     
     // Fill sequence of candidate indices sorted by distance
     for (i = 2; i <= nbSectionsNew; i++) {
@@ -1737,6 +1763,7 @@ void BRepBuilderAPI_Sewing::Init(const Standard_Real tolerance,
   //myCuttingFloatingEdgesMode = Standard_False; //gka
   mySameParameterMode  = Standard_True;
   myLocalToleranceMode = Standard_False;
+  myIsParallel         = Standard_False;
   mySewedShape.Nullify();
   // Load empty shape
   Load(TopoDS_Shape());
@@ -3115,6 +3142,7 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
 {
   BRep_Builder B;
   //  TopTools_MapOfShape MergedEdges;
+  if (myIsParallel) EvaluateSectionDistances();
   Message_ProgressScope aPS (theProgress, "Merging bounds", myBoundFaces.Extent());
   TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
   for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next()) {
@@ -3442,6 +3470,7 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
   }
 
   myNbVertices = myVertexNode.Extent() + myVertexNodeFree.Extent();
+  mySectionDistances.Clear();
   myNodeSections.Clear();
   myVertexNode.Clear();
   myVertexNodeFree.Clear();
@@ -3449,17 +3478,17 @@ void BRepBuilderAPI_Sewing::Merging(const Standard_Boolean /* firstTime */,
 }
 
 //=======================================================================
-//function : MergedNearestEdges
+//function : ContiguousSections
 //purpose  : 
 //=======================================================================
 
-Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& edge,
-                                                           TopTools_SequenceOfShape& SeqMergedEdge,
-                                                           TColStd_SequenceOfBoolean& SeqMergedOri)
+void BRepBuilderAPI_Sewing::ContiguousSections(const TopoDS_Shape& theEdge,
+                                               TopTools_SequenceOfShape& theSections,
+                                               const Standard_Boolean theToSkipMerged) const
 {
   // Retrieve edge nodes
   TopoDS_Vertex no1, no2;
-  TopExp::Vertices(TopoDS::Edge(edge),no1,no2);
+  TopExp::Vertices(TopoDS::Edge(theEdge),no1,no2);
   TopoDS_Shape nno1 = no1, nno2 = no2;
   Standard_Boolean isNode1 = myVertexNode.Contains(no1);
   Standard_Boolean isNode2 = myVertexNode.Contains(no2);
@@ -3503,17 +3532,16 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
   }
 
   // Find all possible contiguous edges
-  TopTools_SequenceOfShape seqEdges;
-  seqEdges.Append(edge);
+  theSections.Append(theEdge);
   TopTools_MapOfShape mapEdges;
-  mapEdges.Add(edge);
+  mapEdges.Add(theEdge);
   for (Standard_Integer i = 1; i <= mapVert1.Extent(); i++) {
     TopoDS_Shape node1 = mapVert1.FindKey(i);
     if (!myNodeSections.IsBound(node1)) continue;
     TopTools_ListIteratorOfListOfShape ilsec(myNodeSections(node1));
     for (; ilsec.More(); ilsec.Next()) {
       TopoDS_Shape sec = ilsec.Value();
-      if (sec.IsSame(edge)) continue;
+      if (sec.IsSame(theEdge)) continue;
       // Retrieve section nodes
       TopoDS_Vertex vs1, vs2;
       TopExp::Vertices(TopoDS::Edge(sec),vs1,vs2);
@@ -3523,6 +3551,11 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
       if ((mapVert1.Contains(vs1n) && mapVert2.Contains(vs2n)) ||
         (mapVert1.Contains(vs2n) && mapVert2.Contains(vs1n)))
         if (mapEdges.Add(sec)) {
+          // Keep all sections when evaluating distances in advance
+          if (!theToSkipMerged) {
+            theSections.Append(sec);
+            continue;
+          }
           // Check for rejected cutting
           Standard_Boolean isRejected = myMergedEdges.Contains(sec);
           if(!isRejected && myBoundSections.IsBound(sec))
@@ -3541,12 +3574,142 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
               myMergedEdges.Contains(bnd));
           }
 
-          if (!isRejected) seqEdges.Append(sec);
+          if (!isRejected) theSections.Append(sec);
+        }
+    }
+  }
+}
+
+//=======================================================================
+//class   : SectionDistanceFunctor
+//purpose : Evaluates distances between pairs of sections
+//=======================================================================
+
+class BRepBuilderAPI_Sewing::SectionDistanceFunctor
+{
+public:
+  //! Reference section and distance to other section to be evaluated.
+  struct Pair
+  {
+    TopoDS_Shape     Reference;
+    SectionDistance* Distance;
+  };
+
+public:
+  SectionDistanceFunctor (const BRepBuilderAPI_Sewing&   theSewing,
+                          const NCollection_Vector<Pair>& thePairs)
+  : mySewing (theSewing),
+    myPairs (thePairs)
+  {
+  }
+
+  void operator() (Standard_Integer /*theThreadIndex*/, Standard_Integer theIndex) const
+  {
+    const Pair& aPair = myPairs.Value (theIndex);
+    SectionDistance& aDist = *aPair.Distance;
+    TopTools_SequenceOfShape seqSections;
+    seqSections.Append (aPair.Reference);
+    seqSections.Append (aDist.Section);
+    TColStd_Array1OfBoolean arrForward(1,2);
+    TColStd_Array1OfReal arrDistance(1,2), arrLen(1,2), arrMinDist(1,2);
+    try {
+      mySewing.EvaluateDistances(seqSections,arrForward,arrDistance,arrLen,arrMinDist,1);
+      aDist.IsForward = arrForward(2);
+      aDist.Distance = arrDistance(2);
+      aDist.Length = arrLen(2);
+      aDist.MinDistance = arrMinDist(2);
+      aDist.IsDone = Standard_True;
+    }
+    catch (Standard_Failure const&) {
+      // the distance will be evaluated again during merging
+    }
+  }
+
+private:
+  SectionDistanceFunctor& operator= (const SectionDistanceFunctor&) Standard_DELETE;
+
+private:
+  const BRepBuilderAPI_Sewing&    mySewing;
+  const NCollection_Vector<Pair>& myPairs;
+};
+
+//=======================================================================
+//function : EvaluateSectionDistances
+//purpose  : Fills mySectionDistances
+//=======================================================================
+
+void BRepBuilderAPI_Sewing::EvaluateSectionDistances()
+{
+  mySectionDistances.Clear();
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  if (aThreadPool->NbDefaultThreadsToLaunch() <= 1) return;
+
+  // Collect all pairs of sections contiguous to the bounds and their cutting sections
+  NCollection_Vector<SectionDistanceFunctor::Pair> aPairs;
+  for (Standard_Integer i = 1; i <= myBoundFaces.Extent(); i++) {
+    // Floating edges are not merged with sections
+    if (myBoundFaces(i).IsEmpty()) continue;
+    const TopoDS_Shape& bound = myBoundFaces.FindKey(i);
+    TopTools_ListOfShape listEdges;
+    listEdges.Append(bound);
+    if (myBoundSections.IsBound(bound)) {
+      TopTools_ListIteratorOfListOfShape its(myBoundSections(bound));
+      for (; its.More(); its.Next()) listEdges.Append(its.Value());
+    }
+    for (TopTools_ListIteratorOfListOfShape ite(listEdges); ite.More(); ite.Next()) {
+      TopTools_SequenceOfShape seqSections;
+      ContiguousSections(ite.Value(), seqSections, Standard_False);
+      Standard_Integer nbSections = seqSections.Length();
+      for (Standard_Integer j = 1; j <= nbSections; j++) {
+        const TopoDS_Shape& aRef = seqSections(j);
+        // Distances to the reference without 3d curve are not evaluated in advance
+        Standard_Real first, last;
+        if (BRep_Tool::Curve(TopoDS::Edge(aRef), first, last).IsNull()) continue;
+        NCollection_List<SectionDistance>* aDistances = mySectionDistances.ChangeSeek(aRef);
+        if (!aDistances)
+          aDistances = mySectionDistances.Bound(aRef, NCollection_List<SectionDistance>());
+        for (Standard_Integer k = 1; k <= nbSections; k++) {
+          if (k == j) continue;
+          const TopoDS_Shape& aSec = seqSections(k);
+          Standard_Boolean isFound = Standard_False;
+          NCollection_List<SectionDistance>::Iterator anItD(*aDistances);
+          for (; anItD.More() && !isFound; anItD.Next())
+            isFound = anItD.Value().Section.IsSame(aSec);
+          if (isFound) continue;
+          SectionDistance aDist;
+          aDist.Section = aSec;
+          aDist.Distance = -1.0;
+          aDist.MinDistance = Precision::Infinite();
+          aDist.Length = 0.;
+          aDist.IsForward = Standard_True;
+          aDist.IsDone = Standard_False;
+          SectionDistanceFunctor::Pair& aPair = aPairs.Appended();
+          aPair.Reference = aRef;
+          aPair.Distance = &aDistances->Append(aDist);
         }
+      }
     }
   }
+  if (aPairs.IsEmpty()) return;
 
-  mapEdges.Clear();
+  SectionDistanceFunctor aFunctor (*this, aPairs);
+  const Standard_Integer aNbThreads = Min (aPairs.Length(), aThreadPool->NbDefaultThreadsToLaunch());
+  OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+  aLauncher.Perform (0, aPairs.Length(), aFunctor);
+}
+
+//=======================================================================
+//function : MergedNearestEdges
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& edge,
+                                                           TopTools_SequenceOfShape& SeqMergedEdge,
+                                                           TColStd_SequenceOfBoolean& SeqMergedOri)
+{
+  // Find all possible contiguous edges
+  TopTools_SequenceOfShape seqEdges;
+  ContiguousSections(edge, seqEdges, Standard_True);
 
   Standard_Boolean success = Standard_False;
 
@@ -3593,6 +3756,112 @@ Standard_Boolean BRepBuilderAPI_Sewing::MergedNearestEdges(const TopoDS_Shape& e
   return success;
 }
 
+//=======================================================================
+//class   : CuttingFunctor
+//purpose : Searches the vertices to cut the bounds and projects them
+//          on the bounds
+//=======================================================================
+
+class BRepBuilderAPI_Sewing::CuttingFunctor
+{
+public:
+  //! Vertices to cut the bound and their projections on the bound curve.
+  struct Candidates
+  {
+    Candidates() : IsFound (Standard_False) {}
+
+    Standard_Boolean           IsFound;
+    TopoDS_Vertex              V1;
+    TopoDS_Vertex              V2;
+    TopTools_IndexedMapOfShape Vertices;
+    TColStd_Array1OfReal       Dist;
+    TColStd_Array1OfReal       Para;
+    TColgp_Array1OfPnt         Proj;
+  };
+
+public:
+  CuttingFunctor (const BRepBuilderAPI_Sewing&      theSewing,
+                  const BRepBuilderAPI_BndBoxTree&  theTree,
+                  NCollection_Array1<Candidates>&   theCandidates)
+  : mySewing (theSewing),
+    myTree (theTree),
+    myCandidates (theCandidates)
+  {
+  }
+
+  void operator() (Standard_Integer /*theThreadIndex*/, Standard_Integer theIndex) const
+  {
+    Perform (theIndex, myCandidates.ChangeValue (theIndex));
+  }
+
+  //! Fills the candidates to cut the bound with given index in the map of bounds.
+  void Perform (const Standard_Integer theIndex, Candidates& theCandidates) const
+  {
+    theCandidates.IsFound = Standard_False;
+    // Do not cut floating edges
+    if (mySewing.myBoundFaces (theIndex).IsEmpty()) return;
+    const TopoDS_Edge& bound = TopoDS::Edge (mySewing.myBoundFaces.FindKey (theIndex));
+    // Obtain bound curve
+    TopLoc_Location loc;
+    Standard_Real first, last;
+    Handle(Geom_Curve) c3d = BRep_Tool::Curve(bound, loc, first, last);
+    if (c3d.IsNull()) return;
+    if (!loc.IsIdentity()) {
+      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
+      c3d->Transform(loc.Transformation());
+    }
+    // Obtain candidate vertices
+    TopTools_IndexedMapOfShape& CandidateVertices = theCandidates.Vertices;
+    CandidateVertices.Clear();
+    { //szv: Use brackets to destroy local variables
+      // Create bounding box around curve
+      Bnd_Box aGlobalBox;
+      GeomAdaptor_Curve adptC(c3d,first,last);
+      BndLib_Add3dCurve::Add(adptC,mySewing.myTolerance,aGlobalBox);
+      // Sort vertices to find candidates
+      BRepBuilderAPI_BndBoxTreeSelector aSelector;
+      aSelector.SetCurrent (aGlobalBox);
+      myTree.Select (aSelector);
+      // Skip bound if no node is in the boundind box
+      if (!aSelector.ResInd().Extent()) return;
+      // Retrieve bound nodes
+      TopExp::Vertices(bound,theCandidates.V1,theCandidates.V2);
+      const TopoDS_Shape& Node1 = mySewing.myVertexNode.FindFromKey(theCandidates.V1);
+      const TopoDS_Shape& Node2 = mySewing.myVertexNode.FindFromKey(theCandidates.V2);
+      // Fill map of candidate vertices
+      TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
+      for (; itl.More(); itl.Next()) {
+        const Standard_Integer index = itl.Value();
+        const TopoDS_Shape& Node = mySewing.myVertexNode.FindFromIndex(index);
+        if (!Node.IsSame(Node1) && !Node.IsSame(Node2)) {
+          TopoDS_Shape vertex = mySewing.myVertexNode.FindKey(index);
+          CandidateVertices.Add(vertex);
+        }
+      }
+    }
+    Standard_Integer nbCandidates = CandidateVertices.Extent();
+    if (!nbCandidates) return;
+    // Project vertices on curve
+    theCandidates.Para.Resize (1, nbCandidates, Standard_False);
+    theCandidates.Dist.Resize (1, nbCandidates, Standard_False);
+    theCandidates.Proj.Resize (1, nbCandidates, Standard_False);
+    TColgp_Array1OfPnt arrPnt(1,nbCandidates);
+    for (Standard_Integer j = 1; j <= nbCandidates; j++)
+      arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
+    mySewing.ProjectPointsOnCurve(arrPnt,c3d,first,last,theCandidates.Dist,
+                                  theCandidates.Para,theCandidates.Proj,Standard_True);
+    theCandidates.IsFound = Standard_True;
+  }
+
+private:
+  CuttingFunctor& operator= (const CuttingFunctor&) Standard_DELETE;
+
+private:
+  const BRepBuilderAPI_Sewing&     mySewing;
+  const BRepBuilderAPI_BndBoxTree& myTree;
+  NCollection_Array1<Candidates>&  myCandidates;
+};
+
 //=======================================================================
 //function : Cutting
 //purpose  : Modifies :
@@ -3609,7 +3878,6 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   Standard_Real eps = myTolerance*0.5;
   BRepBuilderAPI_BndBoxTree aTree;
   NCollection_UBTreeFiller <Standard_Integer, Bnd_Box> aTreeFiller (aTree);
-  BRepBuilderAPI_BndBoxTreeSelector aSelector;
   for (i = 1; i <= nbVertices; i++) {
     gp_Pnt pt = BRep_Tool::Pnt(TopoDS::Vertex(myVertexNode.FindKey(i)));
     Bnd_Box aBox;
@@ -3619,69 +3887,43 @@ void BRepBuilderAPI_Sewing::Cutting(const Message_ProgressRange& theProgress)
   }
   aTreeFiller.Fill();
 
-  Handle(Geom_Curve) c3d;
-  TopLoc_Location loc;
-  Standard_Real first, last;
   // Iterate on all boundaries
   Standard_Integer nbBounds = myBoundFaces.Extent();
   Message_ProgressScope aPS (theProgress, "Cutting bounds", nbBounds);
-  TopTools_IndexedDataMapOfShapeListOfShape::Iterator anIterB(myBoundFaces);
-  for (; anIterB.More() && aPS.More(); anIterB.Next(), aPS.Next()) {
-    const TopoDS_Edge& bound = TopoDS::Edge(anIterB.Key());
-    // Do not cut floating edges
-    if (!anIterB.Value().Extent()) continue;
-    // Obtain bound curve
-    c3d = BRep_Tool::Curve(bound, loc, first, last);
-    if (c3d.IsNull()) continue;
-    if (!loc.IsIdentity()) {
-      c3d = Handle(Geom_Curve)::DownCast(c3d->Copy());
-      c3d->Transform(loc.Transformation());
-    }
+
+  // In parallel mode the candidate vertices of all bounds are found in advance,
+  // the cutting itself modifies the maps and is performed sequentially
+  NCollection_Array1<CuttingFunctor::Candidates> aCandidates (1, 1);
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = myIsParallel
+                                    ? Min (nbBounds, aThreadPool->NbDefaultThreadsToLaunch())
+                                    : 1;
+  if (aNbThreads > 1)
+  {
+    aCandidates.Resize (1, nbBounds, Standard_False);
+  }
+  CuttingFunctor aFunctor (*this, aTree, aCandidates);
+  if (aNbThreads > 1)
+  {
+    OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+    aLauncher.Perform (1, nbBounds + 1, aFunctor);
+  }
+
+  for (i = 1; i <= nbBounds && aPS.More(); i++, aPS.Next()) {
+    const TopoDS_Edge& bound = TopoDS::Edge(myBoundFaces.FindKey(i));
+    CuttingFunctor::Candidates& aBoundCandidates = aCandidates (aNbThreads > 1 ? i : 1);
+    if (aNbThreads <= 1)
+      aFunctor.Perform (i, aBoundCandidates);
+    if (!aBoundCandidates.IsFound) continue;
     // Create cutting sections
     TopTools_ListOfShape listSections;
     { //szv: Use brackets to destroy local variables
-      // Obtain candidate vertices
-      TopoDS_Vertex V1, V2;
-      TopTools_IndexedMapOfShape CandidateVertices;
-      { //szv: Use brackets to destroy local variables
-        // Create bounding box around curve
-        Bnd_Box aGlobalBox;
-        GeomAdaptor_Curve adptC(c3d,first,last);
-        BndLib_Add3dCurve::Add(adptC,myTolerance,aGlobalBox);
-        // Sort vertices to find candidates
-        aSelector.SetCurrent (aGlobalBox);
-        aTree.Select (aSelector); 
-        // Skip bound if no node is in the boundind box
-        if (!aSelector.ResInd().Extent()) continue;
-        // Retrieve bound nodes
-        TopExp::Vertices(bound,V1,V2);
-        const TopoDS_Shape& Node1 = myVertexNode.FindFromKey(V1);
-        const TopoDS_Shape& Node2 = myVertexNode.FindFromKey(V2);
-        // Fill map of candidate vertices
-        TColStd_ListIteratorOfListOfInteger itl(aSelector.ResInd());
-        for (; itl.More(); itl.Next()) {
-          const Standard_Integer index = itl.Value();
-          const TopoDS_Shape& Node = myVertexNode.FindFromIndex(index);
-          if (!Node.IsSame(Node1) && !Node.IsSame(Node2)) {
-            TopoDS_Shape vertex = myVertexNode.FindKey(index);
-            CandidateVertices.Add(vertex);
-          }
-        }
-        aSelector.ClearResList();
-      }
-      Standard_Integer nbCandidates = CandidateVertices.Extent();
-      if (!nbCandidates) continue;
-      // Project vertices on curve
-      TColStd_Array1OfReal arrPara(1,nbCandidates), arrDist(1,nbCandidates);
-      TColgp_Array1OfPnt arrPnt(1,nbCandidates), arrProj(1,nbCandidates);
-      for (Standard_Integer j = 1; j <= nbCandidates; j++)
-        arrPnt(j) = BRep_Tool::Pnt(TopoDS::Vertex(CandidateVertices(j)));
-      ProjectPointsOnCurve(arrPnt,c3d,first,last,arrDist,arrPara,arrProj,Standard_True);
       // Create cutting nodes
       TopTools_SequenceOfShape seqNode;
       TColStd_SequenceOfReal seqPara;
-      CreateCuttingNodes(CandidateVertices,bound,
-        V1,V2,arrDist,arrPara,arrProj,seqNode,seqPara);
+      CreateCuttingNodes(aBoundCandidates.Vertices,bound,
+        aBoundCandidates.V1,aBoundCandidates.V2,aBoundCandidates.Dist,
+        aBoundCandidates.Para,aBoundCandidates.Proj,seqNode,seqPara);
       if (!seqPara.Length()) continue;
       // Create cutting sections
       CreateSections(bound, seqNode, seqPara, listSections);
@@ -4024,6 +4266,52 @@ void BRepBuilderAPI_Sewing::EdgeProcessing(const Message_ProgressRange& theProgr
   }
 }
 
+//=======================================================================
+//class   : RegularityFunctor
+//purpose : Encodes regularity of merged edges in parallel; all occurrences
+//          of the same edge are processed by one thread in their order
+//=======================================================================
+
+namespace
+{
+  class RegularityFunctor
+  {
+  public:
+    RegularityFunctor (const TopTools_IndexedDataMapOfShapeListOfShape& theEdgeFaces,
+                       NCollection_Array1<Message_ProgressRange>&       theRanges)
+    : myEdgeFaces (theEdgeFaces),
+      myRanges (theRanges)
+    {
+    }
+
+    void operator() (Standard_Integer /*theThreadIndex*/, Standard_Integer theIndex) const
+    {
+      Message_ProgressRange& aRange = myRanges.ChangeValue (theIndex);
+      if (!aRange.More()) return;
+      // the list contains the triples (edge, face, face)
+      TopTools_ListIteratorOfListOfShape anIt (myEdgeFaces (theIndex));
+      while (anIt.More())
+      {
+        TopoDS_Edge anEdge = TopoDS::Edge (anIt.Value());
+        anIt.Next();
+        const TopoDS_Face& aFace1 = TopoDS::Face (anIt.Value());
+        anIt.Next();
+        const TopoDS_Face& aFace2 = TopoDS::Face (anIt.Value());
+        anIt.Next();
+        BRepLib::EncodeRegularity (anEdge, aFace1, aFace2);
+      }
+      aRange.Close();
+    }
+
+  private:
+    RegularityFunctor& operator= (const RegularityFunctor&) Standard_DELETE;
+
+  private:
+    const TopTools_IndexedDataMapOfShapeListOfShape& myEdgeFaces;
+    NCollection_Array1<Message_ProgressRange>&       myRanges;
+  };
+}
+
 //=======================================================================
 //function : EdgeRegularity
 //purpose  : update Continuity flag on newly created edges
@@ -4034,6 +4322,43 @@ void BRepBuilderAPI_Sewing::EdgeRegularity(const Message_ProgressRange& theProgr
   TopTools_IndexedDataMapOfShapeListOfShape aMapEF;
   TopExp::MapShapesAndAncestors(mySewedShape, TopAbs_EDGE, TopAbs_FACE, aMapEF);
 
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  if (myIsParallel && aThreadPool->NbDefaultThreadsToLaunch() > 1)
+  {
+    // Collect the edges with their faces; the edges sharing the same TShape
+    // are kept together as they are modified by the encoding
+    TopTools_IndexedDataMapOfShapeListOfShape aMapEdgeFaces;
+    for (TopTools_MapIteratorOfMapOfShape aMEIt(myMergedEdges); aMEIt.More(); aMEIt.Next())
+    {
+      TopoDS_Edge anEdge = TopoDS::Edge(myReShape->Apply(aMEIt.Value()));
+      const TopTools_ListOfShape* aFaces = aMapEF.Seek(anEdge);
+      // encode regularity if and only if edges is shared by two faces
+      if (!aFaces || aFaces->Extent() != 2)
+        continue;
+      const TopoDS_Shape aPureEdge = anEdge.Located(TopLoc_Location());
+      TopTools_ListOfShape* anEdgeFaces = aMapEdgeFaces.ChangeSeek(aPureEdge);
+      if (!anEdgeFaces)
+        anEdgeFaces = &aMapEdgeFaces.ChangeFromIndex(aMapEdgeFaces.Add(aPureEdge, TopTools_ListOfShape()));
+      anEdgeFaces->Append(anEdge);
+      anEdgeFaces->Append(aFaces->First());
+      anEdgeFaces->Append(aFaces->Last());
+    }
+
+    const Standard_Integer aNbEdges = aMapEdgeFaces.Extent();
+    if (aNbEdges > 0)
+    {
+      Message_ProgressScope aPS(theProgress, "Encode edge regularity", aNbEdges);
+      NCollection_Array1<Message_ProgressRange> aRanges(1, aNbEdges);
+      for (Standard_Integer i = 1; i <= aNbEdges; i++)
+        aRanges(i) = aPS.Next();
+      RegularityFunctor aFunctor(aMapEdgeFaces, aRanges);
+      OSD_ThreadPool::Launcher aLauncher(*aThreadPool, Min(aNbEdges, aThreadPool->NbDefaultThreadsToLaunch()));
+      aLauncher.Perform(1, aNbEdges + 1, aFunctor);
+    }
+    myMergedEdges.Clear();
+    return;
+  }
+
   Message_ProgressScope aPS(theProgress, "Encode edge regularity", myMergedEdges.Extent());
   for (TopTools_MapIteratorOfMapOfShape aMEIt(myMergedEdges); aMEIt.More() && aPS.More(); aMEIt.Next(), aPS.Next())
   {
@@ -38,6 +38,9 @@
 #include <TColStd_Array1OfReal.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_SequenceOfReal.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_List.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
 
 #include <Message_ProgressRange.hxx>
 
@@ -233,6 +236,16 @@ public:
   //! INTERNAL FUNCTIONS ---
     Standard_Boolean NonManifoldMode() const;
 
+  //! Sets mode for parallel computations. By default - false.
+  //! The search of cutting vertices on the bounds, the evaluation of distances
+  //! between the sections to be merged and the encoding of the regularity of the
+  //! merged edges are performed in parallel threads in this mode, the result is
+  //! the same as in sequential mode.
+    void SetParallel (const Standard_Boolean theIsParallel);
+
+  //! Returns mode for parallel computations.
+    Standard_Boolean IsParallel() const;
+
 
 
 
@@ -327,6 +340,18 @@ protected:
   //! Performs cutting of bound
   //! This method is called from Cutting only
   Standard_EXPORT virtual void CreateSections (const TopoDS_Shape& bound, const TopTools_SequenceOfShape& seqNode, const TColStd_SequenceOfReal& seqPara, TopTools_ListOfShape& listEdge);
+
+  //! Fills the sequence of sections connected to the edge through the nodes,
+  //! the edge itself is put first.
+  //! If theToSkipMerged is true the sections which cannot be merged any more
+  //! (already merged sections and the sections of merged or split bounds) are skipped.
+  //! This method is called from MergedNearestEdges and EvaluateSectionDistances only
+  Standard_EXPORT void ContiguousSections (const TopoDS_Shape& theEdge, TopTools_SequenceOfShape& theSections, const Standard_Boolean theToSkipMerged) const;
+
+  //! Evaluates in parallel the distances between all pairs of sections
+  //! which can be compared by FindCandidates() during Merging.
+  //! This method is called from Merging only
+  Standard_EXPORT void EvaluateSectionDistances();
   
   //! Makes all edges from shape same parameter
   //! if SameParameterMode is equal to Standard_True
@@ -370,6 +395,30 @@ private:
   Standard_Real myMinTolerance;
   Standard_Real myMaxTolerance;
   TopTools_MapOfShape myMergedEdges;
+  Standard_Boolean myIsParallel;
+
+private:
+
+  //! Distance from the reference section to other section (see EvaluateDistances()).
+  struct SectionDistance
+  {
+    TopoDS_Shape     Section;
+    Standard_Real    Distance;
+    Standard_Real    MinDistance;
+    Standard_Real    Length;
+    Standard_Boolean IsForward;
+    Standard_Boolean IsDone;
+  };
+
+  //! Functor for parallel search of cutting vertices.
+  class CuttingFunctor;
+
+  //! Functor for parallel evaluation of distances between sections.
+  class SectionDistanceFunctor;
+
+  //! Distances from the reference sections to the sections contiguous to them,
+  //! evaluated in advance in parallel mode.
+  NCollection_DataMap<TopoDS_Shape, NCollection_List<SectionDistance>, TopTools_ShapeMapHasher> mySectionDistances;
 
 
 };
@@ -37,48 +37,138 @@
 #include <TopoDS_Shape.hxx>
 #include <TopTools_MapOfShape.hxx>
 
-//! Functor for multi-threaded execution.
+#include <atomic>
+
+//! Functor for multi-threaded computation of the results of sub-shapes
+//! (checks performed on the sub-shape itself).
+class BRepCheck_ParallelBuilder
+{
+public:
+  BRepCheck_ParallelBuilder (BRepCheck_IndexedDataMapOfShapeResult& theMap,
+                             const Standard_Boolean theGeomControls,
+                             const Standard_Boolean theIsExact,
+                             const Standard_Boolean theIsParallel,
+                             std::atomic<bool>* theFailureFlag)
+  : myMap (theMap),
+    myFailureFlag (theFailureFlag),
+    myGeomControls (theGeomControls),
+    myIsExact (theIsExact),
+    myIsParallel (theIsParallel)
+  {
+    //
+  }
+
+  void operator() (const Standard_Integer theIndex) const;
+
+private:
+  BRepCheck_ParallelBuilder& operator=(const BRepCheck_ParallelBuilder&) Standard_DELETE;
+
+private:
+  BRepCheck_IndexedDataMapOfShapeResult& myMap;
+  std::atomic<bool>* myFailureFlag;
+  Standard_Boolean myGeomControls;
+  Standard_Boolean myIsExact;
+  Standard_Boolean myIsParallel;
+};
+
+//! Functor for multi-threaded execution of the checks of sub-shapes in context
+//! of the shapes containing them. Each shape is a separate task, so that the
+//! threads take the next shape as soon as the previous one is processed.
 class BRepCheck_ParallelAnalyzer
 {
 public:
-  BRepCheck_ParallelAnalyzer (NCollection_Array1< NCollection_Array1<TopoDS_Shape> >& theArray,
-                              const BRepCheck_IndexedDataMapOfShapeResult& theMap)
-  : myArray (theArray),
-    myMap (theMap)
+  BRepCheck_ParallelAnalyzer (const NCollection_Array1<TopoDS_Shape>& theShapes,
+                              const BRepCheck_IndexedDataMapOfShapeResult& theMap,
+                              NCollection_Array1<Standard_Boolean>& theIsChecked,
+                              std::atomic<bool>* theFailureFlag)
+  : myShapes (theShapes),
+    myMap (theMap),
+    myIsChecked (theIsChecked),
+    myFailureFlag (theFailureFlag)
   {
     //
   }
 
-  void operator() (const Standard_Integer theVectorIndex) const
+  //! Returns true if the result contains a status other than BRepCheck_NoError
+  //! for the given shape (the shape of the result or its context).
+  static Standard_Boolean IsFailed (const Handle(BRepCheck_Result)& theResult,
+                                    const TopoDS_Shape& theShape)
+  {
+    if (theResult.IsNull())
+    {
+      return Standard_False;
+    }
+
+    Standard_Mutex::Sentry aLock (theResult->GetMutex());
+    if (!theResult->IsStatusOnShape (theShape))
+    {
+      return Standard_False;
+    }
+    for (BRepCheck_ListIteratorOfListOfStatus itl (theResult->StatusOnShape (theShape)); itl.More(); itl.Next())
+    {
+      if (itl.Value() != BRepCheck_NoError)
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  void operator() (const Standard_Integer theIndex) const
   {
+    if (myFailureFlag != NULL && *myFailureFlag)
+    {
+      // invalidity is already detected, the rest is not needed
+      return;
+    }
+
     TopExp_Explorer exp;
-    for (Standard_Integer aShapeIter = myArray[theVectorIndex].Lower();
-         aShapeIter <= myArray[theVectorIndex].Upper(); ++aShapeIter)
+    const TopoDS_Shape& aShape = myShapes.Value (theIndex);
+    const TopAbs_ShapeEnum aType = aShape.ShapeType();
+    const Handle(BRepCheck_Result)& aResult = myMap.FindFromKey (aShape);
+    switch (aType)
     {
-      const TopoDS_Shape& aShape = myArray[theVectorIndex][aShapeIter];
-      const TopAbs_ShapeEnum aType = aShape.ShapeType();
-      const Handle(BRepCheck_Result)& aResult = myMap.FindFromKey (aShape);
-      switch (aType)
+      case TopAbs_VERTEX:
       {
-        case TopAbs_VERTEX:
+        // modified by NIZHNY-MKK  Wed May 19 16:56:16 2004.BEGIN
+        // There is no need to check anything.
+        //       if (aShape.IsSame(S)) {
+        //  myMap(S)->Blind();
+        //       }
+        // modified by NIZHNY-MKK  Wed May 19 16:56:23 2004.END
+        break;
+      }
+      case TopAbs_EDGE:
+      {
+        try
         {
-          // modified by NIZHNY-MKK  Wed May 19 16:56:16 2004.BEGIN
-          // There is no need to check anything.
-          //       if (aShape.IsSame(S)) {
-          //  myMap(S)->Blind();
-          //       }
-          // modified by NIZHNY-MKK  Wed May 19 16:56:23 2004.END
-          break;
+          Handle(BRepCheck_Edge) aResEdge = Handle(BRepCheck_Edge)::DownCast(aResult);
+          const BRepCheck_Status ste = aResEdge->CheckPolygonOnTriangulation (TopoDS::Edge (aShape));
+          if (ste != BRepCheck_NoError)
+          {
+            aResEdge->SetStatus (ste);
+          }
         }
-        case TopAbs_EDGE:
+        catch (Standard_Failure const& anException)
         {
+          (void)anException;
+          if (!aResult.IsNull())
+          {
+            aResult->SetFailStatus (aShape);
+          }
+        }
+
+        TopTools_MapOfShape MapS;
+        for (exp.Init (aShape, TopAbs_VERTEX); exp.More(); exp.Next())
+        {
+          const TopoDS_Shape& aVertex = exp.Current();
+          Handle(BRepCheck_Result) aResOfVertex = myMap.FindFromKey (aVertex);
           try
           {
-            Handle(BRepCheck_Edge) aResEdge = Handle(BRepCheck_Edge)::DownCast(aResult);
-            const BRepCheck_Status ste = aResEdge->CheckPolygonOnTriangulation (TopoDS::Edge (aShape));
-            if (ste != BRepCheck_NoError)
+            OCC_CATCH_SIGNALS
+            if (MapS.Add (aVertex))
             {
-              aResEdge->SetStatus (ste);
+              aResOfVertex->InContext (aShape);
             }
           }
           catch (Standard_Failure const& anException)
@@ -88,187 +178,126 @@ public:
             {
               aResult->SetFailStatus (aShape);
             }
-          }
 
-          TopTools_MapOfShape MapS;
-          for (exp.Init (aShape, TopAbs_VERTEX); exp.More(); exp.Next())
-          {
-            const TopoDS_Shape& aVertex = exp.Current();
-            Handle(BRepCheck_Result) aResOfVertex = myMap.FindFromKey (aVertex);
-            try
+            if (!aResOfVertex.IsNull())
             {
-              OCC_CATCH_SIGNALS
-              if (MapS.Add (aVertex))
-              {
-                aResOfVertex->InContext (aShape);
-              }
-            }
-            catch (Standard_Failure const& anException)
-            {
-              (void)anException;
-              if (!aResult.IsNull())
-              {
-                aResult->SetFailStatus (aShape);
-              }
-
-              if (!aResOfVertex.IsNull())
-              {
-                aResOfVertex->SetFailStatus (aVertex);
-                aResOfVertex->SetFailStatus (aShape);
-              }
+              aResOfVertex->SetFailStatus (aVertex);
+              aResOfVertex->SetFailStatus (aShape);
             }
           }
-          break;
-        }
-        case TopAbs_WIRE:
-        {
-          break;
         }
-        case TopAbs_FACE:
+        break;
+      }
+      case TopAbs_WIRE:
+      {
+        break;
+      }
+      case TopAbs_FACE:
+      {
+        TopTools_MapOfShape MapS;
+        for (exp.Init (aShape, TopAbs_VERTEX); exp.More(); exp.Next())
         {
-          TopTools_MapOfShape MapS;
-          for (exp.Init (aShape, TopAbs_VERTEX); exp.More(); exp.Next())
+          Handle(BRepCheck_Result) aFaceVertexRes = myMap.FindFromKey (exp.Current());
+          try
           {
-            Handle(BRepCheck_Result) aFaceVertexRes = myMap.FindFromKey (exp.Current());
-            try
+            OCC_CATCH_SIGNALS
+            if (MapS.Add (exp.Current()))
             {
-              OCC_CATCH_SIGNALS
-              if (MapS.Add (exp.Current()))
-              {
-                aFaceVertexRes->InContext (aShape);
-              }
-            }
-            catch (Standard_Failure const& anException)
-            {
-              (void)anException;
-              if (!aResult.IsNull())
-              {
-                aResult->SetFailStatus (aShape);
-              }
-              if (!aFaceVertexRes.IsNull())
-              {
-                aFaceVertexRes->SetFailStatus (exp.Current());
-                aFaceVertexRes->SetFailStatus (aShape);
-              }
+              aFaceVertexRes->InContext (aShape);
             }
           }
-
-          Standard_Boolean performwire = Standard_True;
-          Standard_Boolean isInvalidTolerance = Standard_False;
-          MapS.Clear();
-          for (exp.Init (aShape, TopAbs_EDGE); exp.More(); exp.Next())
+          catch (Standard_Failure const& anException)
           {
-            const Handle(BRepCheck_Result)& aFaceEdgeRes = myMap.FindFromKey (exp.Current());
-            try
+            (void)anException;
+            if (!aResult.IsNull())
             {
-              OCC_CATCH_SIGNALS
-              if (MapS.Add (exp.Current()))
-              {
-                aFaceEdgeRes->InContext (aShape);
-
-                if (performwire)
-                {
-                  Standard_Mutex::Sentry aLock (aFaceEdgeRes->GetMutex());
-                  if (aFaceEdgeRes->IsStatusOnShape(aShape))
-                  {
-                    BRepCheck_ListIteratorOfListOfStatus itl (aFaceEdgeRes->StatusOnShape (aShape));
-                    for (; itl.More(); itl.Next())
-                    {
-                      const BRepCheck_Status ste = itl.Value();
-                      if (ste == BRepCheck_NoCurveOnSurface ||
-                          ste == BRepCheck_InvalidCurveOnSurface ||
-                          ste == BRepCheck_InvalidRange ||
-                          ste == BRepCheck_InvalidCurveOnClosedSurface)
-                      {
-                        performwire = Standard_False;
-                        break;
-                      }
-                    }
-                  }
-                }
-              }
+              aResult->SetFailStatus (aShape);
             }
-            catch (Standard_Failure const& anException)
+            if (!aFaceVertexRes.IsNull())
             {
-              (void)anException;
-              if (!aResult.IsNull())
-              {
-                aResult->SetFailStatus (aShape);
-              }
-              if (!aFaceEdgeRes.IsNull())
-              {
-                aFaceEdgeRes->SetFailStatus (exp.Current());
-                aFaceEdgeRes->SetFailStatus (aShape);
-              }
+              aFaceVertexRes->SetFailStatus (exp.Current());
+              aFaceVertexRes->SetFailStatus (aShape);
             }
           }
+        }
 
-          Standard_Boolean orientofwires = performwire;
-          for (exp.Init (aShape, TopAbs_WIRE); exp.More(); exp.Next())
+        Standard_Boolean performwire = Standard_True;
+        Standard_Boolean isInvalidTolerance = Standard_False;
+        MapS.Clear();
+        for (exp.Init (aShape, TopAbs_EDGE); exp.More(); exp.Next())
+        {
+          const Handle(BRepCheck_Result)& aFaceEdgeRes = myMap.FindFromKey (exp.Current());
+          try
           {
-            const Handle(BRepCheck_Result)& aFaceWireRes = myMap.FindFromKey (exp.Current());
-            try
+            OCC_CATCH_SIGNALS
+            if (MapS.Add (exp.Current()))
             {
-              OCC_CATCH_SIGNALS
-              aFaceWireRes->InContext (aShape);
+              aFaceEdgeRes->InContext (aShape);
 
-              if (orientofwires)
+              if (performwire)
               {
-                Standard_Mutex::Sentry aLock (aFaceWireRes->GetMutex());
-                if (aFaceWireRes->IsStatusOnShape (aShape))
+                Standard_Mutex::Sentry aLock (aFaceEdgeRes->GetMutex());
+                if (aFaceEdgeRes->IsStatusOnShape(aShape))
                 {
-                  const BRepCheck_ListOfStatus& aStatusList = aFaceWireRes->StatusOnShape (aShape);
-                  BRepCheck_ListIteratorOfListOfStatus itl (aStatusList);
+                  BRepCheck_ListIteratorOfListOfStatus itl (aFaceEdgeRes->StatusOnShape (aShape));
                   for (; itl.More(); itl.Next())
                   {
-                    BRepCheck_Status ste = itl.Value();
-                    if (ste != BRepCheck_NoError)
+                    const BRepCheck_Status ste = itl.Value();
+                    if (ste == BRepCheck_NoCurveOnSurface ||
+                        ste == BRepCheck_InvalidCurveOnSurface ||
+                        ste == BRepCheck_InvalidRange ||
+                        ste == BRepCheck_InvalidCurveOnClosedSurface)
                     {
-                      orientofwires = Standard_False;
+                      performwire = Standard_False;
                       break;
                     }
                   }
                 }
               }
             }
-            catch (Standard_Failure const& anException)
+          }
+          catch (Standard_Failure const& anException)
+          {
+            (void)anException;
+            if (!aResult.IsNull())
             {
-              (void)anException;
-              if (!aResult.IsNull())
-              {
-                aResult->SetFailStatus (aShape);
-              }
-              if (!aFaceWireRes.IsNull())
-              {
-                aFaceWireRes->SetFailStatus (exp.Current());
-                aFaceWireRes->SetFailStatus (aShape);
-              }
+              aResult->SetFailStatus (aShape);
+            }
+            if (!aFaceEdgeRes.IsNull())
+            {
+              aFaceEdgeRes->SetFailStatus (exp.Current());
+              aFaceEdgeRes->SetFailStatus (aShape);
             }
           }
+        }
 
+        Standard_Boolean orientofwires = performwire;
+        for (exp.Init (aShape, TopAbs_WIRE); exp.More(); exp.Next())
+        {
+          const Handle(BRepCheck_Result)& aFaceWireRes = myMap.FindFromKey (exp.Current());
           try
           {
             OCC_CATCH_SIGNALS
-            const Handle(BRepCheck_Face) aFaceRes = Handle(BRepCheck_Face)::DownCast(aResult);
-            if (isInvalidTolerance)
-            {
-              aFaceRes->SetStatus (BRepCheck_InvalidToleranceValue);
-            }
-            else if (performwire)
+            aFaceWireRes->InContext (aShape);
+
+            if (orientofwires)
             {
-              if (orientofwires)
-              {
-                aFaceRes->OrientationOfWires (Standard_True);// on enregistre
-              }
-              else
+              Standard_Mutex::Sentry aLock (aFaceWireRes->GetMutex());
+              if (aFaceWireRes->IsStatusOnShape (aShape))
               {
-                aFaceRes->SetUnorientable();
+                const BRepCheck_ListOfStatus& aStatusList = aFaceWireRes->StatusOnShape (aShape);
+                BRepCheck_ListIteratorOfListOfStatus itl (aStatusList);
+                for (; itl.More(); itl.Next())
+                {
+                  BRepCheck_Status ste = itl.Value();
+                  if (ste != BRepCheck_NoError)
+                  {
+                    orientofwires = Standard_False;
+                    break;
+                  }
+                }
               }
             }
-            else
-            {
-              aFaceRes->SetUnorientable();
-            }
           }
           catch (Standard_Failure const& anException)
           {
@@ -277,122 +306,193 @@ public:
             {
               aResult->SetFailStatus (aShape);
             }
+            if (!aFaceWireRes.IsNull())
+            {
+              aFaceWireRes->SetFailStatus (exp.Current());
+              aFaceWireRes->SetFailStatus (aShape);
+            }
+          }
+        }
 
-            for (exp.Init (aShape, TopAbs_WIRE); exp.More(); exp.Next())
+        try
+        {
+          OCC_CATCH_SIGNALS
+          const Handle(BRepCheck_Face) aFaceRes = Handle(BRepCheck_Face)::DownCast(aResult);
+          if (isInvalidTolerance)
+          {
+            aFaceRes->SetStatus (BRepCheck_InvalidToleranceValue);
+          }
+          else if (performwire)
+          {
+            if (orientofwires)
             {
-              Handle(BRepCheck_Result) aFaceCatchRes = myMap.FindFromKey (exp.Current());
-              if (!aFaceCatchRes.IsNull())
-              {
-                aFaceCatchRes->SetFailStatus (exp.Current());
-                aFaceCatchRes->SetFailStatus (aShape);
-                aResult->SetFailStatus (exp.Current());
-              }
+              aFaceRes->OrientationOfWires (Standard_True);// on enregistre
             }
+            else
+            {
+              aFaceRes->SetUnorientable();
+            }
+          }
+          else
+          {
+            aFaceRes->SetUnorientable();
           }
-          break;
         }
-        case TopAbs_SHELL:
+        catch (Standard_Failure const& anException)
         {
-          break;
+          (void)anException;
+          if (!aResult.IsNull())
+          {
+            aResult->SetFailStatus (aShape);
+          }
+
+          for (exp.Init (aShape, TopAbs_WIRE); exp.More(); exp.Next())
+          {
+            Handle(BRepCheck_Result) aFaceCatchRes = myMap.FindFromKey (exp.Current());
+            if (!aFaceCatchRes.IsNull())
+            {
+              aFaceCatchRes->SetFailStatus (exp.Current());
+              aFaceCatchRes->SetFailStatus (aShape);
+              aResult->SetFailStatus (exp.Current());
+            }
+          }
         }
-        case TopAbs_SOLID:
+        break;
+      }
+      case TopAbs_SHELL:
+      {
+        break;
+      }
+      case TopAbs_SOLID:
+      {
+        exp.Init (aShape, TopAbs_SHELL);
+        for (; exp.More(); exp.Next())
         {
-          exp.Init (aShape, TopAbs_SHELL);
-          for (; exp.More(); exp.Next())
+          const TopoDS_Shape& aShell = exp.Current();
+          Handle(BRepCheck_Result) aSolidRes = myMap.FindFromKey (aShell);
+          try
+          {
+            OCC_CATCH_SIGNALS
+            aSolidRes->InContext (aShape);
+          }
+          catch (Standard_Failure const& anException)
           {
-            const TopoDS_Shape& aShell = exp.Current();
-            Handle(BRepCheck_Result) aSolidRes = myMap.FindFromKey (aShell);
-            try
+            (void)anException;
+            if (!aResult.IsNull())
             {
-              OCC_CATCH_SIGNALS
-              aSolidRes->InContext (aShape);
+              aResult->SetFailStatus (aShape);
             }
-            catch (Standard_Failure const& anException)
+            if (!aSolidRes.IsNull())
             {
-              (void)anException;
-              if (!aResult.IsNull())
-              {
-                aResult->SetFailStatus (aShape);
-              }
-              if (!aSolidRes.IsNull())
-              {
-                aSolidRes->SetFailStatus (exp.Current());
-                aSolidRes->SetFailStatus (aShape);
-              }
+              aSolidRes->SetFailStatus (exp.Current());
+              aSolidRes->SetFailStatus (aShape);
             }
           }
-          break;
         }
-        default:
+        break;
+      }
+      default:
+      {
+        break;
+      }
+    }
+
+    // each thread writes its own elements only
+    myIsChecked.ChangeValue (theIndex) = Standard_True;
+    if (myFailureFlag != NULL && isFailedInContext (aShape))
+    {
+      *myFailureFlag = true;
+    }
+  }
+
+private:
+
+  //! Checks the statuses verified by BRepCheck_Analyzer::IsValid()
+  //! for the shape and its sub-shapes in its context.
+  Standard_Boolean isFailedInContext (const TopoDS_Shape& theShape) const
+  {
+    if (IsFailed (myMap.FindFromKey (theShape), theShape))
+    {
+      return Standard_True;
+    }
+
+    TopAbs_ShapeEnum aSubTypes[3] = { TopAbs_SHAPE, TopAbs_SHAPE, TopAbs_SHAPE };
+    switch (theShape.ShapeType())
+    {
+      case TopAbs_EDGE:
+        aSubTypes[0] = TopAbs_VERTEX;
+        break;
+      case TopAbs_FACE:
+        aSubTypes[0] = TopAbs_WIRE;
+        aSubTypes[1] = TopAbs_EDGE;
+        aSubTypes[2] = TopAbs_VERTEX;
+        break;
+      case TopAbs_SOLID:
+        aSubTypes[0] = TopAbs_SHELL;
+        break;
+      default:
+        break;
+    }
+
+    for (Standard_Integer aTypeIter = 0; aTypeIter < 3 && aSubTypes[aTypeIter] != TopAbs_SHAPE; ++aTypeIter)
+    {
+      for (TopExp_Explorer anExp (theShape, aSubTypes[aTypeIter]); anExp.More(); anExp.Next())
+      {
+        if (IsFailed (myMap.FindFromKey (anExp.Current()), theShape))
         {
-          break;
+          return Standard_True;
         }
       }
     }
+    return Standard_False;
   }
 
 private:
   BRepCheck_ParallelAnalyzer& operator=(const BRepCheck_ParallelAnalyzer&) Standard_DELETE;
 
 private:
-  NCollection_Array1< NCollection_Array1<TopoDS_Shape> >& myArray;
+  const NCollection_Array1<TopoDS_Shape>& myShapes;
   const BRepCheck_IndexedDataMapOfShapeResult& myMap;
+  NCollection_Array1<Standard_Boolean>& myIsChecked;
+  std::atomic<bool>* myFailureFlag;
 };
 
 //=======================================================================
-//function : Init
-//purpose  :
-//=======================================================================
-void BRepCheck_Analyzer::Init (const TopoDS_Shape& theShape,
-                               const Standard_Boolean B)
-{
-  if (theShape.IsNull())
-  {
-    throw Standard_NullObject ("BRepCheck_Analyzer::Init() - NULL shape");
-  }
-
-  myShape = theShape;
-  myMap.Clear();
-  Put (theShape, B);
-  Perform();
-}
-
-//=======================================================================
-//function : Put
+//function : operator()
 //purpose  :
 //=======================================================================
-void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape,
-                              const Standard_Boolean B)
+void BRepCheck_ParallelBuilder::operator() (const Standard_Integer theIndex) const
 {
-  if (myMap.Contains (theShape))
+  if (myFailureFlag != NULL && *myFailureFlag)
   {
     return;
   }
 
+  const TopoDS_Shape& aShape = myMap.FindKey (theIndex);
   Handle(BRepCheck_Result) HR;
-  switch (theShape.ShapeType())
+  switch (aShape.ShapeType())
   {
     case TopAbs_VERTEX:
-      HR = new BRepCheck_Vertex (TopoDS::Vertex (theShape));
+      HR = new BRepCheck_Vertex (TopoDS::Vertex (aShape));
       break;
     case TopAbs_EDGE:
-      HR = new BRepCheck_Edge (TopoDS::Edge (theShape));
-      Handle(BRepCheck_Edge)::DownCast(HR)->GeometricControls (B);
-      Handle(BRepCheck_Edge)::DownCast(HR)->SetExactMethod(myIsExact);
+      HR = new BRepCheck_Edge (TopoDS::Edge (aShape));
+      Handle(BRepCheck_Edge)::DownCast(HR)->GeometricControls (myGeomControls);
+      Handle(BRepCheck_Edge)::DownCast(HR)->SetExactMethod (myIsExact);
       break;
     case TopAbs_WIRE:
-      HR = new BRepCheck_Wire (TopoDS::Wire (theShape));
-      Handle(BRepCheck_Wire)::DownCast(HR)->GeometricControls (B);
+      HR = new BRepCheck_Wire (TopoDS::Wire (aShape));
+      Handle(BRepCheck_Wire)::DownCast(HR)->GeometricControls (myGeomControls);
       break;
     case TopAbs_FACE:
-      HR = new BRepCheck_Face (TopoDS::Face (theShape));
-      Handle(BRepCheck_Face)::DownCast(HR)->GeometricControls (B);
+      HR = new BRepCheck_Face (TopoDS::Face (aShape));
+      Handle(BRepCheck_Face)::DownCast(HR)->GeometricControls (myGeomControls);
       break;
     case TopAbs_SHELL:
-      HR = new BRepCheck_Shell (TopoDS::Shell (theShape));
+      HR = new BRepCheck_Shell (TopoDS::Shell (aShape));
       break;
     case TopAbs_SOLID:
-      HR = new BRepCheck_Solid (TopoDS::Solid (theShape));
+      HR = new BRepCheck_Solid (TopoDS::Solid (aShape));
       break;
     case TopAbs_COMPSOLID:
     case TopAbs_COMPOUND:
@@ -401,15 +501,56 @@ void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape,
       break;
   }
 
-  if (!HR.IsNull())
+  if (HR.IsNull())
+  {
+    return;
+  }
+
+  HR->SetParallel (myIsParallel);
+  myMap.ChangeFromIndex (theIndex) = HR;
+  if (myFailureFlag != NULL && BRepCheck_ParallelAnalyzer::IsFailed (HR, aShape))
+  {
+    *myFailureFlag = true;
+  }
+}
+
+//=======================================================================
+//function : Init
+//purpose  :
+//=======================================================================
+void BRepCheck_Analyzer::Init (const TopoDS_Shape& theShape,
+                               const Standard_Boolean B)
+{
+  if (theShape.IsNull())
+  {
+    throw Standard_NullObject ("BRepCheck_Analyzer::Init() - NULL shape");
+  }
+
+  myShape = theShape;
+  myMap.Clear();
+  myUncheckedShapes.Clear();
+  myIsFailureFound = Standard_False;
+  Put (theShape);
+  Perform (B);
+}
+
+//=======================================================================
+//function : Put
+//purpose  :
+//=======================================================================
+void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape)
+{
+  if (myMap.Contains (theShape))
   {
-    HR->SetParallel (myIsParallel);
+    return;
   }
-  myMap.Add (theShape, HR);
+
+  // the results are created by Perform()
+  myMap.Add (theShape, Handle(BRepCheck_Result)());
 
   for (TopoDS_Iterator theIterator (theShape); theIterator.More(); theIterator.Next())
   {
-    Put (theIterator.Value(), B); // performs minimum on each shape
+    Put (theIterator.Value());
   }
 }
 
@@ -417,40 +558,75 @@ void BRepCheck_Analyzer::Put (const TopoDS_Shape& theShape,
 //function : Perform
 //purpose  :
 //=======================================================================
-void BRepCheck_Analyzer::Perform()
+void BRepCheck_Analyzer::Perform (const Standard_Boolean theGeomControls)
 {
+  std::atomic<bool> aFailureFlag (false);
+  std::atomic<bool>* aFailureFlagPtr = myIsStopOnFirstFailure ? &aFailureFlag : NULL;
+
+  // performs minimum on each shape
   const Standard_Integer aMapSize = myMap.Size();
-  const Standard_Integer aMinTaskSize = 10;
-  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
-  const Standard_Integer aNbThreads = aThreadPool->NbThreads();
-  Standard_Integer aNbTasks = aNbThreads * 10;
-  Standard_Integer aTaskSize = (Standard_Integer)Ceiling ((double)aMapSize / aNbTasks);
-  if (aTaskSize < aMinTaskSize)
+  BRepCheck_ParallelBuilder aParallelBuilder (myMap, theGeomControls, myIsExact, myIsParallel, aFailureFlagPtr);
+  OSD_Parallel::For (1, aMapSize + 1, aParallelBuilder, !myIsParallel);
+  if (aFailureFlag)
   {
-    aTaskSize = aMinTaskSize;
-    aNbTasks = (Standard_Integer)Ceiling ((double)aMapSize / aTaskSize);
+    // none of the checks in context has been performed
+    for (Standard_Integer anI = 1; anI <= aMapSize; ++anI)
+    {
+      const TopAbs_ShapeEnum aType = myMap.FindKey (anI).ShapeType();
+      if (aType == TopAbs_FACE || aType == TopAbs_EDGE || aType == TopAbs_SOLID)
+      {
+        myUncheckedShapes.Add (myMap.FindKey (anI));
+      }
+    }
+    myIsFailureFound = Standard_True;
+    return;
   }
 
-  NCollection_Array1< NCollection_Array1<TopoDS_Shape> > aArrayOfArray (0, aNbTasks - 1);
+  // collect the shapes requiring checks in context, the most expensive first
+  Standard_Integer aNbShapes = 0;
   for (Standard_Integer anI = 1; anI <= aMapSize; ++anI)
   {
-    Standard_Integer aVectIndex  = (anI-1) / aTaskSize;
-    Standard_Integer aShapeIndex = (anI-1) % aTaskSize;
-    if (aShapeIndex == 0)
+    const TopAbs_ShapeEnum aType = myMap.FindKey (anI).ShapeType();
+    if (aType == TopAbs_FACE || aType == TopAbs_EDGE || aType == TopAbs_SOLID)
     {
-      Standard_Integer aVectorSize = aTaskSize;
-      Standard_Integer aTailSize = aMapSize - aVectIndex * aTaskSize;
-      if (aTailSize < aTaskSize)
+      ++aNbShapes;
+    }
+  }
+  if (aNbShapes == 0)
+  {
+    return;
+  }
+
+  NCollection_Array1<TopoDS_Shape> aShapes (0, aNbShapes - 1);
+  Standard_Integer aShapeIndex = 0;
+  const TopAbs_ShapeEnum aTypes[3] = { TopAbs_FACE, TopAbs_EDGE, TopAbs_SOLID };
+  for (Standard_Integer aTypeIter = 0; aTypeIter < 3; ++aTypeIter)
+  {
+    for (Standard_Integer anI = 1; anI <= aMapSize; ++anI)
+    {
+      const TopoDS_Shape& aShape = myMap.FindKey (anI);
+      if (aShape.ShapeType() == aTypes[aTypeIter])
       {
-        aVectorSize = aTailSize;
+        aShapes.ChangeValue (aShapeIndex++) = aShape;
       }
-      aArrayOfArray[aVectIndex].Resize (0, aVectorSize - 1, Standard_False);
     }
-    aArrayOfArray[aVectIndex][aShapeIndex] = myMap.FindKey (anI);
   }
 
-  BRepCheck_ParallelAnalyzer aParallelAnalyzer (aArrayOfArray, myMap);
-  OSD_Parallel::For (0, aArrayOfArray.Size(), aParallelAnalyzer, !myIsParallel);
+  NCollection_Array1<Standard_Boolean> aIsChecked (0, aNbShapes - 1);
+  aIsChecked.Init (Standard_False);
+  BRepCheck_ParallelAnalyzer aParallelAnalyzer (aShapes, myMap, aIsChecked, aFailureFlagPtr);
+  OSD_Parallel::For (0, aNbShapes, aParallelAnalyzer, !myIsParallel);
+  myIsFailureFound = aFailureFlag;
+  if (myIsFailureFound)
+  {
+    for (Standard_Integer anI = 0; anI < aNbShapes; ++anI)
+    {
+      if (!aIsChecked (anI))
+      {
+        myUncheckedShapes.Add (aShapes (anI));
+      }
+    }
+  }
 }
 
 //=======================================================================
@@ -460,6 +636,14 @@ void BRepCheck_Analyzer::Perform()
 
 Standard_Boolean BRepCheck_Analyzer::IsValid(const TopoDS_Shape& S) const
 {
+  if (myIsFailureFound
+   && ((myMap.FindFromKey (S).IsNull() && S.ShapeType() > TopAbs_COMPSOLID)
+    || myUncheckedShapes.Contains (S)))
+  {
+    // the check has been cancelled on the failure of another shape
+    return Standard_False;
+  }
+
   if (!myMap.FindFromKey (S).IsNull())
   {
     BRepCheck_ListIteratorOfListOfStatus itl;
@@ -519,6 +703,10 @@ Standard_Boolean BRepCheck_Analyzer::ValidSub
   for (exp.Init(S,SubType);exp.More(); exp.Next()) {
 //  for (TopExp_Explorer exp(S,SubType);exp.More(); exp.Next()) {
     const Handle(BRepCheck_Result)& RV = myMap.FindFromKey(exp.Current());
+    if (RV.IsNull()) {
+      // not checked in the mode of stopping on the first failure
+      return Standard_False;
+    }
     for (RV->InitContextIterator();
          RV->MoreShapeInContext(); 
          RV->NextShapeInContext()) {
@@ -527,7 +715,11 @@ Standard_Boolean BRepCheck_Analyzer::ValidSub
       }
     }
 
-    if(!RV->MoreShapeInContext()) break;
+    if(!RV->MoreShapeInContext()) {
+      // the check in context may have been cancelled on the first failure
+      if (myIsFailureFound) return Standard_False;
+      break;
+    }
 
     for (itl.Initialize(RV->StatusOnShape()); itl.More(); itl.Next()) {
       if (itl.Value() != BRepCheck_NoError) {
@@ -24,6 +24,7 @@
 #include <TopoDS_Shape.hxx>
 #include <BRepCheck_IndexedDataMapOfShapeResult.hxx>
 #include <TopAbs_ShapeEnum.hxx>
+#include <TopTools_MapOfShape.hxx>
 class BRepCheck_Result;
 
 //! A framework to check the overall
@@ -56,12 +57,17 @@ public:
   //! BRepCheck_InvalidToleranceValue  NYI
   //! For a wire :
   //! BRepCheck_SelfIntersectingWire
+  //! <theIsStopOnFirstFailure> If True the check stops as soon as
+  //! the first defect is found (see SetStopOnFirstFailure()).
   BRepCheck_Analyzer (const TopoDS_Shape& S,
                       const Standard_Boolean GeomControls = Standard_True,
                       const Standard_Boolean theIsParallel = Standard_False,
-                      const Standard_Boolean theIsExact = Standard_False)
+                      const Standard_Boolean theIsExact = Standard_False,
+                      const Standard_Boolean theIsStopOnFirstFailure = Standard_False)
     : myIsParallel(theIsParallel),
-      myIsExact(theIsExact)
+      myIsExact(theIsExact),
+      myIsStopOnFirstFailure(theIsStopOnFirstFailure),
+      myIsFailureFound(Standard_False)
   {
     Init (S, GeomControls);
   }
@@ -113,9 +119,29 @@ public:
     return myIsParallel;
   }
 
+  //! Sets the mode of stopping the check on the first failure.
+  //! In this mode the remaining checks are cancelled as soon as any defect
+  //! is detected, so that IsValid() returns False without full analysis of the shape.
+  //! The results of the sub-shapes which have not been checked are left null or
+  //! incomplete, thus the mode is intended for getting the answer of IsValid() only.
+  //! Should be set before Init() to take effect.
+  void SetStopOnFirstFailure(const Standard_Boolean theToStop)
+  {
+    myIsStopOnFirstFailure = theToStop;
+  }
+
+  //! Returns true if the check stops on the first failure
+  Standard_Boolean IsStopOnFirstFailure() const
+  {
+    return myIsStopOnFirstFailure;
+  }
+
   //! <S> is a  subshape of the  original shape. Returns
   //! <STandard_True> if no default has been detected on
   //! <S> and any of its subshape.
+  //! In the mode of stopping on the first failure, once a failure has been found,
+  //! returns False also for <S> if the check of <S> or of any of its subshapes
+  //! has been cancelled, as its validity is unknown.
   Standard_EXPORT Standard_Boolean IsValid (const TopoDS_Shape& S) const;
   
   //! Returns true if no defect is
@@ -159,9 +185,12 @@ public:
   //! value coded on the edge.
   Standard_Boolean IsValid() const
   {
-    return IsValid (myShape);
+    return !myIsFailureFound && IsValid (myShape);
   }
 
+  //! Returns the result of the check of the sub-shape <theSubS>.
+  //! In the stop on first failure mode the result may be null
+  //! for the sub-shapes which have not been checked.
   const Handle(BRepCheck_Result)& Result (const TopoDS_Shape& theSubS) const
   {
     return myMap.FindFromKey (theSubS);
@@ -169,10 +198,9 @@ public:
 
 private:
 
-  Standard_EXPORT void Put (const TopoDS_Shape& S,
-                            const Standard_Boolean Gctrl);
+  Standard_EXPORT void Put (const TopoDS_Shape& S);
 
-  Standard_EXPORT void Perform();
+  Standard_EXPORT void Perform (const Standard_Boolean theGeomControls);
 
   Standard_EXPORT Standard_Boolean ValidSub (const TopoDS_Shape& S, const TopAbs_ShapeEnum SubType) const;
 
@@ -182,6 +210,9 @@ private:
   BRepCheck_IndexedDataMapOfShapeResult myMap;
   Standard_Boolean myIsParallel;
   Standard_Boolean myIsExact;
+  Standard_Boolean myIsStopOnFirstFailure;
+  Standard_Boolean myIsFailureFound;
+  TopTools_MapOfShape myUncheckedShapes; //!< shapes with the checks in context cancelled on the first failure
 
 };
 
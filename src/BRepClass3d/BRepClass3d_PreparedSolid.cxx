@@ -0,0 +1,517 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepClass3d_PreparedSolid.hxx>
+
+#include <BRep_Tool.hxx>
+#include <BRepClass3d_SClassifier.hxx>
+#include <BVH_Distance.hxx>
+#include <BVH_Tools.hxx>
+#include <BVH_Traverse.hxx>
+#include <NCollection_DataMap.hxx>
+#include <OSD_ThreadPool.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Standard_DimensionMismatch.hxx>
+#include <TColgp_HArray1OfPnt.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepClass3d_PreparedSolid, Standard_Transient)
+
+namespace
+{
+  //! Directions of rays used by the coarse test.
+  //! The next direction is used if the ray passes too close to an edge of triangle.
+  static const Standard_Real THE_RAY_DIRS[3][3] =
+  {
+    {  0.2715052, 0.5820940,  0.7664873 },
+    { -0.6613622, 0.3528929, -0.6618540 },
+    {  0.4472136, -0.8164966, 0.3651484 }
+  };
+
+  //! Relative tolerance of barycentric coordinates defining the ambiguous hits.
+  static const Standard_Real THE_BARY_EPS = 1.e-9;
+
+  //! Map of edges to the nodes of their polygons on triangulation.
+  typedef NCollection_DataMap<TopoDS_Shape, Handle(TColgp_HArray1OfPnt), TopTools_ShapeMapHasher> EdgePolygonsMap;
+
+  //! Checks that the polygon of the edge on the triangulation of the face matches
+  //! the polygon on the other face sharing the edge, so that the triangulations
+  //! of these faces are connected along the edge.
+  //! @param theEdge          [in] edge oriented as in the face
+  //! @param theTriangulation [in] triangulation of the face
+  //! @param theLoc           [in] location of the triangulation
+  //! @param thePolygons      [in/out] polygons of the edges met before
+  //! @return FALSE if the polygon is missing or does not match the other one
+  static Standard_Boolean checkEdgePolygon (const TopoDS_Edge&                theEdge,
+                                            const Handle(Poly_Triangulation)& theTriangulation,
+                                            const TopLoc_Location&            theLoc,
+                                            EdgePolygonsMap&                  thePolygons)
+  {
+    const Handle(Poly_PolygonOnTriangulation)& aPolygon =
+      BRep_Tool::PolygonOnTriangulation (theEdge, theTriangulation, theLoc);
+    if (aPolygon.IsNull())
+    {
+      return Standard_False;
+    }
+
+    const gp_Trsf& aTrsf = theLoc.Transformation();
+    Handle(TColgp_HArray1OfPnt) aNodes = new TColgp_HArray1OfPnt (1, aPolygon->NbNodes());
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aPolygon->NbNodes(); ++aNodeIt)
+    {
+      aNodes->SetValue (aNodeIt, theTriangulation->Node (aPolygon->Node (aNodeIt)).Transformed (aTrsf));
+    }
+
+    Handle(TColgp_HArray1OfPnt) anOtherNodes;
+    if (!thePolygons.Find (theEdge, anOtherNodes))
+    {
+      thePolygons.Bind (theEdge, aNodes);
+      return Standard_True;
+    }
+
+    // both polygons follow the parametrization of the edge
+    if (anOtherNodes->Length() != aNodes->Length())
+    {
+      return Standard_False;
+    }
+    const Standard_Real aTol = BRep_Tool::Tolerance (theEdge) + Precision::Confusion();
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aNodes->Length(); ++aNodeIt)
+    {
+      if (aNodes->Value (aNodeIt).SquareDistance (anOtherNodes->Value (aNodeIt)) > aTol * aTol)
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //! Searches a triangle closer to the point than the given distance.
+  class PointNearTriangles : public BVH_Distance<Standard_Real, 3, BVH_Vec3d, BRepClass3d_PreparedSolid::TriangleSet>
+  {
+  public:
+
+    PointNearTriangles (const Standard_Real theSqDistance)
+    : myIsNear (Standard_False)
+    {
+      myDistance = theSqDistance;
+    }
+
+    //! Returns true if some triangle is within the distance.
+    Standard_Boolean IsNear()
+    {
+      Select();
+      return myIsNear;
+    }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real&   theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools<Standard_Real, 3>::PointBoxSquareDistance (myObject, theCMin, theCMax);
+      return RejectMetric (theMetric);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      const BRepClass3d_PreparedSolid::Triangle aTri = myBVHSet->Element (theIndex);
+      const Standard_Real aSqDist = BVH_Tools<Standard_Real, 3>::PointTriangleSquareDistance (myObject,
+                                      aTri.Nodes[0], aTri.Nodes[1], aTri.Nodes[2]);
+      if (aSqDist < myDistance)
+      {
+        myDistance = aSqDist;
+        myIsNear   = Standard_True;
+        return Standard_True;
+      }
+      return Standard_False;
+    }
+
+    //! Any triangle within the distance is enough.
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE
+    {
+      return myIsNear;
+    }
+
+  private:
+    Standard_Boolean myIsNear;
+  };
+
+  //! Counts intersections of the ray with the triangles.
+  class RayTriangles : public BVH_Traverse<Standard_Real, 3, BRepClass3d_PreparedSolid::TriangleSet>
+  {
+  public:
+
+    RayTriangles (const BVH_Vec3d& theOrigin,
+                  const BVH_Vec3d& theDirection)
+    : myOrigin (theOrigin),
+      myDirection (theDirection),
+      myNbHits (0),
+      myIsAmbiguous (Standard_False)
+    {
+    }
+
+    //! Returns number of intersections.
+    Standard_Integer NbHits() const { return myNbHits; }
+
+    //! Returns true if the ray passes too close to an edge of some triangle.
+    Standard_Boolean IsAmbiguous() const { return myIsAmbiguous; }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCMin,
+                                         const BVH_Vec3d& theCMax,
+                                         Standard_Real&   theMetric) const Standard_OVERRIDE
+    {
+      Standard_Real aTimeLeave = 0.0;
+      return !BVH_Tools<Standard_Real, 3>::RayBoxIntersection (myOrigin, myDirection, theCMin, theCMax, theMetric, aTimeLeave)
+           || aTimeLeave < 0.0;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex,
+                                     const Standard_Real&) Standard_OVERRIDE
+    {
+      // Moller-Trumbore intersection test
+      const BRepClass3d_PreparedSolid::Triangle aTri = myBVHSet->Element (theIndex);
+      const BVH_Vec3d anEdge1 = aTri.Nodes[1] - aTri.Nodes[0];
+      const BVH_Vec3d anEdge2 = aTri.Nodes[2] - aTri.Nodes[0];
+      const BVH_Vec3d aPVec   = BVH_Vec3d::Cross (myDirection, anEdge2);
+      const Standard_Real aDet = anEdge1.Dot (aPVec);
+      if (Abs (aDet) <= THE_BARY_EPS * anEdge1.Modulus() * anEdge2.Modulus())
+      {
+        // the ray is parallel to the triangle plane
+        const Standard_Real aPlaneDist = BVH_Vec3d::Cross (anEdge1, anEdge2).Dot (myOrigin - aTri.Nodes[0]);
+        if (Abs (aPlaneDist) <= THE_BARY_EPS * anEdge1.SquareModulus() * anEdge2.Modulus())
+        {
+          myIsAmbiguous = Standard_True;
+        }
+        return Standard_False;
+      }
+
+      const Standard_Real anInvDet = 1.0 / aDet;
+      const BVH_Vec3d aTVec = myOrigin - aTri.Nodes[0];
+      const Standard_Real aU = aTVec.Dot (aPVec) * anInvDet;
+      if (aU < -THE_BARY_EPS || aU > 1.0 + THE_BARY_EPS)
+      {
+        return Standard_False;
+      }
+
+      const BVH_Vec3d aQVec = BVH_Vec3d::Cross (aTVec, anEdge1);
+      const Standard_Real aV = myDirection.Dot (aQVec) * anInvDet;
+      if (aV < -THE_BARY_EPS || aU + aV > 1.0 + THE_BARY_EPS)
+      {
+        return Standard_False;
+      }
+
+      if (anEdge2.Dot (aQVec) * anInvDet <= 0.0)
+      {
+        return Standard_False;
+      }
+
+      if (aU < THE_BARY_EPS || aV < THE_BARY_EPS || aU + aV > 1.0 - THE_BARY_EPS)
+      {
+        myIsAmbiguous = Standard_True;
+        return Standard_False;
+      }
+
+      ++myNbHits;
+      return Standard_True;
+    }
+
+    virtual Standard_Boolean Stop() const Standard_OVERRIDE
+    {
+      return myIsAmbiguous;
+    }
+
+  private:
+    BVH_Vec3d        myOrigin;
+    BVH_Vec3d        myDirection;
+    Standard_Integer myNbHits;
+    Standard_Boolean myIsAmbiguous;
+  };
+}
+
+//=======================================================================
+//class   : ClassifyFunctor
+//purpose : Classifies the points of the batch
+//=======================================================================
+class BRepClass3d_PreparedSolid::ClassifyFunctor
+{
+public:
+  ClassifyFunctor (BRepClass3d_PreparedSolid&        theSolid,
+                   const TColgp_Array1OfPnt&         thePoints,
+                   NCollection_Array1<TopAbs_State>& theStates)
+  : mySolid (theSolid),
+    myPoints (thePoints),
+    myStates (theStates)
+  {
+  }
+
+  void operator() (Standard_Integer theThreadIndex, Standard_Integer theIndex) const
+  {
+    const gp_Pnt& aPnt = myPoints.Value (theIndex);
+    TopAbs_State aState = mySolid.coarseState (aPnt);
+    if (aState == TopAbs_UNKNOWN)
+    {
+      aState = mySolid.exactState (theThreadIndex, aPnt);
+    }
+    myStates.ChangeValue (myStates.Lower() + theIndex - myPoints.Lower()) = aState;
+  }
+
+private:
+  ClassifyFunctor& operator= (const ClassifyFunctor&) Standard_DELETE;
+
+private:
+  BRepClass3d_PreparedSolid&        mySolid;
+  const TColgp_Array1OfPnt&         myPoints;
+  NCollection_Array1<TopAbs_State>& myStates;
+};
+
+//=======================================================================
+//function : BRepClass3d_PreparedSolid
+//purpose  :
+//=======================================================================
+BRepClass3d_PreparedSolid::BRepClass3d_PreparedSolid (const TopoDS_Shape& theShape,
+                                                      const Standard_Real theTolerance)
+: myShape (theShape),
+  myTolerance (theTolerance),
+  myMargin (0.0),
+  myIsInfinite (Standard_False),
+  myExplorers (0, Max (OSD_ThreadPool::DefaultPool()->NbThreads(), 1) - 1)
+{
+  prepareMesh();
+}
+
+//=======================================================================
+//function : ~BRepClass3d_PreparedSolid
+//purpose  :
+//=======================================================================
+BRepClass3d_PreparedSolid::~BRepClass3d_PreparedSolid()
+{
+  //
+}
+
+//=======================================================================
+//function : prepareMesh
+//purpose  :
+//=======================================================================
+void BRepClass3d_PreparedSolid::prepareMesh()
+{
+  // The parity of ray intersections makes sense for closed boundary only
+  TopTools_IndexedDataMapOfShapeListOfShape anEdgeFaces;
+  TopExp::MapShapesAndAncestors (myShape, TopAbs_EDGE, TopAbs_FACE, anEdgeFaces);
+  if (anEdgeFaces.IsEmpty())
+  {
+    return;
+  }
+
+  Standard_Real aMaxTol = 0.0;
+  for (Standard_Integer anEdgeIt = 1; anEdgeIt <= anEdgeFaces.Extent(); ++anEdgeIt)
+  {
+    const TopoDS_Edge& anEdge = TopoDS::Edge (anEdgeFaces.FindKey (anEdgeIt));
+    if (anEdge.Orientation() == TopAbs_INTERNAL
+     || anEdge.Orientation() == TopAbs_EXTERNAL)
+    {
+      return;
+    }
+    if (!BRep_Tool::Degenerated (anEdge)
+      && anEdgeFaces.FindFromIndex (anEdgeIt).Extent() != 2)
+    {
+      return;
+    }
+    aMaxTol = Max (aMaxTol, BRep_Tool::Tolerance (anEdge));
+  }
+  for (TopExp_Explorer aVertexIt (myShape, TopAbs_VERTEX); aVertexIt.More(); aVertexIt.Next())
+  {
+    aMaxTol = Max (aMaxTol, BRep_Tool::Tolerance (TopoDS::Vertex (aVertexIt.Current())));
+  }
+
+  opencascade::handle<TriangleSet> aTriangles = new TriangleSet();
+  EdgePolygonsMap anEdgePolygons;
+  Standard_Real aMaxDeflection = 0.0;
+  Standard_Real aVolume = 0.0;
+  for (TopExp_Explorer aFaceIt (myShape, TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (aFaceIt.Current());
+    if (aFace.Orientation() != TopAbs_FORWARD
+     && aFace.Orientation() != TopAbs_REVERSED)
+    {
+      return;
+    }
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTriangulation.IsNull()
+     || aTriangulation->NbTriangles() == 0
+     || aTriangulation->Deflection() <= 0.0)
+    {
+      // deflection of the triangulation should be known to define the margin
+      return;
+    }
+
+    // the triangulations of adjacent faces should be connected along the shared edges,
+    // otherwise the ray may pass through a gap between them
+    for (TopExp_Explorer anEdgeIt (aFace, TopAbs_EDGE); anEdgeIt.More(); anEdgeIt.Next())
+    {
+      const TopoDS_Edge& anEdge = TopoDS::Edge (anEdgeIt.Current());
+      if (!BRep_Tool::Degenerated (anEdge)
+       && !checkEdgePolygon (anEdge, aTriangulation, aLoc, anEdgePolygons))
+      {
+        return;
+      }
+    }
+
+    aMaxDeflection = Max (aMaxDeflection, aTriangulation->Deflection());
+    aMaxTol        = Max (aMaxTol, BRep_Tool::Tolerance (aFace));
+
+    const Standard_Boolean isReversed = aFace.Orientation() == TopAbs_REVERSED;
+    const gp_Trsf& aTrsf = aLoc.Transformation();
+    for (Standard_Integer aTriIt = 1; aTriIt <= aTriangulation->NbTriangles(); ++aTriIt)
+    {
+      Standard_Integer aNodes[3];
+      aTriangulation->Triangle (aTriIt).Get (aNodes[0], aNodes[1], aNodes[2]);
+      if (isReversed)
+      {
+        std::swap (aNodes[1], aNodes[2]);
+      }
+
+      Triangle aTri;
+      BVH_Box<Standard_Real, 3> aBox;
+      for (Standard_Integer aNodeIt = 0; aNodeIt < 3; ++aNodeIt)
+      {
+        const gp_Pnt aPnt = aTriangulation->Node (aNodes[aNodeIt]).Transformed (aTrsf);
+        aTri.Nodes[aNodeIt] = BVH_Vec3d (aPnt.X(), aPnt.Y(), aPnt.Z());
+        aBox.Add (aTri.Nodes[aNodeIt]);
+        myMeshBox.Add (aPnt);
+      }
+      aTriangles->Add (aTri, aBox);
+
+      aVolume += aTri.Nodes[0].Dot (BVH_Vec3d::Cross (aTri.Nodes[1], aTri.Nodes[2]));
+    }
+  }
+
+  aTriangles->Build();
+
+  // deflection is measured at the limited set of points, thus it is doubled for safety
+  myMargin     = 2.0 * aMaxDeflection + aMaxTol + myTolerance;
+  myIsInfinite = aVolume < 0.0;
+  myMeshBox.Enlarge (myMargin);
+  myTriangles  = aTriangles;
+}
+
+//=======================================================================
+//function : coarseState
+//purpose  :
+//=======================================================================
+TopAbs_State BRepClass3d_PreparedSolid::coarseState (const gp_Pnt& thePoint) const
+{
+  if (myTriangles.IsNull())
+  {
+    return TopAbs_UNKNOWN;
+  }
+
+  if (myMeshBox.IsOut (thePoint))
+  {
+    return myIsInfinite ? TopAbs_IN : TopAbs_OUT;
+  }
+
+  const BVH_Vec3d anOrigin (thePoint.X(), thePoint.Y(), thePoint.Z());
+  PointNearTriangles aNearTool (myMargin * myMargin);
+  aNearTool.SetObject (anOrigin);
+  aNearTool.SetBVHSet (myTriangles.get());
+  if (aNearTool.IsNear())
+  {
+    return TopAbs_UNKNOWN;
+  }
+
+  for (Standard_Integer aDirIt = 0; aDirIt < 3; ++aDirIt)
+  {
+    RayTriangles aRayTool (anOrigin, BVH_Vec3d (THE_RAY_DIRS[aDirIt][0],
+                                                THE_RAY_DIRS[aDirIt][1],
+                                                THE_RAY_DIRS[aDirIt][2]));
+    aRayTool.SetBVHSet (myTriangles.get());
+    aRayTool.Select();
+    if (!aRayTool.IsAmbiguous())
+    {
+      const Standard_Boolean isIn = (aRayTool.NbHits() % 2 == 1) != myIsInfinite;
+      return isIn ? TopAbs_IN : TopAbs_OUT;
+    }
+  }
+  return TopAbs_UNKNOWN;
+}
+
+//=======================================================================
+//function : exactState
+//purpose  :
+//=======================================================================
+TopAbs_State BRepClass3d_PreparedSolid::exactState (const Standard_Integer theThreadIndex,
+                                                    const gp_Pnt&          thePoint)
+{
+  BRepClass3d_SolidExplorer& anExplorer = myExplorers.ChangeValue (theThreadIndex);
+  if (anExplorer.GetShape().IsNull())
+  {
+    anExplorer.InitShape (myShape);
+  }
+
+  BRepClass3d_SClassifier aClassifier;
+  aClassifier.Perform (anExplorer, thePoint, myTolerance);
+  return aClassifier.State();
+}
+
+//=======================================================================
+//function : Classify
+//purpose  :
+//=======================================================================
+TopAbs_State BRepClass3d_PreparedSolid::Classify (const gp_Pnt& thePoint)
+{
+  const TopAbs_State aState = coarseState (thePoint);
+  return aState != TopAbs_UNKNOWN
+       ? aState
+       : exactState (0, thePoint);
+}
+
+//=======================================================================
+//function : Classify
+//purpose  :
+//=======================================================================
+void BRepClass3d_PreparedSolid::Classify (const TColgp_Array1OfPnt&         thePoints,
+                                          NCollection_Array1<TopAbs_State>& theStates,
+                                          const Standard_Boolean            theToRunParallel)
+{
+  if (theStates.Length() != thePoints.Length())
+  {
+    throw Standard_DimensionMismatch ("BRepClass3d_PreparedSolid::Classify() - arrays of different size");
+  }
+  if (thePoints.IsEmpty())
+  {
+    return;
+  }
+
+  ClassifyFunctor aFunctor (*this, thePoints, theStates);
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = theToRunParallel
+                                    ? Min (Min (thePoints.Length(), aThreadPool->NbDefaultThreadsToLaunch()), myExplorers.Length())
+                                    : 1;
+  if (aNbThreads > 1)
+  {
+    OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+    aLauncher.Perform (thePoints.Lower(), thePoints.Upper() + 1, aFunctor);
+  }
+  else
+  {
+    for (Standard_Integer aPntIt = thePoints.Lower(); aPntIt <= thePoints.Upper(); ++aPntIt)
+    {
+      aFunctor (0, aPntIt);
+    }
+  }
+}
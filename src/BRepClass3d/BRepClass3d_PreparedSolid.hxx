@@ -0,0 +1,134 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepClass3d_PreparedSolid_HeaderFile
+#define _BRepClass3d_PreparedSolid_HeaderFile
+
+#include <BRepClass3d_SolidExplorer.hxx>
+#include <BVH_BoxSet.hxx>
+#include <NCollection_Array1.hxx>
+#include <Precision.hxx>
+#include <Standard_Transient.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TopAbs_State.hxx>
+#include <TopoDS_Shape.hxx>
+
+//! Solid prepared for classification of large number of points.
+//!
+//! The exact classification is performed by BRepClass3d_SClassifier using
+//! explorers of the solid which are built once (one per thread) and reused
+//! by all queries, so that the trees of bounding boxes of its faces, edges
+//! and vertices are not rebuilt for each point.
+//!
+//! If all faces of the solid have triangulations (e.g. built by BRepMesh_IncrementalMesh),
+//! the solid is closed (each edge is shared by exactly two faces) and the triangulations
+//! of adjacent faces are connected (the polygons of each shared edge on both faces
+//! coincide), the tree of the triangles is built in addition and used for the coarse test:
+//! the point located farther than Margin() from the triangulation is classified by the parity
+//! of the number of intersections of a ray with the triangles. Otherwise all points are
+//! classified exactly. The points within the margin, as well as the points for which
+//! the ray passes too close to the edges of triangles, are classified exactly too.
+//!
+//! The margin is computed from the deflection stored in the triangulations
+//! (Poly_Triangulation::Deflection()), the tolerances of the sub-shapes and the classification
+//! tolerance. The result of the coarse test is thus as reliable as the stored deflection:
+//! it may differ from the exact one for the triangulation which deviates from the surface
+//! more than declared (e.g. the mesh of modified geometry or imported mesh).
+//! The triangulation should be rebuilt or removed in such cases.
+//!
+//! The single-point Classify() uses the data of the first thread, so it should not be
+//! called concurrently with other classification by the same object; the batch Classify()
+//! should be used for parallel classification.
+class BRepClass3d_PreparedSolid : public Standard_Transient
+{
+public:
+
+  //! Triangle of the triangulation of the solid.
+  struct Triangle
+  {
+    BVH_Vec3d Nodes[3];
+  };
+
+  //! Set of triangles with the tree of their bounding boxes.
+  typedef BVH_BoxSet<Standard_Real, 3, Triangle> TriangleSet;
+
+public:
+
+  //! Prepares the shape for classification.
+  //! @param theShape     solid to classify the points in
+  //! @param theTolerance tolerance of classification (points within it from the boundary are ON)
+  Standard_EXPORT BRepClass3d_PreparedSolid (const TopoDS_Shape& theShape,
+                                             const Standard_Real theTolerance = Precision::Confusion());
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepClass3d_PreparedSolid();
+
+  //! Returns the classified shape.
+  const TopoDS_Shape& Shape() const { return myShape; }
+
+  //! Returns the tolerance of classification.
+  Standard_Real Tolerance() const { return myTolerance; }
+
+  //! Returns true if the coarse test on the triangulation is used.
+  Standard_Boolean HasCoarseTest() const { return !myTriangles.IsNull(); }
+
+  //! Returns the distance from the triangulation beyond which the coarse test is trusted.
+  Standard_Real Margin() const { return myMargin; }
+
+  //! Classifies the point.
+  //! Not thread-safe: should not be called concurrently with other classification by this object.
+  Standard_EXPORT TopAbs_State Classify (const gp_Pnt& thePoint);
+
+  //! Classifies the points.
+  //! Should not be called concurrently with other classification by this object.
+  //! @param thePoints        [in]  points to be classified
+  //! @param theStates        [out] states of the points, the array should have the same length
+  //! @param theToRunParallel [in]  flag to classify the points in parallel
+  Standard_EXPORT void Classify (const TColgp_Array1OfPnt&         thePoints,
+                                 NCollection_Array1<TopAbs_State>& theStates,
+                                 const Standard_Boolean            theToRunParallel = Standard_True);
+
+  DEFINE_STANDARD_RTTIEXT(BRepClass3d_PreparedSolid, Standard_Transient)
+
+protected:
+
+  //! Builds the tree of triangles if the shape allows the coarse test.
+  Standard_EXPORT void prepareMesh();
+
+  //! Classifies the point by the triangulation.
+  //! Returns TopAbs_UNKNOWN if the point should be classified exactly.
+  Standard_EXPORT TopAbs_State coarseState (const gp_Pnt& thePoint) const;
+
+  //! Classifies the point using explorer of the given thread.
+  Standard_EXPORT TopAbs_State exactState (const Standard_Integer theThreadIndex,
+                                           const gp_Pnt&          thePoint);
+
+private:
+
+  //! Functor for parallel classification.
+  class ClassifyFunctor;
+
+private:
+
+  TopoDS_Shape                                  myShape;
+  Standard_Real                                 myTolerance;
+  Standard_Real                                 myMargin;
+  Bnd_Box                                       myMeshBox;
+  opencascade::handle<TriangleSet>              myTriangles;
+  Standard_Boolean                              myIsInfinite;
+  NCollection_Array1<BRepClass3d_SolidExplorer> myExplorers;
+};
+
+DEFINE_STANDARD_HANDLE(BRepClass3d_PreparedSolid, Standard_Transient)
+
+#endif
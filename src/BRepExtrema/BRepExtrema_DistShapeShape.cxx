@@ -33,11 +33,15 @@
 #include <BRepExtrema_UnCompatibleShape.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepClass3d_SolidClassifier.hxx>
+#include <BVH_LinearBuilder.hxx>
+#include <BVH_PairDistance.hxx>
 #include <NCollection_Vector.hxx>
 #include <OSD_Parallel.hxx>
+#include <Poly_Triangulation.hxx>
 #include <StdFail_NotDone.hxx>
 
 #include <algorithm>
+#include <atomic>
 namespace
 {
 
@@ -65,6 +69,110 @@ namespace
     }
   }
 
+  template <class BoxTree>
+  static void TreeCalculation(const TopTools_IndexedMapOfShape& Map,
+                              const Bnd_Array1OfBox&            SBox,
+                              Handle(BoxTree)&                  theTree)
+  {
+    theTree = new BoxTree (new BVH_LinearBuilder<Standard_Real, 3>());
+    theTree->SetSize (Map.Extent());
+    for (Standard_Integer i = 1; i <= Map.Extent(); i++)
+    {
+      const Bnd_Box& aBox = SBox[i];
+      if (aBox.IsVoid())
+      {
+        continue;
+      }
+      Standard_Real aXMin, aYMin, aZMin, aXMax, aYMax, aZMax;
+      aBox.Get (aXMin, aYMin, aZMin, aXMax, aYMax, aZMax);
+      theTree->Add (i, BVH_Box<Standard_Real, 3> (BVH_Vec3d (aXMin, aYMin, aZMin),
+                                                   BVH_Vec3d (aXMax, aYMax, aZMax)));
+    }
+    theTree->Build();
+  }
+
+  //! Returns true if the triangulations of the faces differ from the ones
+  //! the set of triangles has been built on.
+  static Standard_Boolean IsMeshOutdated (const TopTools_IndexedMapOfShape&                    MapF,
+                                          const NCollection_Vector<Handle(Poly_Triangulation)>& theTriangulations)
+  {
+    if (theTriangulations.Size() != MapF.Extent())
+    {
+      return Standard_True;
+    }
+    for (Standard_Integer i = 1; i <= MapF.Extent(); i++)
+    {
+      TopLoc_Location aLoc;
+      if (BRep_Tool::Triangulation (TopoDS::Face (MapF(i)), aLoc) != theTriangulations.Value (i - 1))
+      {
+        return Standard_True;
+      }
+    }
+    return Standard_False;
+  }
+
+  //! Fills the indices of the faces containing each sub-shape of the map
+  //! of the given type; the faces contain themselves.
+  static void FaceAncestors(const TopTools_IndexedMapOfShape&           Map,
+                            const TopAbs_ShapeEnum                      theType,
+                            const TopTools_IndexedMapOfShape&           MapF,
+                            NCollection_Vector<TColStd_ListOfInteger>& theFaces)
+  {
+    theFaces.Clear();
+    for (Standard_Integer i = 1; i <= Map.Extent(); i++)
+    {
+      theFaces.Appended();
+    }
+    for (Standard_Integer i = 1; i <= MapF.Extent(); i++)
+    {
+      if (theType == TopAbs_FACE)
+      {
+        theFaces.ChangeValue (i - 1).Append (i);
+        continue;
+      }
+      TopTools_IndexedMapOfShape aSubShapes;
+      TopExp::MapShapes (MapF(i), theType, aSubShapes);
+      for (Standard_Integer j = 1; j <= aSubShapes.Extent(); j++)
+      {
+        const Standard_Integer anIndex = Map.FindIndex (aSubShapes(j));
+        if (anIndex > 0)
+        {
+          theFaces.ChangeValue (anIndex - 1).Append (i);
+        }
+      }
+    }
+  }
+
+  static void MeshCalculation(const TopTools_IndexedMapOfShape&                MapF,
+                              Handle(BRepExtrema_TriangleSet)&                 theMesh,
+                              NCollection_Vector<Handle(Poly_Triangulation)>& theTriangulations,
+                              NCollection_Vector<Standard_Integer>&            theMeshFaces,
+                              Standard_Real&                                   theDeflection)
+  {
+    theMesh.Nullify();
+    theTriangulations.Clear();
+    theMeshFaces.Clear();
+    theDeflection = 0.0;
+    BRepExtrema_ShapeList aFaces;
+    for (Standard_Integer i = 1; i <= MapF.Extent(); i++)
+    {
+      TopLoc_Location aLoc;
+      const TopoDS_Face& aFace = TopoDS::Face (MapF(i));
+      const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+      theTriangulations.Append (aTriangulation);
+      if (!aTriangulation.IsNull() && aTriangulation->NbTriangles() > 0)
+      {
+        aFaces.Append (aFace);
+        theMeshFaces.Append (i);
+        theDeflection = Max (theDeflection, aTriangulation->Deflection());
+      }
+    }
+    if (!aFaces.IsEmpty())
+    {
+      theMesh = new BRepExtrema_TriangleSet (aFaces);
+    }
+  }
+
   inline Standard_Real DistanceInitiale(const TopoDS_Vertex V1,
                                         const TopoDS_Vertex V2)
   {
@@ -96,11 +204,335 @@ namespace
   };
 
   // Used by std::sort function
+  // (pairs with equal distances are ordered by indices of sub-shapes
+  // to make the order independent of the way the pairs are collected)
   static Standard_Boolean BRepExtrema_CheckPair_Comparator (const BRepExtrema_CheckPair& theLeft,
                                                             const BRepExtrema_CheckPair& theRight)
   {
-    return (theLeft.Distance < theRight.Distance);
+    if (theLeft.Distance != theRight.Distance)
+    {
+      return (theLeft.Distance < theRight.Distance);
+    }
+    if (theLeft.Index1 != theRight.Index1)
+    {
+      return (theLeft.Index1 < theRight.Index1);
+    }
+    return (theLeft.Index2 < theRight.Index2);
   }
+
+  //! Set of bounding boxes of sub-shapes.
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> BRepExtrema_BoxTree;
+
+  //! Lower bounds of the distances between the pairs of faces computed
+  //! on their triangulations, see BRepExtrema_MeshPairBound.
+  //! As the distance between two sub-shapes is not less than the distance
+  //! between any faces containing them, the bounds of the pairs of faces
+  //! are applied to the pairs of their vertices and edges as well.
+  struct BRepExtrema_FacePairBounds
+  {
+    //! Bounds for the pairs of faces (indexed by the face of the first shape).
+    const NCollection_DataMap<Standard_Integer, TColStd_DataMapOfIntegerReal>* Bounds;
+    //! Triangulations of the faces of the first shape (null for the faces without triangulation).
+    const NCollection_Vector<Handle(Poly_Triangulation)>* Triangulations1;
+    //! Triangulations of the faces of the second shape (null for the faces without triangulation).
+    const NCollection_Vector<Handle(Poly_Triangulation)>* Triangulations2;
+    //! Faces of the first shape containing each sub-shape of the first map.
+    const NCollection_Vector<TColStd_ListOfInteger>* Faces1;
+    //! Faces of the second shape containing each sub-shape of the second map.
+    const NCollection_Vector<TColStd_ListOfInteger>* Faces2;
+
+    //! Raises theBound up to the lower bound of the distance between the sub-shapes.
+    //! Returns false if the faces containing the sub-shapes are farther than the
+    //! reference distance the bounds have been computed for.
+    Standard_Boolean LowerBound (const Standard_Integer theIndex1,
+                                 const Standard_Integer theIndex2,
+                                 Standard_Real&         theBound) const
+    {
+      for (TColStd_ListIteratorOfListOfInteger anIt1 (Faces1->Value (theIndex1 - 1)); anIt1.More(); anIt1.Next())
+      {
+        const Standard_Integer aFace1 = anIt1.Value();
+        if (!isMeshed (Triangulations1->Value (aFace1 - 1)))
+        {
+          continue;
+        }
+        const TColStd_DataMapOfIntegerReal* aBounds = Bounds->Seek (aFace1);
+        for (TColStd_ListIteratorOfListOfInteger anIt2 (Faces2->Value (theIndex2 - 1)); anIt2.More(); anIt2.Next())
+        {
+          const Standard_Integer aFace2 = anIt2.Value();
+          if (!isMeshed (Triangulations2->Value (aFace2 - 1)))
+          {
+            continue;
+          }
+          // the pairs of faces which triangulations are farther
+          // than the reference distance have no bound
+          const Standard_Real* aBound = aBounds != NULL ? aBounds->Seek (aFace2) : NULL;
+          if (aBound == NULL)
+          {
+            return Standard_False;
+          }
+          theBound = Max (theBound, *aBound);
+        }
+      }
+      return Standard_True;
+    }
+
+    //! Returns true if the face is present in the set of triangles.
+    static Standard_Boolean isMeshed (const Handle(Poly_Triangulation)& theTriangulation)
+    {
+      return !theTriangulation.IsNull() && theTriangulation->NbTriangles() > 0;
+    }
+  };
+
+  //! Selects the pairs of sub-shapes which bounding boxes are closer
+  //! than the reference distance by simultaneous descent of the BVH trees
+  //! of the boxes of both shapes. For the sub-shapes lying on the faces
+  //! having the triangulations, the lower bound of the distance is refined
+  //! by the bounds computed on the triangulations.
+  class BRepExtrema_BoxPairSelector :
+    public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_BoxTree, Standard_Real>
+  {
+  public:
+
+    BRepExtrema_BoxPairSelector (const Bnd_Array1OfBox&                     theLBox1,
+                                 const Bnd_Array1OfBox&                     theLBox2,
+                                 const BRepExtrema_FacePairBounds*          theMeshBounds,
+                                 const Standard_Real                        theDistRef,
+                                 const Standard_Real                        theEps,
+                                 NCollection_Vector<BRepExtrema_CheckPair>& thePairs)
+    : myLBox1 (theLBox1),
+      myLBox2 (theLBox2),
+      myMeshBounds (theMeshBounds),
+      myDistRef (theDistRef),
+      myEps (theEps),
+      mySqLimit ((theDistRef + theEps) * (theDistRef + theEps)),
+      myPairs (thePairs)
+    {
+    }
+
+    //! Rejects the pairs of nodes which boxes are farther than the reference distance.
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCornerMin1,
+                                         const BVH_Vec3d& theCornerMax1,
+                                         const BVH_Vec3d& theCornerMin2,
+                                         const BVH_Vec3d& theCornerMax2,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance (theCornerMin1, theCornerMax1,
+                                                                     theCornerMin2, theCornerMax2);
+      return theMetric > mySqLimit;
+    }
+
+    //! Accepts the pair of sub-shapes if their boxes are close enough.
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      const Standard_Integer anIdx1 = myBVHSet1->Element (theIndex1);
+      const Standard_Integer anIdx2 = myBVHSet2->Element (theIndex2);
+      Standard_Real aDist = myLBox1.Value (anIdx1).Distance (myLBox2.Value (anIdx2));
+      if (myMeshBounds != NULL && !myMeshBounds->LowerBound (anIdx1, anIdx2, aDist))
+      {
+        return Standard_False;
+      }
+      if (aDist - myDistRef < myEps)
+      {
+        myPairs.Append (BRepExtrema_CheckPair (anIdx1, anIdx2, aDist));
+        return Standard_True;
+      }
+      return Standard_False;
+    }
+
+  private:
+    const Bnd_Array1OfBox& myLBox1;
+    const Bnd_Array1OfBox& myLBox2;
+    const BRepExtrema_FacePairBounds* myMeshBounds;
+    Standard_Real myDistRef;
+    Standard_Real myEps;
+    Standard_Real mySqLimit;
+    NCollection_Vector<BRepExtrema_CheckPair>& myPairs;
+  };
+
+  //! Searches the closest pairs of vertices of two shapes by simultaneous
+  //! descent of the BVH trees of their boxes, tightening the bound for
+  //! the descent by each found distance.
+  class BRepExtrema_VertexPairSelector :
+    public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_BoxTree, Standard_Real>
+  {
+  public:
+
+    BRepExtrema_VertexPairSelector (const TopTools_IndexedMapOfShape& theMap1,
+                                    const TopTools_IndexedMapOfShape& theMap2,
+                                    const Standard_Real               theEps,
+                                    Standard_Real&                    theDist,
+                                    BRepExtrema_SeqOfSolution&        theSolutions1,
+                                    BRepExtrema_SeqOfSolution&        theSolutions2)
+    : myMap1 (theMap1),
+      myMap2 (theMap2),
+      myEps (theEps),
+      myDist (theDist),
+      mySolutions1 (theSolutions1),
+      mySolutions2 (theSolutions2)
+    {
+    }
+
+    virtual Standard_Boolean IsMetricBetter (const Standard_Real& theLeft,
+                                             const Standard_Real& theRight) const Standard_OVERRIDE
+    {
+      return theLeft < theRight;
+    }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCornerMin1,
+                                         const BVH_Vec3d& theCornerMax1,
+                                         const BVH_Vec3d& theCornerMin2,
+                                         const BVH_Vec3d& theCornerMax2,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance (theCornerMin1, theCornerMax1,
+                                                                     theCornerMin2, theCornerMax2);
+      return RejectMetric (theMetric);
+    }
+
+    virtual Standard_Boolean RejectMetric (const Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      return theMetric > (myDist + myEps) * (myDist + myEps);
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      const TopoDS_Vertex& aVertex1 = TopoDS::Vertex (myMap1.FindKey (myBVHSet1->Element (theIndex1)));
+      const TopoDS_Vertex& aVertex2 = TopoDS::Vertex (myMap2.FindKey (myBVHSet2->Element (theIndex2)));
+      const gp_Pnt aPoint1 = BRep_Tool::Pnt (aVertex1);
+      const gp_Pnt aPoint2 = BRep_Tool::Pnt (aVertex2);
+      const Standard_Real aDist = aPoint1.Distance (aPoint2);
+      if (aDist < myDist - myEps)
+      {
+        mySolutions1.Clear();
+        mySolutions2.Clear();
+        myDist = aDist;
+      }
+      else if (Abs (aDist - myDist) >= myEps)
+      {
+        return Standard_False;
+      }
+
+      mySolutions1.Append (BRepExtrema_SolutionElem (aDist, aPoint1, BRepExtrema_IsVertex, aVertex1));
+      mySolutions2.Append (BRepExtrema_SolutionElem (aDist, aPoint2, BRepExtrema_IsVertex, aVertex2));
+      if (myDist > aDist)
+      {
+        myDist = aDist;
+      }
+      return Standard_True;
+    }
+
+  private:
+    const TopTools_IndexedMapOfShape& myMap1;
+    const TopTools_IndexedMapOfShape& myMap2;
+    Standard_Real myEps;
+    Standard_Real& myDist;
+    BRepExtrema_SeqOfSolution& mySolutions1;
+    BRepExtrema_SeqOfSolution& mySolutions2;
+  };
+
+  //! Computes the minimum distance between the nodes of two triangulations.
+  //! As the nodes lie on the shapes, it is the upper bound of the distance between them.
+  class BRepExtrema_MeshNodeDistance :
+    public BVH_PairDistance<Standard_Real, 3, BRepExtrema_TriangleSet>
+  {
+  public:
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      BVH_Vec3d aNodes1[3], aNodes2[3];
+      myBVHSet1->GetVertices (theIndex1, aNodes1[0], aNodes1[1], aNodes1[2]);
+      myBVHSet2->GetVertices (theIndex2, aNodes2[0], aNodes2[1], aNodes2[2]);
+
+      Standard_Boolean isBetter = Standard_False;
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        for (Standard_Integer j = 0; j < 3; ++j)
+        {
+          const Standard_Real aSqDist = (aNodes1[i] - aNodes2[j]).SquareModulus();
+          if (aSqDist < myDistance)
+          {
+            myDistance = aSqDist;
+            isBetter = Standard_True;
+          }
+        }
+      }
+      return isBetter;
+    }
+  };
+
+  //! Computes the lower bounds of the distances between the pairs of faces
+  //! of two shapes by the distances between the boxes of their triangles,
+  //! reduced by the deflections of the triangulations. Only the pairs of faces
+  //! which bounds do not exceed the given limit are stored.
+  class BRepExtrema_MeshPairBound :
+    public BVH_PairTraverse<Standard_Real, 3, BRepExtrema_TriangleSet>
+  {
+  public:
+
+    BRepExtrema_MeshPairBound (const NCollection_Vector<Standard_Integer>& theMeshFaces1,
+                               const NCollection_Vector<Standard_Integer>& theMeshFaces2,
+                               const Standard_Real                         theDeflection,
+                               const Standard_Real                         theLimit,
+                               NCollection_DataMap<Standard_Integer, TColStd_DataMapOfIntegerReal>& theBounds)
+    : myMeshFaces1 (theMeshFaces1),
+      myMeshFaces2 (theMeshFaces2),
+      myDeflection (theDeflection),
+      mySqLimit ((theLimit + theDeflection) * (theLimit + theDeflection)),
+      myBounds (theBounds)
+    {
+    }
+
+    virtual Standard_Boolean RejectNode (const BVH_Vec3d& theCornerMin1,
+                                         const BVH_Vec3d& theCornerMax1,
+                                         const BVH_Vec3d& theCornerMin2,
+                                         const BVH_Vec3d& theCornerMax2,
+                                         Standard_Real& theMetric) const Standard_OVERRIDE
+    {
+      theMetric = BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance (theCornerMin1, theCornerMax1,
+                                                                     theCornerMin2, theCornerMax2);
+      return theMetric > mySqLimit;
+    }
+
+    virtual Standard_Boolean Accept (const Standard_Integer theIndex1,
+                                     const Standard_Integer theIndex2) Standard_OVERRIDE
+    {
+      const Standard_Real aSqDist = BVH_Tools<Standard_Real, 3>::BoxBoxSquareDistance (myBVHSet1->Box (theIndex1),
+                                                                                       myBVHSet2->Box (theIndex2));
+      if (aSqDist > mySqLimit)
+      {
+        return Standard_False;
+      }
+
+      const Standard_Real aBound = Max (Sqrt (aSqDist) - myDeflection, 0.0);
+      const Standard_Integer aFace1 = myMeshFaces1.Value (myBVHSet1->GetFaceID (theIndex1));
+      const Standard_Integer aFace2 = myMeshFaces2.Value (myBVHSet2->GetFaceID (theIndex2));
+      TColStd_DataMapOfIntegerReal* aBounds = myBounds.ChangeSeek (aFace1);
+      if (aBounds == NULL)
+      {
+        aBounds = myBounds.Bound (aFace1, TColStd_DataMapOfIntegerReal());
+      }
+      Standard_Real* aPairBound = aBounds->ChangeSeek (aFace2);
+      if (aPairBound == NULL)
+      {
+        aBounds->Bind (aFace2, aBound);
+      }
+      else if (aBound < *aPairBound)
+      {
+        *aPairBound = aBound;
+      }
+      return Standard_True;
+    }
+
+  private:
+    const NCollection_Vector<Standard_Integer>& myMeshFaces1;
+    const NCollection_Vector<Standard_Integer>& myMeshFaces2;
+    Standard_Real myDeflection;
+    Standard_Real mySqLimit;
+    NCollection_DataMap<Standard_Integer, TColStd_DataMapOfIntegerReal>& myBounds;
+  };
 }
 
 //=======================================================================
@@ -125,6 +557,68 @@ struct IndexBand
   Standard_Integer Last;
 };
 
+//=======================================================================
+//function : SplitIntoBands
+//purpose  : Splits the range of indices [1, theCount] into bands for parallel tasks
+//=======================================================================
+static void SplitIntoBands (const Standard_Integer         theCount,
+                            NCollection_Array1<IndexBand>& theBandArray)
+{
+  const Standard_Integer aMinTaskSize = theCount < 10 ? theCount : 10;
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = aThreadPool->NbThreads();
+  Standard_Integer aNbTasks = aNbThreads;
+  Standard_Integer aTaskSize = (Standard_Integer) Ceiling((double) theCount / aNbTasks);
+  if (aTaskSize < aMinTaskSize)
+  {
+    aTaskSize = aMinTaskSize;
+    aNbTasks = (Standard_Integer) Ceiling((double) theCount / aTaskSize);
+  }
+
+  Standard_Integer aFirstIndex(1);
+  theBandArray.Resize(0, aNbTasks - 1, Standard_False);
+  for (Standard_Integer anI = 0; anI < theBandArray.Size(); ++anI)
+  {
+    if (theCount < aFirstIndex + aTaskSize - 1)
+    {
+      aTaskSize = theCount - aFirstIndex + 1;
+    }
+    theBandArray.SetValue(anI, IndexBand(aFirstIndex, aFirstIndex + aTaskSize - 1));
+    aFirstIndex += aTaskSize;
+  }
+}
+
+//=======================================================================
+//function : SplitTree
+//purpose  : Splits the boxes of the tree into bands for parallel tasks.
+//           As the boxes are sorted by the construction of the tree,
+//           each band is spatially coherent and gets its own tree.
+//=======================================================================
+static void SplitTree (const Handle(BRepExtrema_BoxTree)&                   theTree,
+                       NCollection_Array1<Handle(BRepExtrema_BoxTree)>& theBandTrees)
+{
+  NCollection_Array1<IndexBand> aBandArray;
+  SplitIntoBands (theTree->Size(), aBandArray);
+  theBandTrees.Resize (0, aBandArray.Size() - 1, Standard_False);
+  if (aBandArray.Size() == 1)
+  {
+    theBandTrees.ChangeFirst() = theTree;
+    return;
+  }
+
+  for (Standard_Integer anI = 0; anI < aBandArray.Size(); ++anI)
+  {
+    Handle(BRepExtrema_BoxTree)& aBandTree = theBandTrees.ChangeValue (anI);
+    aBandTree = new BRepExtrema_BoxTree (new BVH_LinearBuilder<Standard_Real, 3>());
+    aBandTree->SetSize (aBandArray(anI).Last - aBandArray(anI).First + 1);
+    for (Standard_Integer anIdx = aBandArray(anI).First; anIdx <= aBandArray(anI).Last; ++anIdx)
+    {
+      aBandTree->Add (theTree->Element (anIdx - 1), theTree->Box (anIdx - 1));
+    }
+    aBandTree->Build();
+  }
+}
+
 //=======================================================================
 //struct   : ThreadSolution
 //purpose  : 
@@ -150,18 +644,19 @@ struct ThreadSolution
 //=======================================================================
 struct VertexFunctor
 {
-  VertexFunctor(NCollection_Array1<IndexBand>* theBandArray,
+  VertexFunctor(NCollection_Array1<Handle(BRepExtrema_BoxTree)>* theBandTrees,
                 const Message_ProgressRange& theRange):
-    BandArray(theBandArray),
-    Solution(theBandArray->Size()),
+    BandTrees(theBandTrees),
+    Solution(theBandTrees->Size()),
     Map1(NULL),
     Map2(NULL),
-    Scope(theRange, "Vertices distances calculating", theBandArray->Size()),
-    Ranges(0, theBandArray->Size() - 1),
+    Tree2(NULL),
+    Scope(theRange, "Vertices distances calculating", theBandTrees->Size()),
+    Ranges(0, theBandTrees->Size() - 1),
     Eps(Precision::Confusion()),
     StartDist(0.0)
   {
-    for (Standard_Integer i = 0; i < theBandArray->Size(); ++i)
+    for (Standard_Integer i = 0; i < theBandTrees->Size(); ++i)
     {
       Ranges.SetValue(i, Scope.Next());
     }
@@ -169,63 +664,28 @@ struct VertexFunctor
 
   void operator() (const Standard_Integer theIndex) const
   {
-    const Standard_Integer aCount2 = Map2->Extent();
-    const Standard_Integer aFirst = BandArray->Value(theIndex).First;
-    const Standard_Integer aLast  = BandArray->Value(theIndex).Last;
     Solution.Dist[theIndex] = StartDist;
 
-    Message_ProgressScope aScope(Ranges[theIndex], NULL, (double)aLast - aFirst);
-
-
-    for (Standard_Integer anIdx1 = aFirst; anIdx1 <= aLast; ++anIdx1)
+    Message_ProgressScope aScope(Ranges[theIndex], NULL, 1);
+    if (!aScope.More())
     {
-      if (!aScope.More())
-      {
-        break;
-      }
-      aScope.Next();
-
-      const TopoDS_Vertex& aVertex1 = TopoDS::Vertex(Map1->FindKey(anIdx1));
-      const gp_Pnt aPoint1 = BRep_Tool::Pnt(aVertex1);
-      for (Standard_Integer anIdx2 = 1; anIdx2 <= aCount2; ++anIdx2)
-      {
-        const TopoDS_Vertex& aVertex2 = TopoDS::Vertex(Map2->FindKey(anIdx2));
-        const gp_Pnt aPoint2 = BRep_Tool::Pnt(aVertex2);
-        const Standard_Real aDist = aPoint1.Distance(aPoint2);
-        {
-          if (aDist < Solution.Dist[theIndex] - Eps)
-          { 
-            const BRepExtrema_SolutionElem Sol1(aDist, aPoint1, BRepExtrema_IsVertex, aVertex1);
-            const BRepExtrema_SolutionElem Sol2(aDist, aPoint2, BRepExtrema_IsVertex, aVertex2);
-
-            Solution.Shape1[theIndex].Clear();
-            Solution.Shape2[theIndex].Clear();
-            Solution.Shape1[theIndex].Append(Sol1);
-            Solution.Shape2[theIndex].Append(Sol2);
-            
-            Solution.Dist[theIndex] = aDist;
-          }
-          else if (Abs(aDist - Solution.Dist[theIndex]) < Eps)
-          {
-            const BRepExtrema_SolutionElem Sol1(aDist, aPoint1, BRepExtrema_IsVertex, aVertex1);
-            const BRepExtrema_SolutionElem Sol2(aDist, aPoint2, BRepExtrema_IsVertex, aVertex2);
-            Solution.Shape1[theIndex].Append(Sol1);
-            Solution.Shape2[theIndex].Append(Sol2);
-
-            if (Solution.Dist[theIndex] > aDist)
-            {
-              Solution.Dist[theIndex] = aDist;
-            }
-          }          
-        }
-      }
+      return;
     }
+
+    // the closest pairs of vertices are searched by simultaneous descent
+    // of the tree of the band of the 1st shape and the tree of the 2nd one
+    BRepExtrema_VertexPairSelector aSelector(*Map1, *Map2, Eps, Solution.Dist[theIndex],
+                                             Solution.Shape1[theIndex], Solution.Shape2[theIndex]);
+    aSelector.SetBVHSets(BandTrees->Value(theIndex).get(), Tree2);
+    aSelector.Select();
+    aScope.Next();
   }
 
-  NCollection_Array1<IndexBand>*            BandArray;
+  NCollection_Array1<Handle(BRepExtrema_BoxTree)>* BandTrees;
   mutable ThreadSolution                    Solution;
   const TopTools_IndexedMapOfShape*         Map1;
   const TopTools_IndexedMapOfShape*         Map2;
+  BRepExtrema_BoxTree*                      Tree2;
   Message_ProgressScope                     Scope;
   NCollection_Array1<Message_ProgressRange> Ranges;
   Standard_Real                             Eps;
@@ -238,41 +698,27 @@ struct VertexFunctor
 //=======================================================================
 Standard_Boolean BRepExtrema_DistShapeShape::DistanceVertVert(const TopTools_IndexedMapOfShape& theMap1,
                                                               const TopTools_IndexedMapOfShape& theMap2,
+                                                              const Handle(BoxTree)&            theTree1,
+                                                              const Handle(BoxTree)&            theTree2,
                                                               const Message_ProgressRange& theRange)
 {
-  const Standard_Integer aCount1 = theMap1.Extent();
-  const Standard_Integer aMinTaskSize = aCount1 < 10 ? aCount1 : 10;
-  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
-  const Standard_Integer aNbThreads = aThreadPool->NbThreads();
-  Standard_Integer aNbTasks = aNbThreads;
-  Standard_Integer aTaskSize = (Standard_Integer) Ceiling((double) aCount1 / aNbTasks);
-  if (aTaskSize < aMinTaskSize)
-  {
-    aTaskSize = aMinTaskSize;
-    aNbTasks = (Standard_Integer) Ceiling((double) aCount1 / aTaskSize);
-  }
-
-  Standard_Integer aFirstIndex(1);
-  NCollection_Array1<IndexBand> aBandArray(0, aNbTasks - 1);
   Message_ProgressScope aDistScope(theRange, NULL, 1);
-
-  for (Standard_Integer anI = 0; anI < aBandArray.Size(); ++anI)
+  if (theTree1->Size() == 0 || theTree2->Size() == 0)
   {
-    if (aCount1 < aFirstIndex + aTaskSize - 1)
-    {
-      aTaskSize = aCount1 - aFirstIndex + 1;
-    }
-    aBandArray.SetValue(anI, IndexBand(aFirstIndex, aFirstIndex + aTaskSize - 1));
-    aFirstIndex += aTaskSize;
+    return Standard_True;
   }
 
-  VertexFunctor aFunctor(&aBandArray, aDistScope.Next());
+  NCollection_Array1<Handle(BRepExtrema_BoxTree)> aBandTrees;
+  SplitTree(theTree1, aBandTrees);
+
+  VertexFunctor aFunctor(&aBandTrees, aDistScope.Next());
   aFunctor.Map1            = &theMap1;
   aFunctor.Map2            = &theMap2;
+  aFunctor.Tree2           = theTree2.get();
   aFunctor.StartDist       = myDistRef;
   aFunctor.Eps             = myEps;
 
-  OSD_Parallel::For(0, aNbTasks, aFunctor, !myIsMultiThread);
+  OSD_Parallel::For(0, aBandTrees.Size(), aFunctor, !myIsMultiThread);
   if (!aDistScope.More())
   {
     return Standard_False;
@@ -312,6 +758,7 @@ struct DistanceFunctor
     Map2(NULL),
     LBox1(NULL),
     LBox2(NULL),
+    GlobalDist(NULL),
     Scope(theRange, "Shapes distances calculating", theArrayOfArrays->Size()),
     Ranges(0, theArrayOfArrays->Size() - 1),
     Eps(Precision::Confusion()),
@@ -335,7 +782,7 @@ struct DistanceFunctor
       }
       aScope.Next();
       const BRepExtrema_CheckPair& aPair = ArrayOfArrays->Value(theIndex).Value(i);
-      if (aPair.Distance > Solution.Dist[theIndex] + Eps)
+      if (aPair.Distance > Min(Solution.Dist[theIndex], GlobalDist->load()) + Eps)
       {
         break; // early search termination
       }
@@ -359,6 +806,13 @@ struct DistanceFunctor
           Solution.Shape2[theIndex].Append(aSeq2);
 
           Solution.Dist[theIndex] = aDistTool.DistValue();
+
+          // share the found distance with other tasks
+          Standard_Real aGlobalDist = GlobalDist->load();
+          while (aDist < aGlobalDist && !GlobalDist->compare_exchange_weak(aGlobalDist, aDist))
+          {
+            //
+          }
         }
         else if (Abs(aDist - Solution.Dist[theIndex]) < Eps)
         {
@@ -382,6 +836,7 @@ struct DistanceFunctor
   const TopTools_IndexedMapOfShape*         Map2;
   const Bnd_Array1OfBox*                    LBox1;
   const Bnd_Array1OfBox*                    LBox2;
+  std::atomic<Standard_Real>*               GlobalDist; //!< minimum distance found by all tasks
   Message_ProgressScope                     Scope;
   NCollection_Array1<Message_ProgressRange> Ranges;
   Standard_Real                             Eps;
@@ -395,18 +850,20 @@ struct DistanceFunctor
 //=======================================================================
 struct DistancePairFunctor
 {
-  DistancePairFunctor(NCollection_Array1<IndexBand>* theBandArray,
+  DistancePairFunctor(NCollection_Array1<Handle(BRepExtrema_BoxTree)>* theBandTrees,
                       const Message_ProgressRange& theRange):
-    BandArray(theBandArray),
-    PairList(0, theBandArray->Size() - 1),
+    BandTrees(theBandTrees),
+    PairList(0, theBandTrees->Size() - 1),
     LBox1(NULL),
     LBox2(NULL),
-    Scope(theRange, "Boxes distances calculating", theBandArray->Size()),
-    Ranges(0, theBandArray->Size() - 1),
+    Tree2(NULL),
+    MeshBounds(NULL),
+    Scope(theRange, "Boxes distances calculating", theBandTrees->Size()),
+    Ranges(0, theBandTrees->Size() - 1),
     DistRef(0),
     Eps(Precision::Confusion())
   {
-    for (Standard_Integer i = 0; i < theBandArray->Size(); ++i)
+    for (Standard_Integer i = 0; i < theBandTrees->Size(); ++i)
     {
       Ranges.SetValue(i, Scope.Next());
     }
@@ -414,35 +871,18 @@ struct DistancePairFunctor
 
   void operator() (const Standard_Integer theIndex) const
   {
-    const Standard_Integer aFirst = BandArray->Value(theIndex).First;
-    const Standard_Integer aLast  = BandArray->Value(theIndex).Last;
-
-    Message_ProgressScope aScope(Ranges[theIndex], NULL, (double) aLast - aFirst);
-
-    for (Standard_Integer anIdx1 = aFirst; anIdx1 <= aLast; ++anIdx1)
+    Message_ProgressScope aScope(Ranges[theIndex], NULL, 1);
+    if (!aScope.More())
     {
-      if (!aScope.More())
-      {
-        break;
-      }
-      aScope.Next();
-
-      for (Standard_Integer anIdx2 = 1; anIdx2 <= LBox2->Size(); ++anIdx2)
-      {
-        const Bnd_Box& aBox1 = LBox1->Value(anIdx1);
-        const Bnd_Box& aBox2 = LBox2->Value(anIdx2);
-        if (aBox1.IsVoid() || aBox2.IsVoid())
-        {
-          continue;
-        }
-
-        const Standard_Real aDist = aBox1.Distance(aBox2);       
-        if (aDist - DistRef < Eps)
-        {
-          PairList[theIndex].Append(BRepExtrema_CheckPair(anIdx1, anIdx2, aDist));
-        }
-      }
+      return;
     }
+
+    // the pairs of close boxes are searched by simultaneous descent
+    // of the tree of the band of the 1st shape and the tree of the 2nd one
+    BRepExtrema_BoxPairSelector aSelector(*LBox1, *LBox2, MeshBounds, DistRef, Eps, PairList[theIndex]);
+    aSelector.SetBVHSets(BandTrees->Value(theIndex).get(), Tree2);
+    aSelector.Select();
+    aScope.Next();
   }
 
   Standard_Integer ListSize()
@@ -455,10 +895,12 @@ struct DistancePairFunctor
     return aSize;
   }
 
-  NCollection_Array1<IndexBand>*             BandArray;
+  NCollection_Array1<Handle(BRepExtrema_BoxTree)>* BandTrees;
   mutable NCollection_Array1<NCollection_Vector<BRepExtrema_CheckPair> > PairList;
   const Bnd_Array1OfBox*                     LBox1;
   const Bnd_Array1OfBox*                     LBox2;
+  BRepExtrema_BoxTree*                       Tree2;
+  const BRepExtrema_FacePairBounds*          MeshBounds; //!< bounds for the pairs of faces or NULL
   Message_ProgressScope                      Scope;
   NCollection_Array1<Message_ProgressRange>  Ranges;
   Standard_Real                              DistRef;
@@ -470,54 +912,50 @@ struct DistancePairFunctor
 //purpose  : 
 //=======================================================================
 
-Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_IndexedMapOfShape& theMap1,
-                                                             const TopTools_IndexedMapOfShape& theMap2,
-                                                             const Bnd_Array1OfBox&            theLBox1,
-                                                             const Bnd_Array1OfBox&            theLBox2,
-                                                             const Message_ProgressRange&      theRange)
+Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_IndexedMapOfShape&                theMap1,
+                                                             const TopTools_IndexedMapOfShape&                theMap2,
+                                                             const Bnd_Array1OfBox&                           theLBox1,
+                                                             const Bnd_Array1OfBox&                           theLBox2,
+                                                             const Handle(BoxTree)&                           theTree1,
+                                                             const Handle(BoxTree)&                           theTree2,
+                                                             const NCollection_Vector<TColStd_ListOfInteger>& theFaces1,
+                                                             const NCollection_Vector<TColStd_ListOfInteger>& theFaces2,
+                                                             const Message_ProgressRange&                     theRange)
 {
-  const Standard_Integer aCount1 = theMap1.Extent();
-  const Standard_Integer aCount2 = theMap2.Extent();
-
-  if (aCount1 == 0 || aCount2 == 0)
+  if (theTree1->Size() == 0 || theTree2->Size() == 0)
   {
     return Standard_True;
   }
 
   Message_ProgressScope aTwinScope(theRange, NULL, 1.0);
 
-  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
-  const Standard_Integer aNbThreads = aThreadPool->NbThreads();
-  const Standard_Integer aMinPairTaskSize = aCount1 < 10 ? aCount1 : 10;
-  Standard_Integer aNbPairTasks = aNbThreads;
-  Standard_Integer aPairTaskSize = (Standard_Integer) Ceiling((double) aCount1 / aNbPairTasks);
-  if (aPairTaskSize < aMinPairTaskSize)
-  {
-    aPairTaskSize = aMinPairTaskSize;
-    aNbPairTasks = (Standard_Integer) Ceiling((double) aCount1 / aPairTaskSize);
-  }
+  // the minimum distance can not exceed neither the one already found
+  // nor the distance between the nodes of triangulations (if used)
+  const Standard_Real aDistBound = Min(myDistRef, myDistBound);
 
-  Standard_Integer aFirstIndex(1);
-  NCollection_Array1<IndexBand> aBandArray(0, aNbPairTasks - 1);
+  // the pairs of sub-shapes lying on the faces are also bounded
+  // by the triangulations of the faces (if used)
+  BRepExtrema_FacePairBounds aMeshBounds;
+  aMeshBounds.Bounds = &myFacePairBounds;
+  aMeshBounds.Triangulations1 = &myMeshTriangulations1;
+  aMeshBounds.Triangulations2 = &myMeshTriangulations2;
+  aMeshBounds.Faces1 = &theFaces1;
+  aMeshBounds.Faces2 = &theFaces2;
+  const Standard_Boolean isMeshBound = myIsMeshBound && !myMesh1.IsNull() && !myMesh2.IsNull();
 
-  for (Standard_Integer anI = 0; anI < aBandArray.Size(); ++anI)
-  {
-    if (aCount1 < aFirstIndex + aPairTaskSize - 1)
-    {
-      aPairTaskSize = aCount1 - aFirstIndex + 1;
-    }
-    aBandArray.SetValue(anI, IndexBand(aFirstIndex, aFirstIndex + aPairTaskSize - 1));
-    aFirstIndex += aPairTaskSize;
-  }
+  NCollection_Array1<Handle(BRepExtrema_BoxTree)> aBandTrees;
+  SplitTree(theTree1, aBandTrees);
 
   aTwinScope.Next(0.15);
-  DistancePairFunctor aPairFunctor(&aBandArray, aTwinScope.Next(0.15));
+  DistancePairFunctor aPairFunctor(&aBandTrees, aTwinScope.Next(0.15));
   aPairFunctor.LBox1 = &theLBox1;
   aPairFunctor.LBox2 = &theLBox2;
-  aPairFunctor.DistRef = myDistRef;
+  aPairFunctor.Tree2 = theTree2.get();
+  aPairFunctor.MeshBounds = isMeshBound ? &aMeshBounds : NULL;
+  aPairFunctor.DistRef = aDistBound;
   aPairFunctor.Eps = myEps;
 
-  OSD_Parallel::For(0, aNbPairTasks, aPairFunctor, !myIsMultiThread);
+  OSD_Parallel::For(0, aBandTrees.Size(), aPairFunctor, !myIsMultiThread);
   if (!aTwinScope.More())
   {
     return Standard_False;
@@ -540,6 +978,8 @@ Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_Inde
 
   std::stable_sort(aPairList.begin(), aPairList.end(), BRepExtrema_CheckPair_Comparator);
 
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = aThreadPool->NbThreads();
   const Standard_Integer aMapSize = aPairList.Size();
   Standard_Integer aNbTasks = aMapSize < aNbThreads ? aMapSize : aNbThreads;
   Standard_Integer aTaskSize = (Standard_Integer) Ceiling((double) aMapSize / aNbTasks);
@@ -583,6 +1023,8 @@ Standard_Boolean BRepExtrema_DistShapeShape::DistanceMapMap (const TopTools_Inde
   aFunctor.LBox2 = &theLBox2;
   aFunctor.Eps = myEps;
   aFunctor.StartDist = myDistRef;
+  std::atomic<Standard_Real> aGlobalDist(aDistBound);
+  aFunctor.GlobalDist = &aGlobalDist;
 
   OSD_Parallel::For(0, aNbTasks, aFunctor, !myIsMultiThread);
   if (!aTwinScope.More())
@@ -628,6 +1070,10 @@ BRepExtrema_DistShapeShape::BRepExtrema_DistShapeShape()
   myIsInitS2 (Standard_False),
   myFlag (Extrema_ExtFlag_MINMAX),
   myAlgo (Extrema_ExtAlgo_Grad),
+  myMeshDeflection1 (0.0),
+  myMeshDeflection2 (0.0),
+  myDistBound (RealLast()),
+  myIsMeshBound (Standard_False),
   myIsMultiThread(Standard_False)
 {
 }
@@ -649,6 +1095,10 @@ BRepExtrema_DistShapeShape::BRepExtrema_DistShapeShape(const TopoDS_Shape& Shape
   myIsInitS2 (Standard_False),
   myFlag (F),
   myAlgo (A),
+  myMeshDeflection1 (0.0),
+  myMeshDeflection2 (0.0),
+  myDistBound (RealLast()),
+  myIsMeshBound (Standard_False),
   myIsMultiThread(Standard_False)
 {
   LoadS1(Shape1);
@@ -675,6 +1125,10 @@ BRepExtrema_DistShapeShape::BRepExtrema_DistShapeShape(const TopoDS_Shape& Shape
   myIsInitS2 (Standard_False),
   myFlag (F),
   myAlgo (A),
+  myMeshDeflection1 (0.0),
+  myMeshDeflection2 (0.0),
+  myDistBound (RealLast()),
+  myIsMeshBound (Standard_False),
   myIsMultiThread(Standard_False)
 {
   LoadS1(Shape1);
@@ -692,6 +1146,12 @@ void BRepExtrema_DistShapeShape::LoadS1 (const TopoDS_Shape& Shape1)
   myShape1 = Shape1;
   myIsInitS1 = Standard_False;
   Decomposition (Shape1, myMapV1, myMapE1, myMapF1);
+  myMesh1.Nullify();
+  myMeshTriangulations1.Clear();
+  myMeshFaces1.Clear();
+  myFacesV1.Clear();
+  myFacesE1.Clear();
+  myFacesF1.Clear();
 }
 
 //=======================================================================
@@ -704,6 +1164,12 @@ void BRepExtrema_DistShapeShape::LoadS2 (const TopoDS_Shape& Shape2)
   myShape2 = Shape2;
   myIsInitS2 = Standard_False;
   Decomposition (Shape2, myMapV2, myMapE2, myMapF2);
+  myMesh2.Nullify();
+  myMeshTriangulations2.Clear();
+  myMeshFaces2.Clear();
+  myFacesV2.Clear();
+  myFacesE2.Clear();
+  myFacesF2.Clear();
 }
 
 //=======================================================================
@@ -837,6 +1303,68 @@ Standard_Boolean BRepExtrema_DistShapeShape::SolidTreatment(const TopoDS_Shape&
   return Standard_True;
 }
 
+//=======================================================================
+//function : DistanceMeshMesh
+//purpose  : 
+//=======================================================================
+void BRepExtrema_DistShapeShape::DistanceMeshMesh()
+{
+  myDistBound = RealLast();
+  myFacePairBounds.Clear();
+  if (!myIsMeshBound)
+  {
+    return;
+  }
+
+  // the sets of triangles are built on demand only and rebuilt
+  // if the faces have been meshed again since the previous computation
+  if (IsMeshOutdated (myMapF1, myMeshTriangulations1))
+  {
+    MeshCalculation (myMapF1, myMesh1, myMeshTriangulations1, myMeshFaces1, myMeshDeflection1);
+  }
+  if (IsMeshOutdated (myMapF2, myMeshTriangulations2))
+  {
+    MeshCalculation (myMapF2, myMesh2, myMeshTriangulations2, myMeshFaces2, myMeshDeflection2);
+  }
+  if (myMesh1.IsNull() || myMesh2.IsNull())
+  {
+    return;
+  }
+
+  // the faces containing the sub-shapes are found once for the loaded shapes
+  if (myFacesF1.IsEmpty())
+  {
+    FaceAncestors (myMapV1, TopAbs_VERTEX, myMapF1, myFacesV1);
+    FaceAncestors (myMapE1, TopAbs_EDGE,   myMapF1, myFacesE1);
+    FaceAncestors (myMapF1, TopAbs_FACE,   myMapF1, myFacesF1);
+  }
+  if (myFacesF2.IsEmpty())
+  {
+    FaceAncestors (myMapV2, TopAbs_VERTEX, myMapF2, myFacesV2);
+    FaceAncestors (myMapE2, TopAbs_EDGE,   myMapF2, myFacesE2);
+    FaceAncestors (myMapF2, TopAbs_FACE,   myMapF2, myFacesF2);
+  }
+
+  BRepExtrema_MeshNodeDistance aMeshDist;
+  aMeshDist.SetBVHSets(myMesh1.get(), myMesh2.get());
+  const Standard_Real aSqDist = aMeshDist.ComputeDistance();
+  if (aMeshDist.IsDone())
+  {
+    // the nodes of triangulations are expected to lie on the shapes,
+    // deflections are added to be robust to the meshes not fitting them exactly
+    myDistBound = Sqrt(aSqDist) + myMeshDeflection1 + myMeshDeflection2;
+  }
+
+  // lower bounds of the distances between the pairs of faces,
+  // the pairs farther than the upper bound are not kept
+  BRepExtrema_MeshPairBound aPairBound (myMeshFaces1, myMeshFaces2,
+                                        myMeshDeflection1 + myMeshDeflection2,
+                                        Min (myDistRef, myDistBound) + myEps,
+                                        myFacePairBounds);
+  aPairBound.SetBVHSets(myMesh1.get(), myMesh2.get());
+  aPairBound.Select();
+}
+
 //=======================================================================
 //function : Perform
 //purpose  : 
@@ -899,6 +1427,10 @@ Standard_Boolean BRepExtrema_DistShapeShape::Perform(const Message_ProgressRange
       BoxCalculation (myMapE1, myBE1);
       BoxCalculation (myMapF1, myBF1);
 
+      TreeCalculation (myMapV1, myBV1, myTreeV1);
+      TreeCalculation (myMapE1, myBE1, myTreeE1);
+      TreeCalculation (myMapF1, myBF1, myTreeF1);
+
       myIsInitS1 = Standard_True;
     }
 
@@ -921,6 +1453,10 @@ Standard_Boolean BRepExtrema_DistShapeShape::Perform(const Message_ProgressRange
       BoxCalculation (myMapE2, myBE2);
       BoxCalculation (myMapF2, myBF2);
 
+      TreeCalculation (myMapV2, myBV2, myTreeV2);
+      TreeCalculation (myMapE2, myBE2, myTreeE2);
+      TreeCalculation (myMapF2, myBF2, myTreeF2);
+
       myIsInitS2 = Standard_True;
     }
 
@@ -933,42 +1469,52 @@ Standard_Boolean BRepExtrema_DistShapeShape::Perform(const Message_ProgressRange
     else
       myDistRef = 1.e30; //szv:!!!
 
-    if (!DistanceVertVert(myMapV1, myMapV2, aRootScope.Next()))
+    DistanceMeshMesh();
+
+    if (!DistanceVertVert(myMapV1, myMapV2, myTreeV1, myTreeV2, aRootScope.Next()))
     {
       return Standard_False;
     }
-    if (!DistanceMapMap(myMapV1, myMapE2, myBV1, myBE2, aRootScope.Next()))
+    if (!DistanceMapMap(myMapV1, myMapE2, myBV1, myBE2, myTreeV1, myTreeE2,
+                        myFacesV1, myFacesE2, aRootScope.Next()))
     {
       return Standard_False;
     }
-    if (!DistanceMapMap(myMapE1, myMapV2, myBE1, myBV2, aRootScope.Next()))
+    if (!DistanceMapMap(myMapE1, myMapV2, myBE1, myBV2, myTreeE1, myTreeV2,
+                        myFacesE1, myFacesV2, aRootScope.Next()))
     {
       return Standard_False;
     }
-    if (!DistanceMapMap(myMapV1, myMapF2, myBV1, myBF2, aRootScope.Next()))
+    if (!DistanceMapMap(myMapV1, myMapF2, myBV1, myBF2, myTreeV1, myTreeF2,
+                        myFacesV1, myFacesF2, aRootScope.Next()))
     {
       return Standard_False;
     }
-    if (!DistanceMapMap(myMapF1, myMapV2, myBF1, myBV2, aRootScope.Next()))
+    if (!DistanceMapMap(myMapF1, myMapV2, myBF1, myBV2, myTreeF1, myTreeV2,
+                        myFacesF1, myFacesV2, aRootScope.Next()))
     {
       return Standard_False;
     }
-    if (!DistanceMapMap(myMapE1, myMapE2, myBE1, myBE2, aRootScope.Next()))
+    if (!DistanceMapMap(myMapE1, myMapE2, myBE1, myBE2, myTreeE1, myTreeE2,
+                        myFacesE1, myFacesE2, aRootScope.Next()))
     {
       return Standard_False;
     }
-    if (!DistanceMapMap(myMapE1, myMapF2, myBE1, myBF2, aRootScope.Next()))
+    if (!DistanceMapMap(myMapE1, myMapF2, myBE1, myBF2, myTreeE1, myTreeF2,
+                        myFacesE1, myFacesF2, aRootScope.Next()))
     {
       return Standard_False;
     }
-    if (!DistanceMapMap(myMapF1, myMapE2, myBF1, myBE2, aRootScope.Next()))
+    if (!DistanceMapMap(myMapF1, myMapE2, myBF1, myBE2, myTreeF1, myTreeE2,
+                        myFacesF1, myFacesE2, aRootScope.Next()))
     {
       return Standard_False;
     }
 
     if (Abs(myDistRef) > myEps)
     {
-      if (!DistanceMapMap(myMapF1, myMapF2, myBF1, myBF2, aRootScope.Next()))
+      if (!DistanceMapMap(myMapF1, myMapF2, myBF1, myBF2, myTreeF1, myTreeF2,
+                        myFacesF1, myFacesF2, aRootScope.Next()))
       {
         return Standard_False;
       }
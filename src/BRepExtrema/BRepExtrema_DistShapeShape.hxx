@@ -18,9 +18,16 @@
 #include <BRepExtrema_SeqOfSolution.hxx>
 #include <BRepExtrema_SolutionElem.hxx>
 #include <BRepExtrema_SupportType.hxx>
+#include <BRepExtrema_TriangleSet.hxx>
+#include <BVH_BoxSet.hxx>
 #include <Extrema_ExtAlgo.hxx>
 #include <Extrema_ExtFlag.hxx>
 #include <Message_ProgressRange.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <Poly_Triangulation.hxx>
+#include <TColStd_DataMapOfIntegerReal.hxx>
+#include <TColStd_ListOfInteger.hxx>
 #include <TopoDS_Shape.hxx>
 #include <Standard_OStream.hxx>
 #include <Standard_DefineAlloc.hxx>
@@ -180,6 +187,9 @@ class BRepExtrema_DistShapeShape
   }
 
   //! If isMultiThread == Standard_True then computation will be performed in parallel.
+  //! Candidate pairs of sub-shapes are selected by simultaneous descent of the BVH trees
+  //! built on the bounding boxes of the sub-shapes of both shapes; the tree of the first
+  //! shape is split into spatially coherent bands processed in parallel.
   void SetMultiThread(Standard_Boolean theIsMultiThread)
   {
     myIsMultiThread = theIsMultiThread;
@@ -192,20 +202,57 @@ class BRepExtrema_DistShapeShape
     return myIsMultiThread;
   }
 
+  //! If theIsMeshBound == Standard_True then the triangulations of the faces of both shapes
+  //! (if any) are used to compute the upper bound of the minimum distance by their nodes
+  //! and the lower bounds of the distances between the pairs of faces by their triangles.
+  //! The pairs of sub-shapes lying on the faces which lower bound exceeds the upper bound
+  //! are not computed exactly, the other pairs are computed in the order of their lower bounds.
+  //! The sets of triangles are rebuilt if the faces have been meshed again.
+  //! The triangulations are expected to be built on the current geometry of the faces
+  //! within their deflection (e.g. by BRepMesh_IncrementalMesh); an outdated or imported
+  //! triangulation may lead to a wrong result.
+  //! Default value is Standard_False
+  void SetMeshBound(Standard_Boolean theIsMeshBound)
+  {
+    myIsMeshBound = theIsMeshBound;
+  }
+
+  //! Returns Standard_True if the triangulations of the shapes are used
+  //! to bound the minimum distance
+  Standard_Boolean IsMeshBound() const
+  {
+    return myIsMeshBound;
+  }
+
 private:
 
-  //! computes the minimum distance between two maps of shapes (Face,Edge,Vertex) <br>
-  Standard_Boolean DistanceMapMap(const TopTools_IndexedMapOfShape& Map1,
-                                  const TopTools_IndexedMapOfShape& Map2,
-                                  const Bnd_Array1OfBox&            LBox1,
-                                  const Bnd_Array1OfBox&            LBox2,
-                                  const Message_ProgressRange&      theRange);
+  //! Set of bounding boxes of sub-shapes (identified by their indices in the map)
+  //! with BVH tree built on them.
+  typedef BVH_BoxSet<Standard_Real, 3, Standard_Integer> BoxTree;
+
+  //! computes the minimum distance between two maps of shapes (Face,Edge,Vertex);
+  //! the pairs of sub-shapes are bounded by the triangulations of the faces they lie on <br>
+  Standard_Boolean DistanceMapMap(const TopTools_IndexedMapOfShape&                Map1,
+                                  const TopTools_IndexedMapOfShape&                Map2,
+                                  const Bnd_Array1OfBox&                           LBox1,
+                                  const Bnd_Array1OfBox&                           LBox2,
+                                  const Handle(BoxTree)&                           theTree1,
+                                  const Handle(BoxTree)&                           theTree2,
+                                  const NCollection_Vector<TColStd_ListOfInteger>& theFaces1,
+                                  const NCollection_Vector<TColStd_ListOfInteger>& theFaces2,
+                                  const Message_ProgressRange&                     theRange);
 
   //! computes the minimum distance between two maps of vertices <br>
   Standard_Boolean DistanceVertVert(const TopTools_IndexedMapOfShape& theMap1,
                                     const TopTools_IndexedMapOfShape& theMap2,
+                                    const Handle(BoxTree)&            theTree1,
+                                    const Handle(BoxTree)&            theTree2,
                                     const Message_ProgressRange& theRange);
 
+  //! computes the upper bound of the minimum distance by the nodes of triangulations
+  //! of the faces of both shapes and the lower bounds for the pairs of faces (if enabled) <br>
+  void DistanceMeshMesh();
+
   Standard_Boolean SolidTreatment(const TopoDS_Shape& theShape,
                                   const TopTools_IndexedMapOfShape& theMap,
                                   const Message_ProgressRange& theRange);
@@ -236,6 +283,29 @@ private:
   Bnd_Array1OfBox myBE2;
   Bnd_Array1OfBox myBF1;
   Bnd_Array1OfBox myBF2;
+  Handle(BoxTree) myTreeV1;
+  Handle(BoxTree) myTreeV2;
+  Handle(BoxTree) myTreeE1;
+  Handle(BoxTree) myTreeE2;
+  Handle(BoxTree) myTreeF1;
+  Handle(BoxTree) myTreeF2;
+  Handle(BRepExtrema_TriangleSet) myMesh1;
+  Handle(BRepExtrema_TriangleSet) myMesh2;
+  NCollection_Vector<Handle(Poly_Triangulation)> myMeshTriangulations1; //!< triangulations of the faces the set of triangles is built on
+  NCollection_Vector<Handle(Poly_Triangulation)> myMeshTriangulations2;
+  NCollection_Vector<Standard_Integer> myMeshFaces1; //!< indices of the faces in the set of triangles
+  NCollection_Vector<Standard_Integer> myMeshFaces2;
+  NCollection_Vector<TColStd_ListOfInteger> myFacesV1; //!< indices of the faces containing each vertex
+  NCollection_Vector<TColStd_ListOfInteger> myFacesV2;
+  NCollection_Vector<TColStd_ListOfInteger> myFacesE1; //!< indices of the faces containing each edge
+  NCollection_Vector<TColStd_ListOfInteger> myFacesE2;
+  NCollection_Vector<TColStd_ListOfInteger> myFacesF1; //!< index of each face
+  NCollection_Vector<TColStd_ListOfInteger> myFacesF2;
+  NCollection_DataMap<Standard_Integer, TColStd_DataMapOfIntegerReal> myFacePairBounds; //!< lower bounds for the pairs of faces
+  Standard_Real myMeshDeflection1;
+  Standard_Real myMeshDeflection2;
+  Standard_Real myDistBound;
+  Standard_Boolean myIsMeshBound;
   Standard_Boolean myIsMultiThread;
 };
 
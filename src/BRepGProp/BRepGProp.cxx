@@ -27,6 +27,8 @@
 #include <BRep_Tool.hxx>  
 #include <TopTools_MapOfShape.hxx>
 #include <BRepCheck_Shell.hxx>
+#include <NCollection_Array1.hxx>
+#include <OSD_Parallel.hxx>
 
 #ifdef OCCT_DEBUG
 static Standard_Integer AffichEps = 0;
@@ -110,101 +112,166 @@ void  BRepGProp::LinearProperties(const TopoDS_Shape& S, GProp_GProps& SProps, c
   }
 }
 
-static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                       const Standard_Boolean UseTriangulation)
+//=======================================================================
+//class   : BRepGProp_FacePropsFunctor
+//purpose : Computes properties of the faces independently of each other.
+//          The properties are kept per face and summed up afterwards
+//          in the order of faces, so that the result does not depend
+//          on the number of threads.
+//=======================================================================
+template<class TheInert, BRepGProp_MeshProps::BRepGProp_MeshObjType TheMeshType>
+class BRepGProp_FacePropsFunctor
 {
-  Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real ErrorMax = 0.0, Error;
-  TopExp_Explorer ex; 
-  gp_Pnt P(roughBaryCenter(S));
-  BRepGProp_Sinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Sinert);  
-  MG.SetLocation(P);
-
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
-  TopTools_MapOfShape aFMap;
-  TopLoc_Location aLocDummy;
-
-  for (ex.Init(S, TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++) {
-    const TopoDS_Face& F = TopoDS::Face(ex.Current());
-    if (SkipShared && !aFMap.Add(F))
+public:
+  BRepGProp_FacePropsFunctor (const TopTools_ListOfShape& theFaces,
+                              const gp_Pnt&               theLocation,
+                              const Standard_Real         theEps,
+                              const Standard_Boolean      theUseTriangulation)
+  : myFaces (1, Max (theFaces.Extent(), 1)),
+    myProps (1, Max (theFaces.Extent(), 1)),
+    myErrors (1, Max (theFaces.Extent(), 1)),
+    myNbFaces (theFaces.Extent()),
+    myLocation (theLocation),
+    myEps (theEps),
+    myUseTriangulation (theUseTriangulation)
+  {
+    Standard_Integer anIndex = 1;
+    for (TopTools_ListOfShape::Iterator aFaceIt (theFaces); aFaceIt.More(); aFaceIt.Next(), ++anIndex)
     {
-      continue;
+      myFaces.SetValue (anIndex, TopoDS::Face (aFaceIt.Value()));
     }
+    myErrors.Init (0.0);
+  }
 
-    Standard_Boolean NoSurf = Standard_False, NoTri = Standard_False;
+  //! Computes properties of the face with the given index.
+  void operator() (const Standard_Integer theIndex) const
+  {
+    const TopoDS_Face& F = myFaces.Value (theIndex);
+    TopLoc_Location aLocDummy, aTriLoc;
+    const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (F, aTriLoc);
+    const Standard_Boolean NoTri = aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0;
+    const Standard_Boolean NoSurf = BRep_Tool::Surface (F, aLocDummy).IsNull();
+    if ((myUseTriangulation && !NoTri) || (NoSurf && !NoTri))
     {
-      const Handle(Geom_Surface)& aSurf = BRep_Tool::Surface(F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = Standard_True;
-      }
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = Standard_True;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
+      BRepGProp_MeshProps MG (TheMeshType);
+      MG.SetLocation (myLocation);
+      MG.Perform (aTri, aTriLoc, F.Orientation());
+      myProps.ChangeValue (theIndex) = MG;
+      return;
     }
 
-    if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
+    BRepGProp_Face   BF;
+    BRepGProp_Domain BD;
+    TheInert         G;
+    G.SetLocation (myLocation);
+    BF.Load (F);
+    Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
+    if (!IsNatRestr) BD.Init (F);
+    if (myEps < 1.0) {
+      G.Perform (BF, BD, myEps);
+      myErrors.ChangeValue (theIndex) = G.GetEpsilon();
+    }
+    else {
+      if (IsNatRestr) G.Perform (BF);
+      else G.Perform (BF, BD);
+    }
+    myProps.ChangeValue (theIndex) = G;
+  }
+
+  //! Computes properties of all faces and adds them to theProps in the order of faces.
+  //! Returns the maximal error of integration.
+  Standard_Real Perform (GProp_GProps& theProps, const Standard_Boolean theIsParallel)
+  {
+    if (myNbFaces == 0)
     {
-      TopAbs_Orientation anOri = F.Orientation();
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      MG.Perform(aTri, aLocDummy, anOri);
-      Props.Add(MG);
+      return 0.0;
     }
-    else
+
+    OSD_Parallel::For (1, myNbFaces + 1, *this, !theIsParallel);
+
+    Standard_Real ErrorMax = 0.0;
+#ifdef OCCT_DEBUG
+    Standard_Integer iErrorMax = 0;
+#endif
+    for (Standard_Integer i = 1; i <= myNbFaces; ++i)
     {
-      BF.Load(F);
-      Standard_Boolean IsNatRestr = (F.NbChildren() == 0);
-      if (!IsNatRestr) BD.Init(F);
-      if (Eps < 1.0) {
-        G.Perform(BF, BD, Eps);
-        Error = G.GetEpsilon();
-        if (ErrorMax < Error) {
-          ErrorMax = Error;
+      theProps.Add (myProps.Value (i));
+      if (ErrorMax < myErrors.Value (i)) {
+        ErrorMax = myErrors.Value (i);
 #ifdef OCCT_DEBUG
-          iErrorMax = i;
+        iErrorMax = i;
 #endif
-        }
-      }
-      else {
-        if (IsNatRestr) G.Perform(BF);
-        else G.Perform(BF, BD);
       }
-      Props.Add(G);
 #ifdef OCCT_DEBUG
-      if(AffichEps) std::cout<<"\n"<<i<<":\tEpsArea = "<< G.GetEpsilon();
+      if(AffichEps) std::cout<<"\n"<<i<<":\tEps = "<< myErrors.Value (i);
 #endif
     }
-  }
 #ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
+    if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
 #endif
-  return ErrorMax;
+    return ErrorMax;
+  }
+
+private:
+  NCollection_Array1<TopoDS_Face>           myFaces;
+  mutable NCollection_Array1<GProp_GProps>  myProps;
+  mutable NCollection_Array1<Standard_Real> myErrors;
+  Standard_Integer                          myNbFaces;
+  gp_Pnt                                    myLocation;
+  Standard_Real                             myEps;
+  Standard_Boolean                          myUseTriangulation;
+};
+
+//! Checks if the face has any geometry to compute properties from.
+static Standard_Boolean hasGeometry (const TopoDS_Face& F)
+{
+  TopLoc_Location aLocDummy;
+  if (!BRep_Tool::Surface (F, aLocDummy).IsNull())
+  {
+    return Standard_True;
+  }
+  const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation (F, aLocDummy);
+  return !aTri.IsNull() && aTri->NbNodes() != 0 && aTri->NbTriangles() != 0;
+}
+
+static Standard_Real surfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                       const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
+{
+  TopExp_Explorer ex; 
+  gp_Pnt P(roughBaryCenter(S));
+  TopTools_MapOfShape aFMap;
+  TopTools_ListOfShape aFaces;
+
+  for (ex.Init(S, TopAbs_FACE); ex.More(); ex.Next()) {
+    const TopoDS_Face& F = TopoDS::Face(ex.Current());
+    if (SkipShared && !aFMap.Add(F))
+    {
+      continue;
+    }
+    if (hasGeometry (F))
+    {
+      aFaces.Append (F);
+    }
+  }
+
+  BRepGProp_FacePropsFunctor<BRepGProp_Sinert, BRepGProp_MeshProps::Sinert> aFunctor (aFaces, P, Eps, UseTriangulation);
+  return aFunctor.Perform (Props, IsParallel);
 }
 void  BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean SkipShared,
-                                   const Standard_Boolean UseTriangulation)
+                                   const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);
   P.Transform(S.Location());
   Props = GProp_GProps(P);
-  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation);
+  surfaceProperties(S,Props,1.0, SkipShared, UseTriangulation, IsParallel);
 }
-Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared){ 
+Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
+                                            const Standard_Boolean IsParallel){ 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
   Props = GProp_GProps(P);
-  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False);
+  Standard_Real ErrorMax = surfaceProperties(S,Props,Eps,SkipShared, Standard_False, IsParallel);
   return ErrorMax;
 }
 
@@ -214,26 +281,15 @@ Standard_Real BRepGProp::SurfaceProperties(const TopoDS_Shape& S, GProp_GProps&
 //=======================================================================
 
 static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Real Eps, const Standard_Boolean SkipShared,
-                                      const Standard_Boolean UseTriangulation)
+                                      const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
 {
-  Standard_Integer i;
-#ifdef OCCT_DEBUG
-  Standard_Integer iErrorMax = 0;
-#endif
-  Standard_Real ErrorMax = 0.0, Error = 0.0;
   TopExp_Explorer ex; 
   gp_Pnt P(roughBaryCenter(S)); 
-  BRepGProp_Vinert G;  G.SetLocation(P);
-  BRepGProp_MeshProps MG(BRepGProp_MeshProps::Vinert);
-  MG.SetLocation(P);
-
-  BRepGProp_Face   BF;
-  BRepGProp_Domain BD;
   TopTools_MapOfShape aFwdFMap;
   TopTools_MapOfShape aRvsFMap;
-  TopLoc_Location aLocDummy;
+  TopTools_ListOfShape aFaces;
 
-  for (ex.Init(S,TopAbs_FACE), i = 1; ex.More(); ex.Next(), i++) {
+  for (ex.Init(S,TopAbs_FACE); ex.More(); ex.Next()) {
     const TopoDS_Face& F = TopoDS::Face(ex.Current());
     TopAbs_Orientation anOri = F.Orientation();
     Standard_Boolean isFwd = anOri == TopAbs_FORWARD;
@@ -249,65 +305,17 @@ static Standard_Real volumeProperties(const TopoDS_Shape& S, GProp_GProps& Props
         continue;
       }
     }
-    Standard_Boolean NoSurf = Standard_False, NoTri = Standard_False;
-    {
-      const Handle(Geom_Surface)& aSurf = BRep_Tool::Surface (F, aLocDummy);
-      if (aSurf.IsNull())
-      {
-        NoSurf = Standard_True;
-      }
-      const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-      if (aTri.IsNull() || aTri->NbNodes() == 0 || aTri->NbTriangles() == 0)
-      {
-        NoTri = Standard_True;
-      }
-      if (NoTri && NoSurf)
-      {
-        continue;
-      }
-    }
-
-    if (isFwd || isRvs)
+    if ((isFwd || isRvs) && hasGeometry (F))
     {
-      if ((UseTriangulation && !NoTri) || (NoSurf && !NoTri))
-      {
-        const Handle(Poly_Triangulation)& aTri = BRep_Tool::Triangulation(F, aLocDummy);
-        MG.Perform(aTri, aLocDummy, anOri);
-        Props.Add(MG);
-      }
-      else
-      {
-        BF.Load(F);
-        Standard_Boolean IsNatRestr = (F.NbChildren () == 0);
-        if (!IsNatRestr) BD.Init(F);
-        if (Eps < 1.0) {
-          G.Perform(BF, BD, Eps);
-          Error = G.GetEpsilon();
-          if (ErrorMax < Error) {
-            ErrorMax = Error;
-#ifdef OCCT_DEBUG
-            iErrorMax = i;
-#endif
-          }
-        }
-        else {
-          if (IsNatRestr) G.Perform(BF);
-          else G.Perform(BF, BD);
-        }
-        Props.Add(G);
-#ifdef OCCT_DEBUG
-        if(AffichEps) std::cout<<"\n"<<i<<":\tEpsVolume = "<< G.GetEpsilon();
-#endif
-      }
+      aFaces.Append (F);
     }
   }
-#ifdef OCCT_DEBUG
-  if(AffichEps) std::cout<<"\n-----------------\n"<<iErrorMax<<":\tMaxError = "<<ErrorMax<<"\n";
-#endif
-  return ErrorMax;
+
+  BRepGProp_FacePropsFunctor<BRepGProp_Vinert, BRepGProp_MeshProps::Vinert> aFunctor (aFaces, P, Eps, UseTriangulation);
+  return aFunctor.Perform (Props, IsParallel);
 }
 void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
-                                  const Standard_Boolean UseTriangulation)
+                                  const Standard_Boolean UseTriangulation, const Standard_Boolean IsParallel)
 {
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -321,9 +329,9 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
       {
         continue;
       }
-      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation);
+      if(BRep_Tool::IsClosed(Sh)) volumeProperties(Sh,Props,1.0,SkipShared, UseTriangulation, IsParallel);
     }
-  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation);
+  } else volumeProperties(S,Props,1.0,SkipShared, UseTriangulation, IsParallel);
 }
 
 //=======================================================================
@@ -332,7 +340,8 @@ void  BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, co
 //=======================================================================
 
 Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& Props, 
-  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared)
+  const Standard_Real Eps, const Standard_Boolean OnlyClosed, const Standard_Boolean SkipShared,
+  const Standard_Boolean IsParallel)
 { 
   // find the origin
   gp_Pnt P(0,0,0);  P.Transform(S.Location());
@@ -352,7 +361,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         continue;
       }
       if(BRep_Tool::IsClosed(Sh)) {
-        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False);
+        Error = volumeProperties(Sh,Props,Eps,SkipShared, Standard_False, IsParallel);
         if(ErrorMax < Error) {
           ErrorMax = Error;
 #ifdef OCCT_DEBUG
@@ -361,7 +370,7 @@ Standard_Real BRepGProp::VolumeProperties(const TopoDS_Shape& S, GProp_GProps& P
         }
       }
     }
-  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False);
+  } else ErrorMax = volumeProperties(S,Props,Eps,SkipShared, Standard_False, IsParallel);
 #ifdef OCCT_DEBUG
   if(AffichEps) std::cout<<"\n\n==================="<<iErrorMax<<":\tMaxEpsVolume = "<<ErrorMax<<"\n";
 #endif
@@ -131,9 +131,12 @@ public:
   //! source of geometry data. If UseTriangulation = Standard_False,
   //! exact geometry objects (surfaces) are used, 
   //! otherwise face triangulations are used first.
+  //! IsParallel is a flag to compute properties of the faces in parallel;
+  //! the result does not depend on this flag and on the number of threads.
   Standard_EXPORT static void SurfaceProperties(const TopoDS_Shape& S, GProp_GProps& SProps, 
                                          const Standard_Boolean SkipShared = Standard_False,
-                                  const Standard_Boolean UseTriangulation = Standard_False);
+                                  const Standard_Boolean UseTriangulation = Standard_False,
+                                  const Standard_Boolean IsParallel = Standard_False);
   
   //! Updates <SProps> with the shape <S>, that contains its principal properties.
   //! The surface properties of all the faces in <S> are computed.
@@ -147,8 +150,11 @@ public:
   //! shared topological entities or not
   //! For ex., if SkipShared = True, faces, shared by two or more shells, 
   //! are taken into calculation only once.
+  //! IsParallel is a flag to compute properties of the faces in parallel;
+  //! the result does not depend on this flag and on the number of threads.
   Standard_EXPORT static Standard_Real SurfaceProperties (const TopoDS_Shape& S, GProp_GProps& SProps,
-                        const Standard_Real Eps, const Standard_Boolean SkipShared = Standard_False);
+                        const Standard_Real Eps, const Standard_Boolean SkipShared = Standard_False,
+                        const Standard_Boolean IsParallel = Standard_False);
   //!
   //! Computes the global volume properties of the solid
   //! S, and brings them together with the global
@@ -191,10 +197,13 @@ public:
   //! source of geometry data. If UseTriangulation = Standard_False,
   //! exact geometry objects (surfaces) are used, 
   //! otherwise face triangulations are used first.
+  //! IsParallel is a flag to compute properties of the faces in parallel;
+  //! the result does not depend on this flag and on the number of threads.
   Standard_EXPORT static void VolumeProperties(const TopoDS_Shape& S, GProp_GProps& VProps, 
                                         const Standard_Boolean OnlyClosed = Standard_False, 
                                         const Standard_Boolean SkipShared = Standard_False,
-                                 const Standard_Boolean UseTriangulation = Standard_False);
+                                 const Standard_Boolean UseTriangulation = Standard_False,
+                                 const Standard_Boolean IsParallel = Standard_False);
   
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -210,9 +219,12 @@ public:
   //! For ex., if SkipShared = True, the volumes formed by the equal 
   //! (the same TShape, location and orientation) 
   //! faces are taken into calculation only once.
+  //! IsParallel is a flag to compute properties of the faces in parallel;
+  //! the result does not depend on this flag and on the number of threads.
   Standard_EXPORT static Standard_Real VolumeProperties (const TopoDS_Shape& S, GProp_GProps& VProps, 
                          const Standard_Real Eps, const Standard_Boolean OnlyClosed = Standard_False, 
-                                                 const Standard_Boolean SkipShared = Standard_False);
+                                                 const Standard_Boolean SkipShared = Standard_False,
+                                                 const Standard_Boolean IsParallel = Standard_False);
   
   //! Updates <VProps> with the shape <S>, that contains its principal properties.
   //! The volume properties of all the FORWARD and REVERSED faces in <S> are computed.
@@ -0,0 +1,764 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_ChangeTracker.hxx>
+
+#include <BRep_Builder.hxx>
+#include <BRep_CurveRepresentation.hxx>
+#include <BRep_GCurve.hxx>
+#include <BRep_ListIteratorOfListOfCurveRepresentation.hxx>
+#include <BRep_TEdge.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepAdaptor_Surface.hxx>
+#include <BRepTools.hxx>
+#include <Geom_BezierCurve.hxx>
+#include <Geom_BezierSurface.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_OffsetCurve.hxx>
+#include <Geom_OffsetSurface.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_SweptSurface.hxx>
+#include <Geom_TrimmedCurve.hxx>
+#include <Geom2d_BezierCurve.hxx>
+#include <Geom2d_BSplineCurve.hxx>
+#include <Geom2d_OffsetCurve.hxx>
+#include <Geom2d_TrimmedCurve.hxx>
+#include <IMeshData_Edge.hxx>
+#include <IMeshData_Face.hxx>
+#include <IMeshData_PCurve.hxx>
+#include <NCollection_Map.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <Precision.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_ChangeTracker, Standard_Transient)
+
+namespace
+{
+  //! Checks whether two signatures are identical.
+  Standard_Boolean isSameSignature (const NCollection_Sequence<Standard_Real>& theSignature1,
+                                    const NCollection_Sequence<Standard_Real>& theSignature2)
+  {
+    if (theSignature1.Length() != theSignature2.Length())
+    {
+      return Standard_False;
+    }
+
+    NCollection_Sequence<Standard_Real>::Iterator aIt1 (theSignature1);
+    NCollection_Sequence<Standard_Real>::Iterator aIt2 (theSignature2);
+    for (; aIt1.More(); aIt1.Next(), aIt2.Next())
+    {
+      if (aIt1.Value() != aIt2.Value())
+      {
+        return Standard_False;
+      }
+    }
+    return Standard_True;
+  }
+
+  //! Number of samples along each parametric direction used for signature of geometry.
+  const Standard_Integer THE_NB_SAMPLES = 5;
+
+  typedef NCollection_Sequence<Standard_Real> Signature;
+
+  void appendXYZ (const gp_XYZ& theXYZ, Signature& theSignature)
+  {
+    theSignature.Append (theXYZ.X());
+    theSignature.Append (theXYZ.Y());
+    theSignature.Append (theXYZ.Z());
+  }
+
+  //! Appends definition data of the curve which can be modified in place.
+  void appendData (const Handle(Geom_Curve)& theCurve, Signature& theSignature)
+  {
+    if (Handle(Geom_BSplineCurve) aBSpline = Handle(Geom_BSplineCurve)::DownCast (theCurve))
+    {
+      for (Standard_Integer aPoleIt = 1; aPoleIt <= aBSpline->NbPoles(); ++aPoleIt)
+      {
+        appendXYZ (aBSpline->Pole (aPoleIt).XYZ(), theSignature);
+        theSignature.Append (aBSpline->Weight (aPoleIt));
+      }
+      for (Standard_Integer aKnotIt = 1; aKnotIt <= aBSpline->NbKnots(); ++aKnotIt)
+      {
+        theSignature.Append (aBSpline->Knot (aKnotIt));
+        theSignature.Append (aBSpline->Multiplicity (aKnotIt));
+      }
+    }
+    else if (Handle(Geom_BezierCurve) aBezier = Handle(Geom_BezierCurve)::DownCast (theCurve))
+    {
+      for (Standard_Integer aPoleIt = 1; aPoleIt <= aBezier->NbPoles(); ++aPoleIt)
+      {
+        appendXYZ (aBezier->Pole (aPoleIt).XYZ(), theSignature);
+        theSignature.Append (aBezier->Weight (aPoleIt));
+      }
+    }
+    else if (Handle(Geom_TrimmedCurve) aTrimmed = Handle(Geom_TrimmedCurve)::DownCast (theCurve))
+    {
+      appendData (aTrimmed->BasisCurve(), theSignature);
+    }
+    else if (Handle(Geom_OffsetCurve) anOffset = Handle(Geom_OffsetCurve)::DownCast (theCurve))
+    {
+      theSignature.Append (anOffset->Offset());
+      appendData (anOffset->BasisCurve(), theSignature);
+    }
+  }
+
+  //! Appends definition data of the 2d curve which can be modified in place.
+  void appendData (const Handle(Geom2d_Curve)& theCurve, Signature& theSignature)
+  {
+    if (Handle(Geom2d_BSplineCurve) aBSpline = Handle(Geom2d_BSplineCurve)::DownCast (theCurve))
+    {
+      for (Standard_Integer aPoleIt = 1; aPoleIt <= aBSpline->NbPoles(); ++aPoleIt)
+      {
+        theSignature.Append (aBSpline->Pole (aPoleIt).X());
+        theSignature.Append (aBSpline->Pole (aPoleIt).Y());
+        theSignature.Append (aBSpline->Weight (aPoleIt));
+      }
+      for (Standard_Integer aKnotIt = 1; aKnotIt <= aBSpline->NbKnots(); ++aKnotIt)
+      {
+        theSignature.Append (aBSpline->Knot (aKnotIt));
+        theSignature.Append (aBSpline->Multiplicity (aKnotIt));
+      }
+    }
+    else if (Handle(Geom2d_BezierCurve) aBezier = Handle(Geom2d_BezierCurve)::DownCast (theCurve))
+    {
+      for (Standard_Integer aPoleIt = 1; aPoleIt <= aBezier->NbPoles(); ++aPoleIt)
+      {
+        theSignature.Append (aBezier->Pole (aPoleIt).X());
+        theSignature.Append (aBezier->Pole (aPoleIt).Y());
+        theSignature.Append (aBezier->Weight (aPoleIt));
+      }
+    }
+    else if (Handle(Geom2d_TrimmedCurve) aTrimmed = Handle(Geom2d_TrimmedCurve)::DownCast (theCurve))
+    {
+      appendData (aTrimmed->BasisCurve(), theSignature);
+    }
+    else if (Handle(Geom2d_OffsetCurve) anOffset = Handle(Geom2d_OffsetCurve)::DownCast (theCurve))
+    {
+      theSignature.Append (anOffset->Offset());
+      appendData (anOffset->BasisCurve(), theSignature);
+    }
+  }
+
+  //! Appends definition data of the surface which can be modified in place.
+  void appendData (const Handle(Geom_Surface)& theSurface, Signature& theSignature)
+  {
+    if (Handle(Geom_BSplineSurface) aBSpline = Handle(Geom_BSplineSurface)::DownCast (theSurface))
+    {
+      for (Standard_Integer aUIt = 1; aUIt <= aBSpline->NbUPoles(); ++aUIt)
+      {
+        for (Standard_Integer aVIt = 1; aVIt <= aBSpline->NbVPoles(); ++aVIt)
+        {
+          appendXYZ (aBSpline->Pole (aUIt, aVIt).XYZ(), theSignature);
+          theSignature.Append (aBSpline->Weight (aUIt, aVIt));
+        }
+      }
+      for (Standard_Integer aKnotIt = 1; aKnotIt <= aBSpline->NbUKnots(); ++aKnotIt)
+      {
+        theSignature.Append (aBSpline->UKnot (aKnotIt));
+        theSignature.Append (aBSpline->UMultiplicity (aKnotIt));
+      }
+      for (Standard_Integer aKnotIt = 1; aKnotIt <= aBSpline->NbVKnots(); ++aKnotIt)
+      {
+        theSignature.Append (aBSpline->VKnot (aKnotIt));
+        theSignature.Append (aBSpline->VMultiplicity (aKnotIt));
+      }
+    }
+    else if (Handle(Geom_BezierSurface) aBezier = Handle(Geom_BezierSurface)::DownCast (theSurface))
+    {
+      for (Standard_Integer aUIt = 1; aUIt <= aBezier->NbUPoles(); ++aUIt)
+      {
+        for (Standard_Integer aVIt = 1; aVIt <= aBezier->NbVPoles(); ++aVIt)
+        {
+          appendXYZ (aBezier->Pole (aUIt, aVIt).XYZ(), theSignature);
+          theSignature.Append (aBezier->Weight (aUIt, aVIt));
+        }
+      }
+    }
+    else if (Handle(Geom_RectangularTrimmedSurface) aTrimmed = Handle(Geom_RectangularTrimmedSurface)::DownCast (theSurface))
+    {
+      appendData (aTrimmed->BasisSurface(), theSignature);
+    }
+    else if (Handle(Geom_OffsetSurface) anOffset = Handle(Geom_OffsetSurface)::DownCast (theSurface))
+    {
+      theSignature.Append (anOffset->Offset());
+      appendData (anOffset->BasisSurface(), theSignature);
+    }
+    else if (Handle(Geom_SweptSurface) aSwept = Handle(Geom_SweptSurface)::DownCast (theSurface))
+    {
+      appendXYZ (aSwept->Direction().XYZ(), theSignature);
+      appendData (aSwept->BasisCurve(), theSignature);
+    }
+  }
+
+  //! Checks that the parameter range can be sampled.
+  Standard_Boolean isFinite (const Standard_Real theFirst, const Standard_Real theLast)
+  {
+    return !Precision::IsInfinite (theFirst) && !Precision::IsInfinite (theLast);
+  }
+
+  //! Appends points of the curve sampled over the given range.
+  //! Catches in-place modifications of the analytic geometry (radius, position, etc.).
+  void appendSamples (const Handle(Geom_Curve)& theCurve,
+                      const Standard_Real       theFirst,
+                      const Standard_Real       theLast,
+                      Signature&                theSignature)
+  {
+    if (!isFinite (theFirst, theLast))
+    {
+      return;
+    }
+
+    const Standard_Real aStep = (theLast - theFirst) / (THE_NB_SAMPLES - 1);
+    for (Standard_Integer aSampleIt = 0; aSampleIt < THE_NB_SAMPLES; ++aSampleIt)
+    {
+      appendXYZ (theCurve->Value (theFirst + aStep * aSampleIt).XYZ(), theSignature);
+    }
+  }
+
+  //! Appends points of the 2d curve sampled over the given range.
+  void appendSamples (const Handle(Geom2d_Curve)& theCurve,
+                      const Standard_Real         theFirst,
+                      const Standard_Real         theLast,
+                      Signature&                  theSignature)
+  {
+    if (!isFinite (theFirst, theLast))
+    {
+      return;
+    }
+
+    const Standard_Real aStep = (theLast - theFirst) / (THE_NB_SAMPLES - 1);
+    for (Standard_Integer aSampleIt = 0; aSampleIt < THE_NB_SAMPLES; ++aSampleIt)
+    {
+      const gp_Pnt2d aPnt = theCurve->Value (theFirst + aStep * aSampleIt);
+      theSignature.Append (aPnt.X());
+      theSignature.Append (aPnt.Y());
+    }
+  }
+
+  //! Appends points of the surface sampled over the given parametric bounds.
+  void appendSamples (const Handle(Geom_Surface)& theSurface,
+                      const Standard_Real         theUMin,
+                      const Standard_Real         theUMax,
+                      const Standard_Real         theVMin,
+                      const Standard_Real         theVMax,
+                      Signature&                  theSignature)
+  {
+    if (!isFinite (theUMin, theUMax) || !isFinite (theVMin, theVMax))
+    {
+      return;
+    }
+
+    const Standard_Real aUStep = (theUMax - theUMin) / (THE_NB_SAMPLES - 1);
+    const Standard_Real aVStep = (theVMax - theVMin) / (THE_NB_SAMPLES - 1);
+    for (Standard_Integer aUIt = 0; aUIt < THE_NB_SAMPLES; ++aUIt)
+    {
+      for (Standard_Integer aVIt = 0; aVIt < THE_NB_SAMPLES; ++aVIt)
+      {
+        appendXYZ (theSurface->Value (theUMin + aUStep * aUIt,
+                                      theVMin + aVStep * aVIt).XYZ(), theSignature);
+      }
+    }
+  }
+}
+
+//=======================================================================
+// Function: Constructor
+// Purpose :
+//=======================================================================
+BRepMesh_ChangeTracker::BRepMesh_ChangeTracker()
+  : myAppliedModel (NULL),
+    myNbModifiedEdges (0),
+    myNbModifiedFaces (0),
+    myNbRestoredFaces (0)
+{
+}
+
+//=======================================================================
+// Function: Destructor
+// Purpose :
+//=======================================================================
+BRepMesh_ChangeTracker::~BRepMesh_ChangeTracker()
+{
+}
+
+//=======================================================================
+// Function: Apply
+// Purpose :
+//=======================================================================
+void BRepMesh_ChangeTracker::Apply (const Handle(IMeshData_Model)& theModel,
+                                    const IMeshTools_Parameters&   theParameters)
+{
+  myNbModifiedEdges = 0;
+  myNbModifiedFaces = 0;
+  myNbRestoredFaces = 0;
+  myAppliedModel    = NULL;
+  if (theModel.IsNull())
+  {
+    return;
+  }
+
+  // Tessellation of all edges depends on the edge parameters.
+  const Standard_Boolean isEdgeParametersChanged = !IsEmpty() && !isSameForEdges (myParameters, theParameters);
+
+  // Find edges modified in place and collect faces adjacent to them.
+  // The collected state is kept to be recorded by Update() after meshing.
+  NCollection_DataMap<TopoDS_Shape, EdgeState, TopTools_ShapeMapHasher> aEdges;
+  NCollection_Map<const IMeshData_Face*> aAdjacentFaces;
+  for (Standard_Integer aEdgeIt = 0; aEdgeIt < theModel->EdgesNb(); ++aEdgeIt)
+  {
+    const IMeshData::IEdgeHandle& aDEdge = theModel->GetEdge (aEdgeIt);
+    const TopoDS_Edge& aEdge = aDEdge->GetEdge();
+    if (aEdge.IsNull() || aEdges.IsBound (aEdge))
+    {
+      continue;
+    }
+
+    EdgeState& aNewState = *aEdges.Bound (aEdge, EdgeState());
+    makeState (aEdge, aNewState);
+
+    const EdgeState* aOldState = myEdges.Seek (aEdge);
+    if (aOldState == NULL)
+    {
+      // New edge, nothing to compare with.
+      continue;
+    }
+
+    if (!isEdgeParametersChanged && isSame (*aOldState, aNewState))
+    {
+      continue;
+    }
+
+    ++myNbModifiedEdges;
+    aDEdge->SetStatus (IMeshData_Outdated);
+    for (Standard_Integer aPCurveIt = 0; aPCurveIt < aDEdge->PCurvesNb(); ++aPCurveIt)
+    {
+      aAdjacentFaces.Add (aDEdge->GetPCurve (aPCurveIt)->GetFace());
+    }
+  }
+
+  NCollection_DataMap<TopoDS_Shape, FaceState, TopTools_ShapeMapHasher> aFaces;
+  for (Standard_Integer aFaceIt = 0; aFaceIt < theModel->FacesNb(); ++aFaceIt)
+  {
+    const IMeshData::IFaceHandle& aDFace = theModel->GetFace (aFaceIt);
+    const TopoDS_Face& aFace = aDFace->GetFace();
+    if (aFace.IsNull() || aFaces.IsBound (aFace))
+    {
+      continue;
+    }
+
+    FaceState& aNewState = *aFaces.Bound (aFace, FaceState());
+    makeState (aFace, aNewState);
+
+    const FaceState* aOldState = myFaces.Seek (aFace);
+    if (aOldState == NULL || aOldState->Triangulation.IsNull())
+    {
+      // There is no tessellation recorded for the face.
+      continue;
+    }
+
+    // Triangulation is not consistent with the regenerated boundary anyway.
+    const Standard_Boolean isModified = aAdjacentFaces.Contains (aDFace.get())
+      || !isSameForFace (myParameters, theParameters, aDFace->GetSurface()->GetType())
+      || !isSame (*aOldState, aNewState);
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (aTriangulation.IsNull())
+    {
+      // Face has lost its triangulation (e.g. cleaned by BRepTools::Clean()),
+      // the recorded one is still valid if the face has not been modified.
+      if (!isModified && restore (aFace, *aOldState))
+      {
+        ++myNbRestoredFaces;
+      }
+      continue;
+    }
+
+    if (aOldState->Triangulation != aTriangulation)
+    {
+      // Triangulation has not been produced by the tracked run,
+      // there is nothing to judge it by.
+      continue;
+    }
+
+    if (isModified)
+    {
+      // Existing triangulation does not correspond to the geometry anymore.
+      ++myNbModifiedFaces;
+      aDFace->SetStatus (IMeshData_Outdated);
+    }
+  }
+
+  // Tessellation of the previous run is not needed anymore,
+  // it is either kept by the shape or going to be regenerated.
+  myEdges.Exchange (aEdges);
+  myFaces.Exchange (aFaces);
+  myAppliedModel = theModel.get();
+}
+
+//=======================================================================
+// Function: Update
+// Purpose :
+//=======================================================================
+void BRepMesh_ChangeTracker::Update (const Handle(IMeshData_Model)& theModel,
+                                     const IMeshTools_Parameters&   theParameters)
+{
+  // Statistics of the last call of Apply() is kept.
+  const Standard_Boolean isApplied = !theModel.IsNull() && theModel.get() == myAppliedModel;
+  myAppliedModel = NULL;
+  if (!isApplied)
+  {
+    myEdges.Clear();
+    myFaces.Clear();
+  }
+
+  if (theModel.IsNull())
+  {
+    return;
+  }
+
+  myParameters = theParameters;
+
+  if (!isApplied)
+  {
+    for (Standard_Integer aEdgeIt = 0; aEdgeIt < theModel->EdgesNb(); ++aEdgeIt)
+    {
+      const TopoDS_Edge& aEdge = theModel->GetEdge (aEdgeIt)->GetEdge();
+      if (!aEdge.IsNull() && !myEdges.IsBound (aEdge))
+      {
+        makeState (aEdge, *myEdges.Bound (aEdge, EdgeState()));
+      }
+    }
+  }
+
+  for (Standard_Integer aFaceIt = 0; aFaceIt < theModel->FacesNb(); ++aFaceIt)
+  {
+    const TopoDS_Face& aFace = theModel->GetFace (aFaceIt)->GetFace();
+    if (aFace.IsNull())
+    {
+      continue;
+    }
+
+    FaceState* aState = myFaces.ChangeSeek (aFace);
+    if (aState == NULL)
+    {
+      aState = myFaces.Bound (aFace, FaceState());
+      makeState (aFace, *aState);
+    }
+    makeMeshState (aFace, *aState);
+  }
+}
+
+//=======================================================================
+// Function: Clear
+// Purpose :
+//=======================================================================
+void BRepMesh_ChangeTracker::Clear()
+{
+  myEdges.Clear();
+  myFaces.Clear();
+  myAppliedModel    = NULL;
+  myNbModifiedEdges = 0;
+  myNbModifiedFaces = 0;
+  myNbRestoredFaces = 0;
+}
+
+//=======================================================================
+// Function: makeState
+// Purpose :
+//=======================================================================
+void BRepMesh_ChangeTracker::makeState (const TopoDS_Edge& theEdge,
+                                        EdgeState&         theState)
+{
+  const BRep_TEdge* aTEdge = static_cast<const BRep_TEdge*> (theEdge.TShape().get());
+  theState.Tolerance = aTEdge->Tolerance();
+  BRep_Tool::Range (theEdge, theState.First, theState.Last);
+
+  // Polygonal representations are produced by meshing itself, thus only curves are tracked.
+  for (BRep_ListIteratorOfListOfCurveRepresentation aRepIt (aTEdge->Curves()); aRepIt.More(); aRepIt.Next())
+  {
+    const Handle(BRep_CurveRepresentation)& aRep = aRepIt.Value();
+    GeomRef aRef;
+    aRef.Location = aRep->Location();
+    if (aRep->IsCurve3D())
+    {
+      aRef.Geometry = aRep->Curve3D();
+      theState.Geometry.Append (aRef);
+      if (!aRep->Curve3D().IsNull())
+      {
+        Standard_Real aFirst, aLast;
+        Handle(BRep_GCurve)::DownCast (aRep)->Range (aFirst, aLast);
+        appendData    (aRep->Curve3D(), theState.Signature);
+        appendSamples (aRep->Curve3D(), aFirst, aLast, theState.Signature);
+      }
+    }
+    else if (aRep->IsCurveOnSurface())
+    {
+      Standard_Real aFirst, aLast;
+      Handle(BRep_GCurve)::DownCast (aRep)->Range (aFirst, aLast);
+      aRef.Geometry = aRep->Surface();
+      theState.Geometry.Append (aRef);
+      aRef.Geometry = aRep->PCurve();
+      theState.Geometry.Append (aRef);
+      appendData    (aRep->PCurve(), theState.Signature);
+      appendSamples (aRep->PCurve(), aFirst, aLast, theState.Signature);
+      if (aRep->IsCurveOnClosedSurface())
+      {
+        aRef.Geometry = aRep->PCurve2();
+        theState.Geometry.Append (aRef);
+        appendData    (aRep->PCurve2(), theState.Signature);
+        appendSamples (aRep->PCurve2(), aFirst, aLast, theState.Signature);
+      }
+    }
+  }
+
+  for (TopoDS_Iterator aVertexIt (theEdge, Standard_False); aVertexIt.More(); aVertexIt.Next())
+  {
+    if (aVertexIt.Value().ShapeType() == TopAbs_VERTEX)
+    {
+      theState.Points.Append (BRep_Tool::Pnt (TopoDS::Vertex (aVertexIt.Value())));
+    }
+  }
+}
+
+//=======================================================================
+// Function: makeState
+// Purpose :
+//=======================================================================
+void BRepMesh_ChangeTracker::makeState (const TopoDS_Face& theFace,
+                                        FaceState&         theState)
+{
+  const Handle(Geom_Surface)& aSurface = BRep_Tool::Surface (theFace, theState.Surface.Location);
+  theState.Surface.Geometry = aSurface;
+  theState.Tolerance        = BRep_Tool::Tolerance (theFace);
+  if (!aSurface.IsNull())
+  {
+    Standard_Real aUMin, aUMax, aVMin, aVMax;
+    BRepTools::UVBounds (theFace, aUMin, aUMax, aVMin, aVMax);
+    appendData    (aSurface, theState.Signature);
+    appendSamples (aSurface, aUMin, aUMax, aVMin, aVMax, theState.Signature);
+  }
+  for (TopExp_Explorer aEdgeIt (theFace, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+  {
+    theState.Edges.Append (aEdgeIt.Current());
+  }
+}
+
+//=======================================================================
+// Function: makeMeshState
+// Purpose :
+//=======================================================================
+void BRepMesh_ChangeTracker::makeMeshState (const TopoDS_Face& theFace,
+                                            FaceState&         theState)
+{
+  theState.Polygons.Clear();
+  theState.Triangulation = BRep_Tool::Triangulation (theFace, theState.TriangulationLocation);
+  if (theState.Triangulation.IsNull())
+  {
+    return;
+  }
+
+  TopTools_MapOfShape aEdges;
+  for (TopTools_ListOfShape::Iterator aEdgeIt (theState.Edges); aEdgeIt.More(); aEdgeIt.Next())
+  {
+    if (!aEdges.Add (aEdgeIt.Value()))
+    {
+      // Seam edge is processed at once for both orientations.
+      continue;
+    }
+
+    EdgePolygons aPolygons;
+    aPolygons.Edge     = TopoDS::Edge (aEdgeIt.Value().Oriented (TopAbs_FORWARD));
+    aPolygons.Polygon1 = BRep_Tool::PolygonOnTriangulation (aPolygons.Edge, theState.Triangulation,
+                                                            theState.TriangulationLocation);
+    if (BRep_Tool::IsClosed (aPolygons.Edge, theState.Triangulation, theState.TriangulationLocation))
+    {
+      aPolygons.Polygon2 = BRep_Tool::PolygonOnTriangulation (TopoDS::Edge (aPolygons.Edge.Reversed()),
+                                                              theState.Triangulation,
+                                                              theState.TriangulationLocation);
+    }
+    theState.Polygons.Append (aPolygons);
+  }
+}
+
+//=======================================================================
+// Function: restore
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_ChangeTracker::restore (const TopoDS_Face& theFace,
+                                                  const FaceState&   theState)
+{
+  for (NCollection_Sequence<EdgePolygons>::Iterator aPolyIt (theState.Polygons); aPolyIt.More(); aPolyIt.Next())
+  {
+    if (aPolyIt.Value().Polygon1.IsNull())
+    {
+      return Standard_False;
+    }
+  }
+
+  BRep_Builder aBuilder;
+  aBuilder.UpdateFace (theFace, theState.Triangulation);
+  for (NCollection_Sequence<EdgePolygons>::Iterator aPolyIt (theState.Polygons); aPolyIt.More(); aPolyIt.Next())
+  {
+    const EdgePolygons& aPolygons = aPolyIt.Value();
+    if (aPolygons.Polygon2.IsNull())
+    {
+      aBuilder.UpdateEdge (aPolygons.Edge, aPolygons.Polygon1,
+                           theState.Triangulation, theState.TriangulationLocation);
+    }
+    else
+    {
+      aBuilder.UpdateEdge (aPolygons.Edge, aPolygons.Polygon1, aPolygons.Polygon2,
+                           theState.Triangulation, theState.TriangulationLocation);
+    }
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+// Function: isSame
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_ChangeTracker::isSame (const EdgeState& theState1,
+                                                 const EdgeState& theState2)
+{
+  if (theState1.Tolerance != theState2.Tolerance ||
+      theState1.First     != theState2.First     ||
+      theState1.Last      != theState2.Last      ||
+      theState1.Geometry.Length() != theState2.Geometry.Length() ||
+      theState1.Points  .Length() != theState2.Points  .Length() ||
+     !isSameSignature (theState1.Signature, theState2.Signature))
+  {
+    return Standard_False;
+  }
+
+  NCollection_Sequence<GeomRef>::Iterator aRefIt1 (theState1.Geometry);
+  NCollection_Sequence<GeomRef>::Iterator aRefIt2 (theState2.Geometry);
+  for (; aRefIt1.More(); aRefIt1.Next(), aRefIt2.Next())
+  {
+    if (aRefIt1.Value().Geometry != aRefIt2.Value().Geometry ||
+       !aRefIt1.Value().Location.IsEqual (aRefIt2.Value().Location))
+    {
+      return Standard_False;
+    }
+  }
+
+  NCollection_Sequence<gp_Pnt>::Iterator aPntIt1 (theState1.Points);
+  NCollection_Sequence<gp_Pnt>::Iterator aPntIt2 (theState2.Points);
+  for (; aPntIt1.More(); aPntIt1.Next(), aPntIt2.Next())
+  {
+    if (aPntIt1.Value().SquareDistance (aPntIt2.Value()) > 0.)
+    {
+      return Standard_False;
+    }
+  }
+
+  return Standard_True;
+}
+
+//=======================================================================
+// Function: isSame
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_ChangeTracker::isSame (const FaceState& theState1,
+                                                 const FaceState& theState2)
+{
+  if (theState1.Surface.Geometry != theState2.Surface.Geometry              ||
+     !theState1.Surface.Location.IsEqual (theState2.Surface.Location)       ||
+      theState1.Tolerance       != theState2.Tolerance                      ||
+      theState1.Edges.Extent()  != theState2.Edges.Extent()                 ||
+     !isSameSignature (theState1.Signature, theState2.Signature))
+  {
+    return Standard_False;
+  }
+
+  TopTools_ListOfShape::Iterator aEdgeIt1 (theState1.Edges);
+  TopTools_ListOfShape::Iterator aEdgeIt2 (theState2.Edges);
+  for (; aEdgeIt1.More(); aEdgeIt1.Next(), aEdgeIt2.Next())
+  {
+    if (!aEdgeIt1.Value().IsEqual (aEdgeIt2.Value()))
+    {
+      return Standard_False;
+    }
+  }
+
+  return Standard_True;
+}
+
+//=======================================================================
+// Function: isSameForEdges
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_ChangeTracker::isSameForEdges (const IMeshTools_Parameters& theParams1,
+                                                         const IMeshTools_Parameters& theParams2)
+{
+  // Deflection, relative mode and quality decrease are checked by consistency check
+  // of the tessellation, parallelism and cleaning of the model do not affect the result.
+  return theParams1.Angle         == theParams2.Angle
+      && theParams1.MinSize       == theParams2.MinSize
+      && theParams1.AdjustMinSize == theParams2.AdjustMinSize;
+}
+
+//=======================================================================
+// Function: isSameForFace
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_ChangeTracker::isSameForFace (const IMeshTools_Parameters& theParams1,
+                                                        const IMeshTools_Parameters& theParams2,
+                                                        const GeomAbs_SurfaceType    theSurfaceType)
+{
+  if (theParams1.MeshAlgo != theParams2.MeshAlgo)
+  {
+    return Standard_False;
+  }
+
+  // Internal vertices mode selects the algorithm for planes and cylinders only,
+  // planes have no interior nodes in any case.
+  if (theSurfaceType == GeomAbs_Plane ||
+      theSurfaceType == GeomAbs_Cylinder)
+  {
+    if (theParams1.InternalVerticesMode != theParams2.InternalVerticesMode)
+    {
+      return Standard_False;
+    }
+    if (theSurfaceType == GeomAbs_Plane || !theParams1.InternalVerticesMode)
+    {
+      return Standard_True;
+    }
+  }
+
+  // Interior deflection follows the deflection, thus only their ratio is compared.
+  if (theParams1.DeflectionInterior * theParams2.Deflection != theParams2.DeflectionInterior * theParams1.Deflection ||
+      theParams1.ForceFaceDeflection != theParams2.ForceFaceDeflection)
+  {
+    return Standard_False;
+  }
+
+  // Interior angle and control of surface deflection are used by
+  // the algorithm controlling deflection of free-form surfaces only.
+  switch (theSurfaceType)
+  {
+    case GeomAbs_Cylinder:
+    case GeomAbs_Sphere:
+    case GeomAbs_Cone:
+    case GeomAbs_Torus:
+      return Standard_True;
+    default:
+      return theParams1.AngleInterior            == theParams2.AngleInterior
+          && theParams1.ControlSurfaceDeflection == theParams2.ControlSurfaceDeflection;
+  }
+}
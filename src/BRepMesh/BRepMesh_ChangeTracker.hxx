@@ -0,0 +1,214 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_ChangeTracker_HeaderFile
+#define _BRepMesh_ChangeTracker_HeaderFile
+
+#include <IMeshData_Model.hxx>
+#include <IMeshTools_Parameters.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Sequence.hxx>
+#include <Standard_Transient.hxx>
+#include <TopLoc_Location.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopTools_ShapeMapHasher.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <GeomAbs_SurfaceType.hxx>
+#include <TopoDS_Edge.hxx>
+#include <gp_Pnt.hxx>
+
+//! Tracks modifications of the shape between successive meshing runs
+//! performed with the same context (see BRepMesh_Context::SetChangeTracker()).
+//!
+//! After each run the tracker records the meshing parameters and the state of
+//! the meshed edges and faces: geometry attached to them (curves, pcurves, surfaces
+//! and their locations), tolerances, parameter ranges, vertices, the list of edges
+//! of each face and the tessellation produced for it (triangulation of the face and
+//! polygons of its edges on this triangulation). Besides identity of the geometric
+//! objects, their contents are recorded as well (poles, weights and knots of B-spline
+//! and Bezier geometry, points sampled over the used parameter range), so that
+//! modification of the geometry in place (e.g. Geom_BSplineSurface::SetPole())
+//! is detected too.
+//! Before the next run the discrete model of the shape is compared with the
+//! recorded state. The entities are identified by their TShape and location,
+//! so that the edges and faces shared between the old and the new shape are
+//! matched, while the newly created ones are meshed in usual way.
+//! The state of the geometry is collected once per run, before meshing,
+//! and only the tessellation is added to it after meshing.
+//!
+//! The edge is considered as modified if its geometry has been changed in place
+//! (e.g. by BRep_Builder::UpdateEdge() or by movement of its vertex). The face is
+//! considered as modified if its surface or its boundary has been changed in place
+//! or if it is adjacent to the modified edge. Existing polygons of the modified edges
+//! and triangulations of the modified faces are considered as outdated and
+//! regenerated, the data of all other entities is reused as far as it fits
+//! the meshing parameters.
+//!
+//! The unmodified faces which have lost their triangulation since the tracked run
+//! (e.g. by BRepTools::Clean()) get the recorded tessellation back instead of being
+//! meshed from scratch. The faces with triangulation attached by other means after
+//! the tracked run are processed in usual way.
+//!
+//! Change of the meshing parameters makes outdated only the tessellation depending on them:
+//! - angular deflection and minimal size (edge parameters) affect all edges and thus all faces;
+//! - meshing algorithm affects all faces, but not the edges;
+//! - interior deflection, forced face deflection, interior angle, control of surface
+//!   deflection and insertion of internal vertices affect only the faces of the surface
+//!   types meshed with interior nodes depending on them (e.g. planar faces are not affected).
+//! Change of the deflection is processed in usual way by the consistency check
+//! of existing tessellation.
+class BRepMesh_ChangeTracker : public Standard_Transient
+{
+public:
+
+  //! Constructor.
+  Standard_EXPORT BRepMesh_ChangeTracker();
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepMesh_ChangeTracker();
+
+  //! Compares the discrete model with the recorded state, marks the modified
+  //! edges and faces having existing tessellation as outdated and restores
+  //! the recorded tessellation of unmodified faces which have lost it.
+  //! The tessellation depending on the parameters which differ from
+  //! the recorded ones is considered as outdated as well.
+  //! The state of the model collected here is reused by the following Update().
+  Standard_EXPORT void Apply (const Handle(IMeshData_Model)& theModel,
+                              const IMeshTools_Parameters&   theParameters);
+
+  //! Records the meshing parameters and the state of edges and faces of the meshed model.
+  //! The state of geometry collected by Apply() for the same model is reused,
+  //! otherwise the previously recorded state is discarded and collected anew.
+  Standard_EXPORT void Update (const Handle(IMeshData_Model)& theModel,
+                               const IMeshTools_Parameters&   theParameters);
+
+  //! Discards the recorded state.
+  Standard_EXPORT void Clear();
+
+  //! Returns true if there is no recorded state.
+  Standard_Boolean IsEmpty() const
+  {
+    return myEdges.IsEmpty() && myFaces.IsEmpty();
+  }
+
+  //! Returns number of edges detected as modified by the last call of Apply().
+  Standard_Integer NbModifiedEdges() const
+  {
+    return myNbModifiedEdges;
+  }
+
+  //! Returns number of faces marked as outdated by the last call of Apply().
+  Standard_Integer NbModifiedFaces() const
+  {
+    return myNbModifiedFaces;
+  }
+
+  //! Returns number of faces which have got the recorded tessellation back
+  //! by the last call of Apply().
+  Standard_Integer NbRestoredFaces() const
+  {
+    return myNbRestoredFaces;
+  }
+
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_ChangeTracker, Standard_Transient)
+
+private:
+
+  //! Geometric entity referenced by topology together with its location.
+  struct GeomRef
+  {
+    Handle(Standard_Transient) Geometry;
+    TopLoc_Location            Location;
+  };
+
+  //! Recorded state of an edge.
+  struct EdgeState
+  {
+    NCollection_Sequence<GeomRef> Geometry;
+    NCollection_Sequence<gp_Pnt>  Points;
+    NCollection_Sequence<Standard_Real> Signature;
+    Standard_Real                 Tolerance;
+    Standard_Real                 First;
+    Standard_Real                 Last;
+
+    EdgeState() : Tolerance (0.), First (0.), Last (0.) {}
+  };
+
+  //! Recorded polygons of an edge on the triangulation of the face.
+  struct EdgePolygons
+  {
+    TopoDS_Edge                         Edge;
+    Handle(Poly_PolygonOnTriangulation) Polygon1;
+    Handle(Poly_PolygonOnTriangulation) Polygon2; //!< defined for closed edges only
+  };
+
+  //! Recorded state of a face.
+  struct FaceState
+  {
+    GeomRef                      Surface;
+    TopTools_ListOfShape         Edges;
+    NCollection_Sequence<Standard_Real> Signature;
+    Handle(Poly_Triangulation)   Triangulation;
+    TopLoc_Location              TriangulationLocation;
+    NCollection_Sequence<EdgePolygons> Polygons;
+    Standard_Real                Tolerance;
+
+    FaceState() : Tolerance (0.) {}
+  };
+
+  //! Collects state of the given edge.
+  static void makeState (const TopoDS_Edge& theEdge, EdgeState& theState);
+
+  //! Collects state of geometry of the given face.
+  static void makeState (const TopoDS_Face& theFace, FaceState& theState);
+
+  //! Collects tessellation of the given face and its edges.
+  static void makeMeshState (const TopoDS_Face& theFace, FaceState& theState);
+
+  //! Attaches the recorded tessellation to the face and its edges.
+  //! Returns false if the recorded tessellation is incomplete.
+  static Standard_Boolean restore (const TopoDS_Face& theFace, const FaceState& theState);
+
+  //! Checks whether two states of edge are the same.
+  static Standard_Boolean isSame (const EdgeState& theState1, const EdgeState& theState2);
+
+  //! Checks whether two states of face are the same.
+  static Standard_Boolean isSame (const FaceState& theState1, const FaceState& theState2);
+
+  //! Checks whether two sets of parameters produce the same tessellation of edges
+  //! provided that the deflection is checked separately.
+  static Standard_Boolean isSameForEdges (const IMeshTools_Parameters& theParams1,
+                                          const IMeshTools_Parameters& theParams2);
+
+  //! Checks whether two sets of parameters produce the same triangulation of face
+  //! with the given type of surface provided that the deflection and the edges
+  //! are checked separately.
+  static Standard_Boolean isSameForFace (const IMeshTools_Parameters& theParams1,
+                                         const IMeshTools_Parameters& theParams2,
+                                         const GeomAbs_SurfaceType    theSurfaceType);
+
+private:
+
+  NCollection_DataMap<TopoDS_Shape, EdgeState, TopTools_ShapeMapHasher> myEdges;
+  NCollection_DataMap<TopoDS_Shape, FaceState, TopTools_ShapeMapHasher> myFaces;
+  IMeshTools_Parameters myParameters;
+  const IMeshData_Model* myAppliedModel; //!< model whose state has been collected by Apply()
+  Standard_Integer myNbModifiedEdges;
+  Standard_Integer myNbModifiedFaces;
+  Standard_Integer myNbRestoredFaces;
+};
+
+DEFINE_STANDARD_HANDLE(BRepMesh_ChangeTracker, Standard_Transient)
+
+#endif
@@ -85,3 +85,41 @@ BRepMesh_Context::BRepMesh_Context (IMeshTools_MeshAlgoType theMeshType)
 BRepMesh_Context::~BRepMesh_Context ()
 {
 }
+
+//=======================================================================
+// Function: BuildModel
+// Purpose : 
+//=======================================================================
+Standard_Boolean BRepMesh_Context::BuildModel ()
+{
+  if (!IMeshTools_Context::BuildModel())
+  {
+    return Standard_False;
+  }
+
+  if (!myChangeTracker.IsNull())
+  {
+    myChangeTracker->Apply (GetModel(), GetParameters());
+  }
+
+  return Standard_True;
+}
+
+//=======================================================================
+// Function: PostProcessModel
+// Purpose : 
+//=======================================================================
+Standard_Boolean BRepMesh_Context::PostProcessModel ()
+{
+  if (!IMeshTools_Context::PostProcessModel())
+  {
+    return Standard_False;
+  }
+
+  if (!myChangeTracker.IsNull())
+  {
+    myChangeTracker->Update (GetModel(), GetParameters());
+  }
+
+  return Standard_True;
+}
@@ -17,6 +17,7 @@
 #define _BRepMesh_Context_HeaderFile
 
 #include <IMeshTools_Context.hxx>
+#include <BRepMesh_ChangeTracker.hxx>
 
 //! Class implementing default context of BRepMesh algorithm.
 //! Initializes context by default algorithms.
@@ -30,7 +31,39 @@ public:
   //! Destructor.
   Standard_EXPORT virtual ~BRepMesh_Context ();
 
+  //! Builds model using assigned model builder.
+  //! If change tracker is set, marks edges and faces modified
+  //! since the previous run as outdated.
+  //! @return True on success, False elsewhere.
+  Standard_EXPORT virtual Standard_Boolean BuildModel () Standard_OVERRIDE;
+
+  //! Performs post-processing of discrete model using assigned algorithm.
+  //! If change tracker is set, records the state of the meshed model.
+  //! @return True on success, False elsewhere.
+  Standard_EXPORT virtual Standard_Boolean PostProcessModel () Standard_OVERRIDE;
+
+  //! Returns tracker of shape modifications between successive runs.
+  const Handle(BRepMesh_ChangeTracker)& GetChangeTracker () const
+  {
+    return myChangeTracker;
+  }
+
+  //! Sets tracker of shape modifications between successive runs.
+  //! The tracker enables incremental re-meshing of the shape modified in place:
+  //! when the same context is used for meshing of the modified shape, the existing
+  //! polygons of modified edges and triangulations of modified faces and faces
+  //! adjacent to modified edges are regenerated, while the data of untouched
+  //! entities is reused. Null handle disables tracking (default).
+  void SetChangeTracker (const Handle(BRepMesh_ChangeTracker)& theTracker)
+  {
+    myChangeTracker = theTracker;
+  }
+
   DEFINE_STANDARD_RTTIEXT(BRepMesh_Context, IMeshTools_Context)
+
+private:
+
+  Handle(BRepMesh_ChangeTracker) myChangeTracker;
 };
 
 #endif
\ No newline at end of file
@@ -35,13 +35,14 @@ IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_CurveTessellator, IMeshTools_CurveTessellato
 //=======================================================================
 BRepMesh_CurveTessellator::BRepMesh_CurveTessellator(
   const IMeshData::IEdgeHandle& theEdge,
-  const IMeshTools_Parameters&  theParameters)
+  const IMeshTools_Parameters&  theParameters,
+  const TColStd_SequenceOfReal& theSeedParameters)
   : myDEdge(theEdge),
     myParameters(theParameters),
     myEdge(theEdge->GetEdge()),
     myCurve(myEdge)
 {
-  init();
+  init(theSeedParameters);
 }
 
 //=======================================================================
@@ -52,20 +53,21 @@ BRepMesh_CurveTessellator::BRepMesh_CurveTessellator (
   const IMeshData::IEdgeHandle& theEdge,
   const TopAbs_Orientation      theOrientation,
   const IMeshData::IFaceHandle& theFace,
-  const IMeshTools_Parameters&  theParameters)
+  const IMeshTools_Parameters&  theParameters,
+  const TColStd_SequenceOfReal& theSeedParameters)
   : myDEdge(theEdge),
     myParameters(theParameters),
     myEdge(TopoDS::Edge(theEdge->GetEdge().Oriented(theOrientation))),
     myCurve(myEdge, theFace->GetFace())
 {
-  init();
+  init(theSeedParameters);
 }
 
 //=======================================================================
 //function : init
 //purpose  : 
 //=======================================================================
-void BRepMesh_CurveTessellator::init()
+void BRepMesh_CurveTessellator::init(const TColStd_SequenceOfReal& theSeedParameters)
 {
   if (myParameters.MinSize <= 0.0)
   {
@@ -99,10 +101,17 @@ void BRepMesh_CurveTessellator::init()
 
   const Standard_Integer aMinPntNb = (myCurve.GetType() == GeomAbs_Circle) ? 4 : 2; //OCC287
 
-  myDiscretTool.Initialize (myCurve,
-                            myCurve.FirstParameter(), myCurve.LastParameter(),
-                            aPreciseAngDef, aPreciseLinDef, aMinPntNb,
-                            Precision::PConfusion(), aMinSize);
+  if (theSeedParameters.Length() > 2)
+  {
+    refineSegments (theSeedParameters, aPreciseAngDef, aPreciseLinDef, aMinSize);
+  }
+  else
+  {
+    myDiscretTool.Initialize (myCurve,
+                              myCurve.FirstParameter(), myCurve.LastParameter(),
+                              aPreciseAngDef, aPreciseLinDef, aMinPntNb,
+                              Precision::PConfusion(), aMinSize);
+  }
 
   if (myCurve.IsCurveOnSurface())
   {
@@ -124,6 +133,52 @@ void BRepMesh_CurveTessellator::init()
   splitByDeflection2d();
 }
 
+//=======================================================================
+//function : refineSegments
+//purpose  : 
+//=======================================================================
+void BRepMesh_CurveTessellator::refineSegments (
+  const TColStd_SequenceOfReal& theSeedParameters,
+  const Standard_Real           theAngDeflection,
+  const Standard_Real           theLinDeflection,
+  const Standard_Real           theMinSize)
+{
+  const Standard_Real aFirstParam = myCurve.FirstParameter();
+  const Standard_Real aLastParam  = myCurve.LastParameter();
+
+  // Seed is expected to be ordered, points out of the range are skipped.
+  TColStd_SequenceOfReal aBreaks;
+  aBreaks.Append (aFirstParam);
+  for (Standard_Integer aParamIt = 2; aParamIt < theSeedParameters.Length(); ++aParamIt)
+  {
+    const Standard_Real aParam = theSeedParameters (aParamIt);
+    if (aParam - aBreaks.Last() > Precision::PConfusion() &&
+        aLastParam - aParam     > Precision::PConfusion())
+    {
+      aBreaks.Append (aParam);
+    }
+  }
+  aBreaks.Append (aLastParam);
+
+  myDiscretTool.Initialize (myCurve, aBreaks (1), aBreaks (2),
+                            theAngDeflection, theLinDeflection, 2,
+                            Precision::PConfusion(), theMinSize);
+
+  GCPnts_TangentialDeflection aSegmentTool;
+  for (Standard_Integer aBreakIt = 2; aBreakIt < aBreaks.Length(); ++aBreakIt)
+  {
+    aSegmentTool.Initialize (myCurve, aBreaks (aBreakIt), aBreaks (aBreakIt + 1),
+                             theAngDeflection, theLinDeflection, 2,
+                             Precision::PConfusion(), theMinSize);
+
+    // The first point of the segment coincides with the last one of the previous segment.
+    for (Standard_Integer aPntIt = 2; aPntIt <= aSegmentTool.NbPoints(); ++aPntIt)
+    {
+      myDiscretTool.AddPoint (aSegmentTool.Value (aPntIt), aSegmentTool.Parameter (aPntIt));
+    }
+  }
+}
+
 //=======================================================================
 //function : Destructor
 //purpose  : 
@@ -21,6 +21,7 @@
 #include <TopoDS_Vertex.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <IMeshData_Types.hxx>
+#include <TColStd_SequenceOfReal.hxx>
 
 class Geom_Surface;
 class Geom2d_Curve;
@@ -32,16 +33,23 @@ class BRepMesh_CurveTessellator : public IMeshTools_CurveTessellator
 public:
 
   //! Constructor.
+  //! @param theSeedParameters parameters of the existing coarser discretization
+  //!        of the edge; if given, the new discretization keeps these points and
+  //!        refines each of their segments instead of discretizing the whole range.
   Standard_EXPORT BRepMesh_CurveTessellator(
     const IMeshData::IEdgeHandle& theEdge,
-    const IMeshTools_Parameters&  theParameters);
+    const IMeshTools_Parameters&  theParameters,
+    const TColStd_SequenceOfReal& theSeedParameters = TColStd_SequenceOfReal());
 
   //! Constructor.
+  //! @param theSeedParameters parameters of the existing coarser discretization
+  //!        of the edge, see the constructor above.
   Standard_EXPORT BRepMesh_CurveTessellator (
     const IMeshData::IEdgeHandle& theEdge,
     const TopAbs_Orientation      theOrientation,
     const IMeshData::IFaceHandle& theFace,
-    const IMeshTools_Parameters&  theParameters);
+    const IMeshTools_Parameters&  theParameters,
+    const TColStd_SequenceOfReal& theSeedParameters = TColStd_SequenceOfReal());
 
   //! Destructor.
   Standard_EXPORT virtual ~BRepMesh_CurveTessellator ();
@@ -64,7 +72,14 @@ public:
 private:
 
   //! Performs initialization of this tool.
-  void init();
+  void init (const TColStd_SequenceOfReal& theSeedParameters);
+
+  //! Discretizes each segment between the given seed parameters separately
+  //! and collects the points of all segments in the discretization tool.
+  void refineSegments (const TColStd_SequenceOfReal& theSeedParameters,
+                       const Standard_Real           theAngDeflection,
+                       const Standard_Real           theLinDeflection,
+                       const Standard_Real           theMinSize);
 
   //! Adds internal vertices to discrete polygon.
   void addInternalVertices ();
@@ -17,6 +17,8 @@
 #define _BRepMesh_DefaultRangeSplitter_HeaderFile
 
 #include <IMeshData_Face.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 
 struct IMeshTools_Parameters;
 
@@ -71,6 +73,14 @@ public:
     return GetSurface()->Value(thePoint2d.X(), thePoint2d.Y());
   }
 
+  //! Computes points in 3d space corresponded to the given array
+  //! of points defined in parametric space of surface.
+  void Points(const TColgp_Array1OfPnt2d& thePoints2d,
+              TColgp_Array1OfPnt&         thePoints) const
+  {
+    GetSurface()->BatchD0(thePoints2d, thePoints);
+  }
+
 protected:
 
   //! Computes parametric tolerance taking length along U and V into account.
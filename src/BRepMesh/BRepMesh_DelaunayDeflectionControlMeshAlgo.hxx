@@ -19,6 +19,10 @@
 #include <BRepMesh_DelaunayNodeInsertionMeshAlgo.hxx>
 #include <BRepMesh_GeomTool.hxx>
 #include <GeomLib.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+
+#include <vector>
 
 //! Extends node insertion Delaunay meshing algo in order to control 
 //! deflection of generated trianges. Splits triangles failing the check.
@@ -101,12 +105,20 @@ protected:
       {
         break;
       }
-      // Iterate on current triangles
-      IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
-      for (; aTriangleIt.More(); aTriangleIt.Next())
+      if (this->getParameters().InParallelFace &&
+          this->getStructure()->ElementsOfDomain().Extent() >= THE_MIN_PARALLEL_TRIANGLES)
       {
-        const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
-        splitTriangleGeometry(aTriangle);
+        splitTrianglesGeometryInParallel();
+      }
+      else
+      {
+        // Iterate on current triangles
+        IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
+        for (; aTriangleIt.More(); aTriangleIt.Next())
+        {
+          const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
+          splitTriangleGeometry(aTriangle);
+        }
       }
 
       isInserted = this->insertNodes(myControlNodes, theMesher, aPS.Next());
@@ -122,6 +134,13 @@ protected:
   }
 
 private:
+
+  //! Minimal number of triangles of the face to check its deflection in parallel.
+  static const Standard_Integer THE_MIN_PARALLEL_TRIANGLES = 4096;
+
+  //! Number of triangles prepared for the parallel check at once.
+  static const Standard_Integer THE_PARALLEL_BLOCK_SIZE = 65536;
+
   //! Contains geometrical data related to node of triangle.
   struct TriangleNodeInfo
   {
@@ -135,6 +154,242 @@ private:
     Standard_Boolean isFrontierLink;
   };
 
+  //! Contains the results of the surface evaluations performed to check
+  //! deflection of the triangle. Used to split the check on the part evaluating
+  //! the surface, which can be performed in parallel, and the part updating the
+  //! state of the algorithm, which is performed in the order of triangles.
+  struct TriangleCheckInfo
+  {
+    TriangleCheckInfo()
+    : IsValid(Standard_False),
+      CenterSqDeviation(0.)
+    {
+      for (Standard_Integer i = 0; i < 3; ++i)
+      {
+        IsOwnLink[i]            = Standard_False;
+        MidSqDeviation[i]       = 0.;
+        IsRejectedForMinSize[i] = Standard_False;
+        IsAngularChecked[i]     = Standard_False;
+        IsAngularFit[i]         = Standard_False;
+      }
+    }
+
+    Standard_Integer NodesIndices[3];
+    TriangleNodeInfo NodesInfo[3];
+    gp_Vec           Normal;
+    Standard_Boolean IsValid;                 //!< triangle is not degenerated
+    gp_XY            Center2d;
+    gp_Pnt           Center3d;
+    Standard_Real    CenterSqDeviation;
+    Standard_Boolean IsOwnLink[3];            //!< link has to be checked with this triangle
+    gp_XY            MidPnt2d[3];
+    gp_Pnt           MidPnt3d[3];
+    Standard_Real    MidSqDeviation[3];
+    Standard_Boolean IsRejectedForMinSize[3]; //!< result of rejectSplitLinksForMinSize()
+    Standard_Boolean IsAngularChecked[3];     //!< checkLinkEndsForAngularDeviation() has been called
+    Standard_Boolean IsAngularFit[3];         //!< result of checkLinkEndsForAngularDeviation()
+  };
+
+  //! Functor evaluating the surface for the triangles of the block in parallel.
+  class TriangleCheckFunctor
+  {
+  public:
+
+    TriangleCheckFunctor (BRepMesh_DelaunayDeflectionControlMeshAlgo* theAlgo,
+                          std::vector<TriangleCheckInfo>&              theInfos,
+                          const Standard_Integer                      theNbChunks)
+      : myAlgo    (theAlgo),
+        myInfos   (theInfos),
+        myNbChunks(theNbChunks)
+    {
+    }
+
+    void operator() (const Standard_Integer theChunkIndex) const
+    {
+      const Standard_Size aNbInfos = myInfos.size();
+      const Standard_Size aFirst = (aNbInfos *  theChunkIndex)      / myNbChunks;
+      const Standard_Size aLast  = (aNbInfos * (theChunkIndex + 1)) / myNbChunks;
+
+      // The cache of B-spline adaptor is not thread-safe, so each chunk uses its own copy
+      const Handle(Adaptor3d_Surface) aSurface = myAlgo->getDFace()->GetSurface()->ShallowCopy();
+      for (Standard_Size anIndex = aFirst; anIndex < aLast; ++anIndex)
+      {
+        myAlgo->evaluateTriangleGeometry (aSurface, myInfos[anIndex]);
+      }
+    }
+
+  private:
+    TriangleCheckFunctor (const TriangleCheckFunctor& theOther);
+    void operator= (const TriangleCheckFunctor& theOther);
+
+  private:
+    BRepMesh_DelaunayDeflectionControlMeshAlgo* myAlgo;
+    std::vector<TriangleCheckInfo>&              myInfos;
+    const Standard_Integer                      myNbChunks;
+  };
+
+  //! Checks geometry of the triangles of the domain evaluating the surface in parallel.
+  //! Gives the same result as calling splitTriangleGeometry() for each triangle.
+  void splitTrianglesGeometryInParallel()
+  {
+    const Standard_Integer aNbThreads = OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch();
+    std::vector<TriangleCheckInfo> aBlock;
+    aBlock.reserve (Min (this->getStructure()->ElementsOfDomain().Extent(), THE_PARALLEL_BLOCK_SIZE));
+
+    IMeshData::IteratorOfMapOfInteger aTriangleIt(this->getStructure()->ElementsOfDomain());
+    while (aTriangleIt.More())
+    {
+      // Prepare the block of triangles, registering the checked links in the order of triangles
+      aBlock.clear();
+      for (; aTriangleIt.More() && (Standard_Integer )aBlock.size() < THE_PARALLEL_BLOCK_SIZE; aTriangleIt.Next())
+      {
+        const BRepMesh_Triangle& aTriangle = this->getStructure()->GetElement(aTriangleIt.Key());
+        if (aTriangle.Movability() != BRepMesh_Deleted)
+        {
+          aBlock.push_back (TriangleCheckInfo());
+          prepareTriangleCheck (aTriangle, aBlock.back());
+        }
+      }
+
+      const Standard_Integer aNbChunks = Min ((Standard_Integer )aBlock.size(), aNbThreads * 4);
+      if (aNbChunks > 0)
+      {
+        TriangleCheckFunctor aFunctor (this, aBlock, aNbChunks);
+        OSD_Parallel::For (0, aNbChunks, aFunctor, aNbChunks < 2);
+      }
+
+      for (Standard_Size anIndex = 0; anIndex < aBlock.size(); ++anIndex)
+      {
+        applyTriangleCheck (aBlock[anIndex]);
+      }
+    }
+  }
+
+  //! Computes nodes data of the triangle and registers the links to be checked with it.
+  void prepareTriangleCheck (const BRepMesh_Triangle& theTriangle,
+                             TriangleCheckInfo&       theInfo)
+  {
+    this->getStructure()->ElementNodes(theTriangle, theInfo.NodesIndices);
+    getTriangleInfo(theTriangle, theInfo.NodesIndices, theInfo.NodesInfo);
+
+    gp_Vec aLinkVec[3];
+    theInfo.IsValid = computeTriangleGeometry(theInfo.NodesInfo, aLinkVec, theInfo.Normal);
+    if (!theInfo.IsValid)
+    {
+      return;
+    }
+
+    theInfo.Center2d = (theInfo.NodesInfo[0].Point2d +
+                        theInfo.NodesInfo[1].Point2d +
+                        theInfo.NodesInfo[2].Point2d) / 3.;
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (theInfo.NodesInfo[i].isFrontierLink)
+      {
+        continue;
+      }
+
+      const Standard_Integer j = (i + 1) % 3;
+      const Standard_Integer aFirstVertex = Min (theInfo.NodesIndices[i], theInfo.NodesIndices[j]);
+      const Standard_Integer aLastVertex  = Max (theInfo.NodesIndices[i], theInfo.NodesIndices[j]);
+      theInfo.IsOwnLink[i] = myCouplesMap->Add(BRepMesh_OrientedEdge(aFirstVertex, aLastVertex));
+      if (theInfo.IsOwnLink[i])
+      {
+        theInfo.MidPnt2d[i] = (theInfo.NodesInfo[i].Point2d +
+                               theInfo.NodesInfo[j].Point2d) / 2.;
+      }
+    }
+  }
+
+  //! Evaluates the surface in the points checked for the triangle.
+  //! Does not modify the state of the algorithm, thus can be called concurrently.
+  void evaluateTriangleGeometry (const Handle(Adaptor3d_Surface)& theSurface,
+                                 TriangleCheckInfo&               theInfo)
+  {
+    if (!theInfo.IsValid)
+    {
+      return;
+    }
+
+    const Standard_Real aSqDeflection =
+      this->getDFace()->GetDeflection() * this->getDFace()->GetDeflection();
+
+    theSurface->D0 (theInfo.Center2d.X(), theInfo.Center2d.Y(), theInfo.Center3d);
+    theInfo.CenterSqDeviation =
+      NormalDeviation(theInfo.NodesInfo[0].Point, theInfo.Normal).SquareDeviation(theInfo.Center3d);
+
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (!theInfo.IsOwnLink[i])
+      {
+        continue;
+      }
+
+      const TriangleNodeInfo& aNodeInfo1 = theInfo.NodesInfo[i];
+      const TriangleNodeInfo& aNodeInfo2 = theInfo.NodesInfo[(i + 1) % 3];
+      gp_Pnt& aMidPnt3d = theInfo.MidPnt3d[i];
+      theSurface->D0 (theInfo.MidPnt2d[i].X(), theInfo.MidPnt2d[i].Y(), aMidPnt3d);
+      theInfo.MidSqDeviation[i] =
+        LineDeviation(aNodeInfo1.Point, aNodeInfo2.Point).SquareDeviation(aMidPnt3d);
+
+      theInfo.IsRejectedForMinSize[i] =
+        ((aNodeInfo1.Point - aMidPnt3d.XYZ()).SquareModulus() < mySqMinSize ||
+         (aNodeInfo2.Point - aMidPnt3d.XYZ()).SquareModulus() < mySqMinSize);
+
+      // The angular deviation is needed only if the middle point is not inserted,
+      // which is known for sure if it fits the deflection
+      if (!theInfo.IsRejectedForMinSize[i] && theInfo.MidSqDeviation[i] < aSqDeflection)
+      {
+        theInfo.IsAngularFit[i] =
+          checkLinkEndsForAngularDeviation(aNodeInfo1, aNodeInfo2, theInfo.MidPnt2d[i]);
+        theInfo.IsAngularChecked[i] = Standard_True;
+      }
+    }
+  }
+
+  //! Applies the results of evaluation of the triangle geometry
+  //! in the same way as splitTriangleGeometry() does.
+  void applyTriangleCheck (const TriangleCheckInfo& theInfo)
+  {
+    if (!theInfo.IsValid)
+    {
+      return;
+    }
+
+    myIsAllDegenerated = Standard_False;
+    if (!checkDeflectionOfPointAndUpdateCache(theInfo.Center2d, theInfo.Center3d, theInfo.CenterSqDeviation))
+    {
+      myControlNodes->Append(theInfo.Center2d);
+    }
+
+    for (Standard_Integer i = 0; i < 3; ++i)
+    {
+      if (!theInfo.IsOwnLink[i])
+      {
+        continue;
+      }
+
+      const gp_XY& aMidPnt2d = theInfo.MidPnt2d[i];
+      if (!checkDeflectionOfPointAndUpdateCache(aMidPnt2d, theInfo.MidPnt3d[i], theInfo.MidSqDeviation[i]))
+      {
+        myControlNodes->Append(aMidPnt2d);
+        continue;
+      }
+
+      if (theInfo.IsRejectedForMinSize[i])
+      {
+        continue;
+      }
+
+      const Standard_Boolean isAngularFit = theInfo.IsAngularChecked[i] ? theInfo.IsAngularFit[i] :
+        checkLinkEndsForAngularDeviation(theInfo.NodesInfo[i], theInfo.NodesInfo[(i + 1) % 3], aMidPnt2d);
+      if (!isAngularFit)
+      {
+        myControlNodes->Append(aMidPnt2d);
+      }
+    }
+  }
+
   //! Functor computing deflection of a point from surface.
   class NormalDeviation
   {
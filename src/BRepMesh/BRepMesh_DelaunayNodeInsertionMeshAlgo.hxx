@@ -114,15 +114,28 @@ protected:
       return Standard_False;
     }
 
-    IMeshData::VectorOfInteger aVertexIndexes(theNodes->Size(), this->getAllocator());
-    IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes);
-    for (Standard_Integer aNodeIt = 1; aNodesIt.More(); aNodesIt.Next(), ++aNodeIt)
+    // Classify the nodes first to evaluate the surface for the inner ones at once.
+    TColgp_Array1OfPnt2d aPnts2d(1, theNodes->Size());
+    Standard_Integer aNbInner = 0;
+    for (IMeshData::ListOfPnt2d::Iterator aNodesIt(*theNodes); aNodesIt.More(); aNodesIt.Next())
     {
       const gp_Pnt2d& aPnt2d = aNodesIt.Value();
       if (this->getClassifier()->Perform(aPnt2d) == TopAbs_IN)
       {
-        aVertexIndexes.Append(this->registerNode(this->getRangeSplitter().Point(aPnt2d),
-                                                 aPnt2d, BRepMesh_Free, Standard_False));
+        aPnts2d.SetValue(++aNbInner, aPnt2d);
+      }
+    }
+
+    IMeshData::VectorOfInteger aVertexIndexes(Max(aNbInner, 1), this->getAllocator());
+    if (aNbInner > 0)
+    {
+      const TColgp_Array1OfPnt2d aInnerPnts2d(aPnts2d.First(), 1, aNbInner);
+      TColgp_Array1OfPnt aPnts3d(1, aNbInner);
+      this->getRangeSplitter().Points(aInnerPnts2d, aPnts3d);
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbInner; ++aNodeIt)
+      {
+        aVertexIndexes.Append(this->registerNode(aPnts3d(aNodeIt), aInnerPnts2d(aNodeIt),
+                                                 BRepMesh_Free, Standard_False));
       }
     }
 
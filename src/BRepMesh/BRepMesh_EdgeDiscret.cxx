@@ -49,9 +49,10 @@ BRepMesh_EdgeDiscret::~BRepMesh_EdgeDiscret ()
 //=======================================================================
 Handle(IMeshTools_CurveTessellator) BRepMesh_EdgeDiscret::CreateEdgeTessellator(
   const IMeshData::IEdgeHandle& theDEdge,
-  const IMeshTools_Parameters&  theParameters)
+  const IMeshTools_Parameters&  theParameters,
+  const TColStd_SequenceOfReal& theSeedParameters)
 {
-  return new BRepMesh_CurveTessellator(theDEdge, theParameters);
+  return new BRepMesh_CurveTessellator(theDEdge, theParameters, theSeedParameters);
 }
 
 //=======================================================================
@@ -62,11 +63,12 @@ Handle(IMeshTools_CurveTessellator) BRepMesh_EdgeDiscret::CreateEdgeTessellator(
   const IMeshData::IEdgeHandle& theDEdge,
   const TopAbs_Orientation      theOrientation,
   const IMeshData::IFaceHandle& theDFace,
-  const IMeshTools_Parameters&  theParameters)
+  const IMeshTools_Parameters&  theParameters,
+  const TColStd_SequenceOfReal& theSeedParameters)
 {
   return theDEdge->GetSameParam() ? 
-    new BRepMesh_CurveTessellator(theDEdge, theParameters) :
-    new BRepMesh_CurveTessellator(theDEdge, theOrientation, theDFace, theParameters);
+    new BRepMesh_CurveTessellator(theDEdge, theParameters, theSeedParameters) :
+    new BRepMesh_CurveTessellator(theDEdge, theOrientation, theDFace, theParameters, theSeedParameters);
 }
 
 //=======================================================================
@@ -116,7 +118,19 @@ void BRepMesh_EdgeDiscret::process (const Standard_Integer theEdgeIndex) const
     OCC_CATCH_SIGNALS
 
     BRepMesh_Deflection::ComputeDeflection (aDEdge, myModel->GetMaxSize (), myParameters);
-  
+
+    // Points kept from the previous pass serve as seed of the new discretization.
+    TColStd_SequenceOfReal aSeedParameters;
+    const IMeshData::ICurveHandle& aDCurve = aDEdge->GetCurve();
+    if (!aDEdge->GetDegenerated())
+    {
+      for (Standard_Integer aParamIt = 0; aParamIt < aDCurve->ParametersNb(); ++aParamIt)
+      {
+        aSeedParameters.Append (aDCurve->GetParameter (aParamIt));
+      }
+    }
+    aDEdge->Clear (Standard_False);
+
     Handle (IMeshTools_CurveTessellator) aEdgeTessellator;
     if (!aDEdge->IsFree ())
     {
@@ -149,14 +163,14 @@ void BRepMesh_EdgeDiscret::process (const Standard_Integer theEdgeIndex) const
         const IMeshData::IPCurveHandle& aPCurve = aDEdge->GetPCurve(0);
         const IMeshData::IFaceHandle    aDFace  = aPCurve->GetFace();
         aEdgeTessellator = BRepMesh_EdgeDiscret::CreateEdgeTessellator(
-          aDEdge, aPCurve->GetOrientation(), aDFace, myParameters);
+          aDEdge, aPCurve->GetOrientation(), aDFace, myParameters, aSeedParameters);
       }
     }
     else
     {
       TopLoc_Location aLoc;
       const Handle (Poly_Polygon3D)& aPoly3D = BRep_Tool::Polygon3D (aDEdge->GetEdge (), aLoc);
-      if (!aPoly3D.IsNull ())
+      if (!aPoly3D.IsNull () && !aDEdge->IsSet (IMeshData_Outdated))
       {
         if (aPoly3D->HasParameters() &&
             BRepMesh_Deflection::IsConsistent (aPoly3D->Deflection(),
@@ -173,7 +187,7 @@ void BRepMesh_EdgeDiscret::process (const Standard_Integer theEdgeIndex) const
         }
       }
   
-      aEdgeTessellator = CreateEdgeTessellator(aDEdge, myParameters);
+      aEdgeTessellator = CreateEdgeTessellator(aDEdge, myParameters, aSeedParameters);
     }
   
     Tessellate3d (aDEdge, aEdgeTessellator, Standard_True);
@@ -199,11 +213,19 @@ Standard_Real BRepMesh_EdgeDiscret::checkExistingPolygonAndUpdateStatus(
   const TopoDS_Edge& aEdge = theDEdge->GetEdge ();
   const TopoDS_Face& aFace = thePCurve->GetFace ()->GetFace ();
 
+  Standard_Real aDeflection = RealLast ();
+  if (theDEdge->IsSet (IMeshData_Outdated) ||
+      thePCurve->GetFace ()->IsSet (IMeshData_Outdated))
+  {
+    // Edge or face has been modified since the previous meshing,
+    // existing polygon does not correspond to the geometry.
+    return aDeflection;
+  }
+
   TopLoc_Location aLoc;
   const Handle (Poly_Triangulation)& aFaceTriangulation =
     BRep_Tool::Triangulation (aFace, aLoc);
 
-  Standard_Real aDeflection = RealLast ();
   if (aFaceTriangulation.IsNull())
   {
     return aDeflection;
@@ -19,13 +19,16 @@
 #include <IMeshTools_ModelAlgo.hxx>
 #include <IMeshTools_Parameters.hxx>
 #include <IMeshData_Types.hxx>
+#include <TColStd_SequenceOfReal.hxx>
 
 class IMeshTools_CurveTessellator;
 
 //! Class implements functionality of edge discret tool.
 //! Performs check of the edges for existing Poly_PolygonOnTriangulation.
 //! In case if it fits specified deflection, restores data structure using
-//! it, else clears edges from outdated data.
+//! it, else clears edges from outdated data. Discretization points already
+//! held by the edge, e.g. kept from a pass with a coarser deflection, are
+//! refined to the current deflection instead of being computed from scratch.
 class BRepMesh_EdgeDiscret : public IMeshTools_ModelAlgo
 {
 public:
@@ -36,16 +39,20 @@ public:
   Standard_EXPORT virtual ~BRepMesh_EdgeDiscret ();
 
   //! Creates instance of free edge tessellator.
+  //! Non-empty theSeedParameters are refined instead of discretizing the whole edge.
   Standard_EXPORT static Handle(IMeshTools_CurveTessellator) CreateEdgeTessellator(
     const IMeshData::IEdgeHandle& theDEdge,
-    const IMeshTools_Parameters&  theParameters);
+    const IMeshTools_Parameters&  theParameters,
+    const TColStd_SequenceOfReal& theSeedParameters = TColStd_SequenceOfReal());
 
   //! Creates instance of edge tessellator.
+  //! Non-empty theSeedParameters are refined instead of discretizing the whole edge.
   Standard_EXPORT static Handle(IMeshTools_CurveTessellator) CreateEdgeTessellator(
     const IMeshData::IEdgeHandle& theDEdge,
     const TopAbs_Orientation      theOrientation,
     const IMeshData::IFaceHandle& theDFace,
-    const IMeshTools_Parameters&  theParameters);
+    const IMeshTools_Parameters&  theParameters,
+    const TColStd_SequenceOfReal& theSeedParameters = TColStd_SequenceOfReal());
 
   //! Creates instance of tessellation extractor.
   Standard_EXPORT static Handle(IMeshTools_CurveTessellator) CreateEdgeTessellationExtractor(
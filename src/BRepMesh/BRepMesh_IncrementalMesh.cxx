@@ -17,9 +17,27 @@
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <BRepMesh_Context.hxx>
 #include <BRepMesh_PluginMacro.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMeshData_Model.hxx>
+#include <Geom_BSplineCurve.hxx>
+#include <Geom_BSplineSurface.hxx>
+#include <Geom_RectangularTrimmedSurface.hxx>
+#include <Geom_TrimmedCurve.hxx>
+#include <IMeshData_Edge.hxx>
 #include <IMeshData_Face.hxx>
 #include <IMeshData_Wire.hxx>
 #include <IMeshTools_MeshBuilder.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_List.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS.hxx>
+
+#include <algorithm>
+#include <functional>
 
 IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
@@ -28,6 +46,82 @@ namespace
   //! Default flag to control parallelization for BRepMesh_IncrementalMesh
   //! tool returned for Mesh Factory
   static Standard_Boolean IS_IN_PARALLEL = Standard_False;
+
+  //! Default cache of tessellations for BRepMesh_IncrementalMesh tool
+  static Handle(BRepMesh_TessellationCache)& defaultCache()
+  {
+    static Handle(BRepMesh_TessellationCache) THE_DEFAULT_CACHE;
+    return THE_DEFAULT_CACHE;
+  }
+
+  //! Creates the shared caches of spans of B-spline surfaces of faces and curves
+  //! of edges of the shape for the time of meshing; releases the created ones.
+  //! Should be used outside of parallel processing, which then reads the caches only.
+  class SharedSplineCaches
+  {
+  public:
+
+    SharedSplineCaches (const TopoDS_Shape& theShape, const Standard_Boolean theToCreate)
+    {
+      if (!theToCreate)
+      {
+        return;
+      }
+
+      TopLoc_Location aLoc;
+      TopTools_IndexedMapOfShape aFaces, aEdges;
+      TopExp::MapShapes (theShape, TopAbs_FACE, aFaces);
+      TopExp::MapShapes (theShape, TopAbs_EDGE, aEdges);
+      for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+      {
+        Handle(Geom_Surface) aSurface = BRep_Tool::Surface (TopoDS::Face (aFaces (aFaceIt)), aLoc);
+        Handle(Geom_RectangularTrimmedSurface) aTrimmed = Handle(Geom_RectangularTrimmedSurface)::DownCast (aSurface);
+        Handle(Geom_BSplineSurface) aBSpline = Handle(Geom_BSplineSurface)::DownCast (
+          aTrimmed.IsNull() ? aSurface : aTrimmed->BasisSurface());
+        if (!aBSpline.IsNull() && aBSpline->SharedCache().IsNull())
+        {
+          aBSpline->CreateSharedCache();
+          mySurfaces.Append (aBSpline);
+        }
+      }
+
+      for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aEdges.Extent(); ++aEdgeIt)
+      {
+        Standard_Real aFirst, aLast;
+        Handle(Geom_Curve) aCurve = BRep_Tool::Curve (TopoDS::Edge (aEdges (aEdgeIt)), aLoc, aFirst, aLast);
+        Handle(Geom_TrimmedCurve) aTrimmed = Handle(Geom_TrimmedCurve)::DownCast (aCurve);
+        Handle(Geom_BSplineCurve) aBSpline = Handle(Geom_BSplineCurve)::DownCast (
+          aTrimmed.IsNull() ? aCurve : aTrimmed->BasisCurve());
+        if (!aBSpline.IsNull() && aBSpline->SharedCache().IsNull())
+        {
+          aBSpline->CreateSharedCache();
+          myCurves.Append (aBSpline);
+        }
+      }
+    }
+
+    ~SharedSplineCaches()
+    {
+      for (NCollection_List<Handle(Geom_BSplineSurface)>::Iterator aSurfIt (mySurfaces); aSurfIt.More(); aSurfIt.Next())
+      {
+        aSurfIt.Value()->ReleaseSharedCache();
+      }
+      for (NCollection_List<Handle(Geom_BSplineCurve)>::Iterator aCurveIt (myCurves); aCurveIt.More(); aCurveIt.Next())
+      {
+        aCurveIt.Value()->ReleaseSharedCache();
+      }
+    }
+
+  private:
+
+    SharedSplineCaches (const SharedSplineCaches&);
+    void operator= (const SharedSplineCaches&);
+
+  private:
+
+    NCollection_List<Handle(Geom_BSplineSurface)> mySurfaces;
+    NCollection_List<Handle(Geom_BSplineCurve)>   myCurves;
+  };
 }
 
 //=======================================================================
@@ -36,7 +130,8 @@ namespace
 //=======================================================================
 BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh()
 : myModified(Standard_False),
-  myStatus(IMeshData_NoError)
+  myStatus(IMeshData_NoError),
+  myCache(defaultCache())
 {
 }
 
@@ -50,7 +145,8 @@ BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh( const TopoDS_Shape&    theSh
                                                     const Standard_Real    theAngDeflection,
                                                     const Standard_Boolean isInParallel)
 : myModified(Standard_False),
-  myStatus(IMeshData_NoError)
+  myStatus(IMeshData_NoError),
+  myCache(defaultCache())
 {
   myParameters.Deflection = theLinDeflection;
   myParameters.Angle      = theAngDeflection;
@@ -69,7 +165,8 @@ BRepMesh_IncrementalMesh::BRepMesh_IncrementalMesh(
   const TopoDS_Shape&          theShape,
   const IMeshTools_Parameters& theParameters,
   const Message_ProgressRange& theRange)
-  : myParameters(theParameters)
+  : myParameters(theParameters),
+    myCache(defaultCache())
 {
   myShape = theShape;
   Perform(theRange);
@@ -90,7 +187,27 @@ BRepMesh_IncrementalMesh::~BRepMesh_IncrementalMesh()
 void BRepMesh_IncrementalMesh::Perform(const Message_ProgressRange& theRange)
 {
   Handle(BRepMesh_Context) aContext = new BRepMesh_Context (myParameters.MeshAlgo);
+  if (myCache.IsNull() || BRepMesh_TessellationCache::HasTessellation (Shape()))
+  {
+    Perform (aContext, theRange);
+    return;
+  }
+
+  // The shape is meshed from scratch, thus its tessellation
+  // is defined by the geometry and parameters only.
+  initParameters();
+  if (myCache->Restore (Shape(), myParameters))
+  {
+    myStatus = IMeshData_NoError;
+    setDone();
+    return;
+  }
+
   Perform (aContext, theRange);
+  if (IsDone() && (myStatus & (IMeshData_Failure | IMeshData_UserBreak)) == 0)
+  {
+    myCache->Store (Shape(), myParameters);
+  }
 }
 
 //=======================================================================
@@ -106,6 +223,7 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
   theContext->ChangeParameters().CleanModel = Standard_False;
 
   Message_ProgressScope aPS(theRange, "Perform incmesh", 10);
+  SharedSplineCaches aSharedCaches (Shape(), myParameters.SharedSplineCache);
   IMeshTools_MeshBuilder aIncMesh(theContext);
   aIncMesh.Perform(aPS.Next(9));
   if (!aPS.More())
@@ -133,6 +251,195 @@ void BRepMesh_IncrementalMesh::Perform(const Handle(IMeshTools_Context)& theCont
   setDone();
 }
 
+//=======================================================================
+//function : nullifyFace
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::nullifyFace (const TopoDS_Face& theFace)
+{
+  TopLoc_Location aLoc;
+  const Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (theFace, aLoc);
+  if (aTriangulation.IsNull())
+  {
+    return;
+  }
+
+  for (TopExp_Explorer aEdgeIt (theFace, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+  {
+    BRepMesh_ShapeTool::NullifyEdge (TopoDS::Edge (aEdgeIt.Current()), aTriangulation, aLoc);
+  }
+  BRepMesh_ShapeTool::NullifyFace (theFace);
+}
+
+//=======================================================================
+//function : resetModel
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::resetModel (const Handle(IMeshData_Model)& theModel)
+{
+  const Standard_Integer aStatusMask = ~IMeshData_NoError;
+  for (Standard_Integer aFaceIt = 0; aFaceIt < theModel->FacesNb(); ++aFaceIt)
+  {
+    const IMeshData::IFaceHandle& aDFace = theModel->GetFace (aFaceIt);
+    aDFace->UnsetStatus ((IMeshData_Status )aStatusMask);
+    for (Standard_Integer aWireIt = 0; aWireIt < aDFace->WiresNb(); ++aWireIt)
+    {
+      aDFace->GetWire (aWireIt)->UnsetStatus ((IMeshData_Status )aStatusMask);
+    }
+  }
+
+  // Discretization points of edges are kept to be refined by the next level.
+  for (Standard_Integer aEdgeIt = 0; aEdgeIt < theModel->EdgesNb(); ++aEdgeIt)
+  {
+    theModel->GetEdge (aEdgeIt)->UnsetStatus ((IMeshData_Status )aStatusMask);
+  }
+}
+
+//=======================================================================
+//function : PerformLODs
+//purpose  : 
+//=======================================================================
+void BRepMesh_IncrementalMesh::PerformLODs (const TColStd_Array1OfReal&  theDeflections,
+                                            const Message_ProgressRange& theRange)
+{
+  for (Standard_Integer aDefIt = theDeflections.Lower(); aDefIt <= theDeflections.Upper(); ++aDefIt)
+  {
+    if (theDeflections (aDefIt) < Precision::Confusion())
+    {
+      throw Standard_NumericError ("BRepMesh_IncrementalMesh::PerformLODs : invalid deflection value");
+    }
+  }
+
+  initParameters();
+  myStatus = IMeshData_NoError;
+  if (theDeflections.IsEmpty())
+  {
+    return;
+  }
+
+  // Levels are meshed from the coarsest to the finest one.
+  TColStd_Array1OfReal aDeflections (theDeflections.Lower(), theDeflections.Upper());
+  aDeflections.Assign (theDeflections);
+  std::sort (aDeflections.begin(), aDeflections.end(), std::greater<Standard_Real>());
+
+  TopTools_IndexedMapOfShape aFaces, aEdges;
+  TopExp::MapShapes (Shape(), TopAbs_FACE, aFaces);
+  TopExp::MapShapes (Shape(), TopAbs_EDGE, aEdges);
+  NCollection_Array1<Poly_ListOfTriangulation> aLODs (1, Max (aFaces.Extent(), 1));
+
+  // Existing tessellation would be reused as far as it fits the coarse level.
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+  {
+    nullifyFace (TopoDS::Face (aFaces (aFaceIt)));
+  }
+  for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aEdges.Extent(); ++aEdgeIt)
+  {
+    BRepMesh_ShapeTool::NullifyEdge (TopoDS::Edge (aEdges (aEdgeIt)), TopLoc_Location());
+  }
+
+  // The discrete model is built once and shared by all levels,
+  // only its discretization data is reset before each level.
+  IMeshTools_Parameters aParameters = myParameters;
+  aParameters.CleanModel = Standard_False;
+  const Standard_Real aInteriorRatio = aParameters.DeflectionInterior / aParameters.Deflection;
+
+  SharedSplineCaches aSharedCaches (Shape(), aParameters.SharedSplineCache);
+  Handle(BRepMesh_Context) aContext = new BRepMesh_Context (aParameters.MeshAlgo);
+  aContext->SetShape (Shape());
+  aContext->ChangeParameters() = aParameters;
+  if (!aContext->BuildModel())
+  {
+    myStatus = IMeshData_Failure;
+    return;
+  }
+
+  const Handle(IMeshData_Model)& aModel = aContext->GetModel();
+  Handle(BRepMeshData_Model) aDataModel = Handle(BRepMeshData_Model)::DownCast (aModel);
+  Message_ProgressScope aPS (theRange, "Perform incmesh LODs", aDeflections.Length());
+  for (Standard_Integer aDefIt = aDeflections.Lower(); aDefIt <= aDeflections.Upper(); ++aDefIt)
+  {
+    const Standard_Real aDeflection = aDeflections (aDefIt);
+    if (aDefIt > aDeflections.Lower() && aDeflection == aDeflections (aDefIt - 1))
+    {
+      aPS.Next();
+      continue;
+    }
+
+    IMeshTools_Parameters& aLevelParameters = aContext->ChangeParameters();
+    aLevelParameters.Deflection         = aDeflection;
+    aLevelParameters.DeflectionInterior = aDeflection * aInteriorRatio;
+    if (!aLevelParameters.Relative && !aDataModel.IsNull())
+    {
+      aDataModel->SetMaxSize (Max (aLevelParameters.Deflection, aLevelParameters.DeflectionInterior));
+    }
+
+    if (aDefIt > aDeflections.Lower())
+    {
+      resetModel (aModel);
+    }
+
+    Message_ProgressScope aLevelPS (aPS.Next(), NULL, 1);
+    if (!aContext->DiscretizeEdges()
+     || !aContext->HealModel()
+     || !aContext->PreProcessModel()
+     || !aContext->DiscretizeFaces (aLevelPS.Next())
+     || !aContext->PostProcessModel())
+    {
+      myStatus |= IMeshData_Failure;
+    }
+    if (!aPS.More())
+    {
+      myStatus |= IMeshData_UserBreak;
+      break;
+    }
+
+    for (Standard_Integer aFaceIt = 0; aFaceIt < aModel->FacesNb(); ++aFaceIt)
+    {
+      const IMeshData::IFaceHandle& aDFace = aModel->GetFace (aFaceIt);
+      myStatus |= aDFace->GetStatusMask();
+      for (Standard_Integer aWireIt = 0; aWireIt < aDFace->WiresNb(); ++aWireIt)
+      {
+        myStatus |= aDFace->GetWire (aWireIt)->GetStatusMask();
+      }
+    }
+
+    // Keep triangulations of the level and let the next level mesh the faces anew.
+    for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+    {
+      const TopoDS_Face& aFace = TopoDS::Face (aFaces (aFaceIt));
+      TopLoc_Location aLoc;
+      const Handle(Poly_Triangulation) aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+      if (aTriangulation.IsNull())
+      {
+        continue;
+      }
+
+      aTriangulation->SetMeshPurpose (Poly_MeshPurpose_Presentation);
+      aLODs (aFaceIt).Append (aTriangulation);
+      if (aDefIt < aDeflections.Upper())
+      {
+        nullifyFace (aFace);
+      }
+    }
+  }
+  aContext->Clean();
+
+  BRep_Builder aBuilder;
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aFaces.Extent(); ++aFaceIt)
+  {
+    Poly_ListOfTriangulation& aList = aLODs (aFaceIt);
+    if (aList.IsEmpty())
+    {
+      continue;
+    }
+
+    const Handle(Poly_Triangulation)& aFinest = aList.Last();
+    aFinest->SetMeshPurpose (Poly_MeshPurpose_Calculation | Poly_MeshPurpose_Presentation);
+    aBuilder.UpdateFace (TopoDS::Face (aFaces (aFaceIt)), aList, aFinest);
+  }
+  setDone();
+}
+
 //=======================================================================
 //function : Discret
 //purpose  :
@@ -171,5 +478,24 @@ void BRepMesh_IncrementalMesh::SetParallelDefault(
   IS_IN_PARALLEL = theInParallel;
 }
 
+//=======================================================================
+//function : DefaultCache
+//purpose  :
+//=======================================================================
+const Handle(BRepMesh_TessellationCache)& BRepMesh_IncrementalMesh::DefaultCache()
+{
+  return defaultCache();
+}
+
+//=======================================================================
+//function : SetDefaultCache
+//purpose  :
+//=======================================================================
+void BRepMesh_IncrementalMesh::SetDefaultCache(
+  const Handle(BRepMesh_TessellationCache)& theCache)
+{
+  defaultCache() = theCache;
+}
+
 //! Export Mesh Plugin entry function
 DISCRETPLUGIN(BRepMesh_IncrementalMesh)
@@ -15,8 +15,10 @@
 #define _BRepMesh_IncrementalMesh_HeaderFile
 
 #include <BRepMesh_DiscretRoot.hxx>
+#include <BRepMesh_TessellationCache.hxx>
 #include <IMeshTools_Context.hxx>
 #include <Standard_NumericError.hxx>
+#include <TColStd_Array1OfReal.hxx>
 
 //! Builds the mesh of a shape with respect of their 
 //! correctly triangulated parts 
@@ -59,6 +61,21 @@ public: //! @name mesher API
   //! Performs meshing using custom context;
   Standard_EXPORT void Perform(const Handle(IMeshTools_Context)& theContext,
                                const Message_ProgressRange& theRange = Message_ProgressRange());
+
+  //! Builds several levels of detail of the mesh in one run.
+  //! The discrete model of the shape is built once and the levels are meshed on it
+  //! successively from the coarsest deflection to the finest one, while the other
+  //! parameters are kept. Interior deflection is scaled proportionally to the linear one.
+  //! Edge polygons of a finer level refine the ones of the preceding coarser level, so that
+  //! each coarse boundary node is kept by all finer levels.
+  //! Each face gets the list of triangulations ordered from the coarsest to the finest
+  //! one, all marked as Poly_MeshPurpose_Presentation; the finest triangulation is active
+  //! and is also marked as Poly_MeshPurpose_Calculation. Existing tessellation of the shape
+  //! is discarded. The cache of tessellations is not used.
+  //! @param theDeflections linear deflections of the levels of detail, in any order;
+  //!        Standard_NumericError is raised if some of them is not positive.
+  Standard_EXPORT void PerformLODs (const TColStd_Array1OfReal&  theDeflections,
+                                    const Message_ProgressRange& theRange = Message_ProgressRange());
   
 public: //! @name accessing to parameters.
 
@@ -85,9 +102,34 @@ public: //! @name accessing to parameters.
   {
     return myStatus;
   }
+
+  //! Returns cache of tessellations used by the algorithm.
+  const Handle(BRepMesh_TessellationCache)& Cache() const
+  {
+    return myCache;
+  }
+
+  //! Sets cache of tessellations.
+  //! The cache is consulted by Perform() without explicit context when the shape has
+  //! no tessellation at all, so that it would be meshed from scratch anyway. If the cache
+  //! contains an entry for the shape and parameters, the tessellation is restored from
+  //! the cache and meshing is skipped; otherwise the result of meshing is stored in the cache.
+  //! Existing tessellation is never replaced by the cached one. The cache is not used
+  //! with user-defined context, which may use algorithms other than the default ones.
+  //! Null handle disables caching. Initialized by DefaultCache() on construction.
+  void SetCache (const Handle(BRepMesh_TessellationCache)& theCache)
+  {
+    myCache = theCache;
+  }
   
 private:
 
+  //! Resets statuses and discretization of edges of the model before meshing of the next level of detail.
+  static void resetModel (const Handle(IMeshData_Model)& theModel);
+
+  //! Removes triangulation of the face together with polygons of its edges on it.
+  static void nullifyFace (const TopoDS_Face& theFace);
+
   //! Initializes specific parameters
   void initParameters()
   {
@@ -139,6 +181,15 @@ public: //! @name plugin API
   //! Discret() static method (thus applied only to Mesh Factories).
   Standard_EXPORT static void SetParallelDefault(const Standard_Boolean isInParallel);
 
+  //! Returns cache of tessellations set by default for new instances
+  //! of the algorithm (including those created by Mesh Factories).
+  Standard_EXPORT static const Handle(BRepMesh_TessellationCache)& DefaultCache();
+
+  //! Setup cache of tessellations used by default for new instances
+  //! of the algorithm (including those created by Mesh Factories).
+  //! Null handle (default) disables caching.
+  Standard_EXPORT static void SetDefaultCache (const Handle(BRepMesh_TessellationCache)& theCache);
+
   DEFINE_STANDARD_RTTIEXT(BRepMesh_IncrementalMesh, BRepMesh_DiscretRoot)
 
 protected:
@@ -146,6 +197,7 @@ protected:
   IMeshTools_Parameters myParameters;
   Standard_Boolean      myModified;
   Standard_Integer      myStatus;
+  Handle(BRepMesh_TessellationCache) myCache;
 };
 
 #endif
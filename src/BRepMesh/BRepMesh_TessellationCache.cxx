@@ -0,0 +1,1040 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BRepMesh_TessellationCache.hxx>
+
+#include <BinTools.hxx>
+#include <BinTools_Curve2dSet.hxx>
+#include <BinTools_CurveSet.hxx>
+#include <BinTools_OStream.hxx>
+#include <BinTools_SurfaceSet.hxx>
+#include <BRep_Builder.hxx>
+#include <BRep_Tool.hxx>
+#include <BRepMesh_ShapeTool.hxx>
+#include <OSD_OpenFile.hxx>
+#include <OSD_Process.hxx>
+#include <OSD_Thread.hxx>
+#include <Poly_Polygon3D.hxx>
+#include <Poly_PolygonOnTriangulation.hxx>
+#include <Poly_Triangulation.hxx>
+#include <Poly_TriangulationParameters.hxx>
+#include <TopExp.hxx>
+#include <TopExp_Explorer.hxx>
+#include <TopoDS.hxx>
+#include <TopoDS_Edge.hxx>
+#include <TopoDS_Face.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopoDS_Vertex.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+IMPLEMENT_STANDARD_RTTIEXT(BRepMesh_TessellationCache, Standard_Transient)
+
+namespace
+{
+  //! Signature and version of the binary format of cached tessellation.
+  static const Standard_Integer THE_FORMAT_MAGIC   = 0x4D544D42; // "BMTM"
+  static const Standard_Integer THE_FORMAT_VERSION = 3;
+
+  //! Computes 64-bit FNV-1a hash of the given byte string.
+  static uint64_t hashBytes (const std::string& theBytes,
+                             const uint64_t     theSeed)
+  {
+    uint64_t aHash = theSeed;
+    for (std::string::const_iterator aByteIt = theBytes.begin(); aByteIt != theBytes.end(); ++aByteIt)
+    {
+      aHash ^= (uint64_t )(unsigned char )(*aByteIt);
+      aHash *= 1099511628211ULL;
+    }
+    return aHash;
+  }
+
+  //! Appends hexadecimal representation of the given value to the string.
+  static void appendHex (TCollection_AsciiString& theString,
+                         const uint64_t           theValue)
+  {
+    static const char THE_DIGITS[] = "0123456789abcdef";
+    for (Standard_Integer aShift = 60; aShift >= 0; aShift -= 4)
+    {
+      theString += THE_DIGITS[(theValue >> aShift) & 0xF];
+    }
+  }
+
+  //! Default limit of the size of entries kept in memory.
+  static const Standard_Size THE_DEFAULT_MAX_SIZE = 64 * 1024 * 1024;
+
+  //! Sizes of the primitives written by BinTools.
+  static const uint64_t THE_SIZE_OF_INTEGER = 4;
+  static const uint64_t THE_SIZE_OF_REAL    = 8;
+
+  //! Checks that the rest of the stream is enough to hold the given number of items
+  //! so that the counts read from corrupted data do not lead to huge allocations.
+  //! Returns false if the size of the stream cannot be determined.
+  static Standard_Boolean isAvailable (Standard_IStream&      theStream,
+                                       const Standard_Integer theNbItems,
+                                       const uint64_t         theItemSize)
+  {
+    if (!theStream || theNbItems < 0)
+    {
+      return Standard_False;
+    }
+
+    const std::streampos aPos = theStream.tellg();
+    theStream.seekg (0, std::ios::end);
+    const std::streampos anEnd = theStream.tellg();
+    theStream.seekg (aPos);
+    if (aPos < 0 || anEnd < aPos || !theStream)
+    {
+      return Standard_False;
+    }
+    return (uint64_t )theNbItems * theItemSize <= (uint64_t )(anEnd - aPos);
+  }
+
+  //! Topological maps of the shape defining order of the stored data.
+  struct ShapeMaps
+  {
+    TopTools_IndexedMapOfShape                Faces;
+    TopTools_IndexedDataMapOfShapeListOfShape EdgeFaces;
+
+    ShapeMaps (const TopoDS_Shape& theShape)
+    {
+      TopExp::MapShapes (theShape, TopAbs_FACE, Faces);
+      TopExp::MapShapesAndAncestors (theShape, TopAbs_EDGE, TopAbs_FACE, EdgeFaces);
+    }
+  };
+
+  //! Writes geometry of the edge defining its discretization.
+  static void writeEdgeGeometry (BinTools_OStream&  theStream,
+                                 const TopoDS_Edge& theEdge,
+                                 const TopoDS_Face& theFace)
+  {
+    theStream << (Standard_Integer )theEdge.Orientation()
+              << BRep_Tool::Tolerance     (theEdge)
+              << BRep_Tool::Degenerated   (theEdge)
+              << BRep_Tool::SameParameter (theEdge)
+              << BRep_Tool::SameRange     (theEdge);
+
+    Standard_Real aFirst = 0., aLast = 0.;
+    TopLoc_Location aCurveLoc;
+    const Handle(Geom_Curve) aCurve = BRep_Tool::Curve (theEdge, aCurveLoc, aFirst, aLast);
+    theStream << !aCurve.IsNull() << aFirst << aLast;
+    if (!aCurve.IsNull())
+    {
+      BinTools_CurveSet::WriteCurve (aCurve, theStream);
+      theStream << aCurveLoc.Transformation();
+    }
+
+    if (!theFace.IsNull())
+    {
+      const Handle(Geom2d_Curve) aPCurve = BRep_Tool::CurveOnSurface (theEdge, theFace, aFirst, aLast);
+      theStream << !aPCurve.IsNull() << aFirst << aLast;
+      if (!aPCurve.IsNull())
+      {
+        BinTools_Curve2dSet::WriteCurve2d (aPCurve, theStream);
+      }
+    }
+
+    for (TopoDS_Iterator aVertexIt (theEdge); aVertexIt.More(); aVertexIt.Next())
+    {
+      if (aVertexIt.Value().ShapeType() == TopAbs_VERTEX)
+      {
+        const TopoDS_Vertex& aVertex = TopoDS::Vertex (aVertexIt.Value());
+        theStream << BRep_Tool::Pnt (aVertex) << BRep_Tool::Tolerance (aVertex);
+      }
+    }
+  }
+
+  //! Writes geometry of the face defining its tessellation.
+  //! The geometry is taken in coordinate system of the face TShape
+  //! as far as triangulation is stored in it.
+  static void writeFaceGeometry (BinTools_OStream&  theStream,
+                                 const TopoDS_Face& theFace)
+  {
+    const TopoDS_Face aFace = TopoDS::Face (theFace.Located (TopLoc_Location()));
+
+    TopLoc_Location aSurfLoc;
+    const Handle(Geom_Surface)& aSurface = BRep_Tool::Surface (aFace, aSurfLoc);
+    theStream << !aSurface.IsNull()
+              << BRep_Tool::Tolerance (aFace)
+              << BRep_Tool::NaturalRestriction (aFace);
+    if (!aSurface.IsNull())
+    {
+      BinTools_SurfaceSet::WriteSurface (aSurface, theStream);
+      theStream << aSurfLoc.Transformation();
+    }
+
+    for (TopExp_Explorer aEdgeIt (aFace, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+    {
+      writeEdgeGeometry (theStream, TopoDS::Edge (aEdgeIt.Current()), aFace);
+    }
+  }
+
+  //! Writes polygon on triangulation.
+  static void writePolygon (Standard_OStream&                          theStream,
+                            const Handle(Poly_PolygonOnTriangulation)& thePolygon)
+  {
+    BinTools::PutInteger (theStream, thePolygon->NbNodes());
+    BinTools::PutReal    (theStream, thePolygon->Deflection());
+    BinTools::PutBool    (theStream, thePolygon->HasParameters());
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= thePolygon->NbNodes(); ++aNodeIt)
+    {
+      BinTools::PutInteger (theStream, thePolygon->Node (aNodeIt));
+    }
+    if (thePolygon->HasParameters())
+    {
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= thePolygon->NbNodes(); ++aNodeIt)
+      {
+        BinTools::PutReal (theStream, thePolygon->Parameter (aNodeIt));
+      }
+    }
+  }
+
+  //! Reads polygon on triangulation checking its consistency with the number of triangulation nodes.
+  static Handle(Poly_PolygonOnTriangulation) readPolygon (Standard_IStream&      theStream,
+                                                          const Standard_Integer theNbTriaNodes)
+  {
+    Standard_Integer aNbNodes = 0;
+    Standard_Real    aDeflection = 0.;
+    Standard_Boolean hasParameters = Standard_False;
+    BinTools::GetInteger (theStream, aNbNodes);
+    BinTools::GetReal    (theStream, aDeflection);
+    BinTools::GetBool    (theStream, hasParameters);
+    if (!isAvailable (theStream, aNbNodes, THE_SIZE_OF_INTEGER + (hasParameters ? THE_SIZE_OF_REAL : 0)))
+    {
+      return Handle(Poly_PolygonOnTriangulation)();
+    }
+
+    Handle(Poly_PolygonOnTriangulation) aPolygon = new Poly_PolygonOnTriangulation (aNbNodes, hasParameters);
+    aPolygon->Deflection (aDeflection);
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+    {
+      Standard_Integer aNode = 0;
+      BinTools::GetInteger (theStream, aNode);
+      if (aNode < 1 || aNode > theNbTriaNodes)
+      {
+        return Handle(Poly_PolygonOnTriangulation)();
+      }
+      aPolygon->SetNode (aNodeIt, aNode);
+    }
+    if (hasParameters)
+    {
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+      {
+        Standard_Real aParam = 0.;
+        BinTools::GetReal (theStream, aParam);
+        aPolygon->SetParameter (aNodeIt, aParam);
+      }
+    }
+    return !theStream ? Handle(Poly_PolygonOnTriangulation)() : aPolygon;
+  }
+
+  //! Returns description of the shape and meshing parameters identifying the cache entry.
+  //! Locations of the sub-shapes are taken relative to the shape itself,
+  //! so that the description of the moved or instanced shape is the same.
+  static std::string describe (const TopoDS_Shape&          theShape,
+                               const IMeshTools_Parameters& theParameters)
+  {
+    std::ostringstream aBuffer;
+    BinTools_OStream aStream (aBuffer);
+    aStream << THE_FORMAT_VERSION
+            << (Standard_Integer )theParameters.MeshAlgo
+            << theParameters.Angle
+            << theParameters.Deflection
+            << theParameters.AngleInterior
+            << theParameters.DeflectionInterior
+            << theParameters.MinSize
+            << theParameters.Relative
+            << theParameters.InternalVerticesMode
+            << theParameters.ControlSurfaceDeflection
+            << theParameters.AdjustMinSize
+            << theParameters.ForceFaceDeflection;
+
+    const TopLoc_Location aRootLocInv = theShape.Location().Inverted();
+    const ShapeMaps aMaps (theShape);
+    aStream << aMaps.Faces.Extent() << aMaps.EdgeFaces.Extent();
+    for (Standard_Integer aFaceIt = 1; aFaceIt <= aMaps.Faces.Extent(); ++aFaceIt)
+    {
+      const TopoDS_Face& aFace = TopoDS::Face (aMaps.Faces (aFaceIt));
+      writeFaceGeometry (aStream, aFace);
+
+      // Relative position of the faces and sharing of edges between them.
+      aStream << (aRootLocInv * aFace.Location()).Transformation();
+      for (TopExp_Explorer aEdgeIt (aFace, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+      {
+        aStream << aMaps.EdgeFaces.FindIndex (aEdgeIt.Current());
+      }
+    }
+
+    for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aMaps.EdgeFaces.Extent(); ++aEdgeIt)
+    {
+      if (aMaps.EdgeFaces (aEdgeIt).IsEmpty())
+      {
+        const TopoDS_Edge& aEdge = TopoDS::Edge (aMaps.EdgeFaces.FindKey (aEdgeIt));
+        aStream << aEdgeIt;
+        writeEdgeGeometry (aStream, TopoDS::Edge (aEdge.Moved (aRootLocInv)), TopoDS_Face());
+      }
+    }
+    return aBuffer.str();
+  }
+
+  //! Returns the key naming the entry with the given description.
+  static TCollection_AsciiString hashDescription (const std::string& theDescription)
+  {
+    // Two hashes with different seeds make accidental collision of file names negligible,
+    // the description itself is anyway verified on look-up.
+    TCollection_AsciiString aKey;
+    appendHex (aKey, hashBytes (theDescription, 14695981039346656037ULL));
+    appendHex (aKey, hashBytes (theDescription, 0x84222325CBF29CE4ULL));
+    return aKey;
+  }
+
+  //! Writes the description heading the entry.
+  static void writeDescription (Standard_OStream&  theStream,
+                                const std::string& theDescription)
+  {
+    BinTools::PutInteger (theStream, (Standard_Integer )theDescription.size());
+    theStream.write (theDescription.c_str(), (std::streamsize )theDescription.size());
+  }
+
+  //! Reads the description heading the entry and compares it with the given one.
+  static Standard_Boolean checkDescription (Standard_IStream&  theStream,
+                                            const std::string& theDescription)
+  {
+    Standard_Integer aSize = 0;
+    BinTools::GetInteger (theStream, aSize);
+    if (aSize != (Standard_Integer )theDescription.size()
+    || !isAvailable (theStream, aSize, 1))
+    {
+      return Standard_False;
+    }
+
+    std::string aDescription ((size_t )aSize, '\0');
+    theStream.read (&aDescription[0], (std::streamsize )aSize);
+    return theStream && aDescription == theDescription;
+  }
+
+  //! Tessellation data of a face read from the stream.
+  struct FaceData
+  {
+    Handle(Poly_Triangulation) Triangulation;
+    std::vector<Standard_Integer> EdgeIndices;
+    std::vector<Handle(Poly_PolygonOnTriangulation)> Polygons1;
+    std::vector<Handle(Poly_PolygonOnTriangulation)> Polygons2;
+  };
+}
+
+//=======================================================================
+// Function: Constructor
+// Purpose :
+//=======================================================================
+BRepMesh_TessellationCache::BRepMesh_TessellationCache (const TCollection_AsciiString& theDirectory)
+  : myDirectory (theDirectory),
+    mySize      (0),
+    myMaxSize   (THE_DEFAULT_MAX_SIZE),
+    myNbHits    (0),
+    myNbMisses  (0)
+{
+}
+
+//=======================================================================
+// Function: Destructor
+// Purpose :
+//=======================================================================
+BRepMesh_TessellationCache::~BRepMesh_TessellationCache()
+{
+}
+
+//=======================================================================
+// Function: Key
+// Purpose :
+//=======================================================================
+TCollection_AsciiString BRepMesh_TessellationCache::Key (const TopoDS_Shape&          theShape,
+                                                         const IMeshTools_Parameters& theParameters)
+{
+  return hashDescription (describe (theShape, theParameters));
+}
+
+//=======================================================================
+// Function: Write
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_TessellationCache::Write (const TopoDS_Shape& theShape,
+                                                    Standard_OStream&   theStream)
+{
+  const ShapeMaps aMaps (theShape);
+  BinTools::PutInteger (theStream, THE_FORMAT_MAGIC);
+  BinTools::PutInteger (theStream, THE_FORMAT_VERSION);
+  BinTools::PutInteger (theStream, aMaps.Faces.Extent());
+  BinTools::PutInteger (theStream, aMaps.EdgeFaces.Extent());
+
+  Standard_Boolean hasData = Standard_False;
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aMaps.Faces.Extent(); ++aFaceIt)
+  {
+    const TopoDS_Face& aFace = TopoDS::Face (aMaps.Faces (aFaceIt));
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation)& aTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    BinTools::PutBool (theStream, !aTriangulation.IsNull());
+    if (aTriangulation.IsNull())
+    {
+      continue;
+    }
+
+    hasData = Standard_True;
+    const Handle(Poly_TriangulationParameters)& aParams = aTriangulation->Parameters();
+    BinTools::PutInteger (theStream, aTriangulation->NbNodes());
+    BinTools::PutInteger (theStream, aTriangulation->NbTriangles());
+    BinTools::PutBool    (theStream, aTriangulation->HasUVNodes());
+    BinTools::PutReal    (theStream, aTriangulation->Deflection());
+    BinTools::PutBool    (theStream, !aParams.IsNull());
+    if (!aParams.IsNull())
+    {
+      BinTools::PutReal (theStream, aParams->HasDeflection() ? aParams->Deflection() : -1.);
+      BinTools::PutReal (theStream, aParams->HasAngle()      ? aParams->Angle()      : -1.);
+      BinTools::PutReal (theStream, aParams->HasMinSize()    ? aParams->MinSize()    : -1.);
+    }
+
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aTriangulation->NbNodes(); ++aNodeIt)
+    {
+      const gp_Pnt aNode = aTriangulation->Node (aNodeIt);
+      BinTools::PutReal (theStream, aNode.X());
+      BinTools::PutReal (theStream, aNode.Y());
+      BinTools::PutReal (theStream, aNode.Z());
+    }
+    if (aTriangulation->HasUVNodes())
+    {
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aTriangulation->NbNodes(); ++aNodeIt)
+      {
+        const gp_Pnt2d aNode = aTriangulation->UVNode (aNodeIt);
+        BinTools::PutReal (theStream, aNode.X());
+        BinTools::PutReal (theStream, aNode.Y());
+      }
+    }
+    for (Standard_Integer aTriIt = 1; aTriIt <= aTriangulation->NbTriangles(); ++aTriIt)
+    {
+      Standard_Integer aNodes[3];
+      aTriangulation->Triangle (aTriIt).Get (aNodes[0], aNodes[1], aNodes[2]);
+      BinTools::PutInteger (theStream, aNodes[0]);
+      BinTools::PutInteger (theStream, aNodes[1]);
+      BinTools::PutInteger (theStream, aNodes[2]);
+    }
+
+    // Polygons of edges on the triangulation.
+    TopTools_IndexedMapOfShape aFaceEdges;
+    TopExp::MapShapes (aFace, TopAbs_EDGE, aFaceEdges);
+    BinTools::PutInteger (theStream, aFaceEdges.Extent());
+    for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aFaceEdges.Extent(); ++aEdgeIt)
+    {
+      const TopoDS_Edge aEdge = TopoDS::Edge (aFaceEdges (aEdgeIt).Oriented (TopAbs_FORWARD));
+      const Handle(Poly_PolygonOnTriangulation) aPolygon1 =
+        BRep_Tool::PolygonOnTriangulation (aEdge, aTriangulation, aLoc);
+      const Handle(Poly_PolygonOnTriangulation) aPolygon2 =
+        BRep_Tool::IsClosed (aEdge, aTriangulation, aLoc) ?
+        BRep_Tool::PolygonOnTriangulation (TopoDS::Edge (aEdge.Reversed()), aTriangulation, aLoc) :
+        Handle(Poly_PolygonOnTriangulation)();
+
+      BinTools::PutInteger (theStream, aMaps.EdgeFaces.FindIndex (aEdge));
+      BinTools::PutInteger (theStream, aPolygon1.IsNull() ? 0 : (aPolygon2.IsNull() ? 1 : 2));
+      if (!aPolygon1.IsNull())
+      {
+        writePolygon (theStream, aPolygon1);
+        if (!aPolygon2.IsNull())
+        {
+          writePolygon (theStream, aPolygon2);
+        }
+      }
+    }
+  }
+
+  // 3d polygons of free edges.
+  for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aMaps.EdgeFaces.Extent(); ++aEdgeIt)
+  {
+    if (!aMaps.EdgeFaces (aEdgeIt).IsEmpty())
+    {
+      continue;
+    }
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Polygon3D)& aPolygon =
+      BRep_Tool::Polygon3D (TopoDS::Edge (aMaps.EdgeFaces.FindKey (aEdgeIt)), aLoc);
+    BinTools::PutBool (theStream, !aPolygon.IsNull());
+    if (aPolygon.IsNull())
+    {
+      continue;
+    }
+
+    hasData = Standard_True;
+    BinTools::PutInteger (theStream, aPolygon->NbNodes());
+    BinTools::PutReal    (theStream, aPolygon->Deflection());
+    BinTools::PutBool    (theStream, aPolygon->HasParameters());
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aPolygon->NbNodes(); ++aNodeIt)
+    {
+      const gp_Pnt& aNode = aPolygon->Nodes() (aNodeIt);
+      BinTools::PutReal (theStream, aNode.X());
+      BinTools::PutReal (theStream, aNode.Y());
+      BinTools::PutReal (theStream, aNode.Z());
+    }
+    if (aPolygon->HasParameters())
+    {
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aPolygon->NbNodes(); ++aNodeIt)
+      {
+        BinTools::PutReal (theStream, aPolygon->Parameters() (aNodeIt));
+      }
+    }
+  }
+
+  return hasData;
+}
+
+//=======================================================================
+// Function: Read
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_TessellationCache::Read (const TopoDS_Shape& theShape,
+                                                   Standard_IStream&   theStream)
+{
+  const ShapeMaps aMaps (theShape);
+  Standard_Integer aMagic = 0, aVersion = 0, aNbFaces = 0, aNbEdges = 0;
+  BinTools::GetInteger (theStream, aMagic);
+  BinTools::GetInteger (theStream, aVersion);
+  BinTools::GetInteger (theStream, aNbFaces);
+  BinTools::GetInteger (theStream, aNbEdges);
+  if (!theStream
+    || aMagic   != THE_FORMAT_MAGIC
+    || aVersion != THE_FORMAT_VERSION
+    || aNbFaces != aMaps.Faces.Extent()
+    || aNbEdges != aMaps.EdgeFaces.Extent())
+  {
+    return Standard_False;
+  }
+
+  // Read all data before modification of the shape.
+  std::vector<FaceData> aFaces (aNbFaces);
+  for (Standard_Integer aFaceIt = 0; aFaceIt < aNbFaces; ++aFaceIt)
+  {
+    Standard_Boolean hasTriangulation = Standard_False;
+    BinTools::GetBool (theStream, hasTriangulation);
+    if (!hasTriangulation)
+    {
+      continue;
+    }
+
+    Standard_Integer aNbNodes = 0, aNbTriangles = 0;
+    Standard_Boolean hasUVNodes = Standard_False, hasParams = Standard_False;
+    Standard_Real    aDeflection = 0.;
+    BinTools::GetInteger (theStream, aNbNodes);
+    BinTools::GetInteger (theStream, aNbTriangles);
+    BinTools::GetBool    (theStream, hasUVNodes);
+    BinTools::GetReal    (theStream, aDeflection);
+    BinTools::GetBool    (theStream, hasParams);
+    if (!isAvailable (theStream, aNbNodes, THE_SIZE_OF_REAL * (hasUVNodes ? 5 : 3))
+     || !isAvailable (theStream, aNbTriangles, THE_SIZE_OF_INTEGER * 3))
+    {
+      return Standard_False;
+    }
+
+    Handle(Poly_Triangulation) aTriangulation = new Poly_Triangulation (aNbNodes, aNbTriangles, hasUVNodes);
+    aTriangulation->Deflection (aDeflection);
+    if (hasParams)
+    {
+      Standard_Real aParams[3];
+      BinTools::GetReal (theStream, aParams[0]);
+      BinTools::GetReal (theStream, aParams[1]);
+      BinTools::GetReal (theStream, aParams[2]);
+      aTriangulation->Parameters (new Poly_TriangulationParameters (aParams[0], aParams[1], aParams[2]));
+    }
+
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+    {
+      Standard_Real aXYZ[3];
+      BinTools::GetReal (theStream, aXYZ[0]);
+      BinTools::GetReal (theStream, aXYZ[1]);
+      BinTools::GetReal (theStream, aXYZ[2]);
+      aTriangulation->SetNode (aNodeIt, gp_Pnt (aXYZ[0], aXYZ[1], aXYZ[2]));
+    }
+    if (hasUVNodes)
+    {
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+      {
+        Standard_Real aUV[2];
+        BinTools::GetReal (theStream, aUV[0]);
+        BinTools::GetReal (theStream, aUV[1]);
+        aTriangulation->SetUVNode (aNodeIt, gp_Pnt2d (aUV[0], aUV[1]));
+      }
+    }
+    for (Standard_Integer aTriIt = 1; aTriIt <= aNbTriangles; ++aTriIt)
+    {
+      Standard_Integer aNodes[3];
+      BinTools::GetInteger (theStream, aNodes[0]);
+      BinTools::GetInteger (theStream, aNodes[1]);
+      BinTools::GetInteger (theStream, aNodes[2]);
+      for (Standard_Integer aVertIt = 0; aVertIt < 3; ++aVertIt)
+      {
+        if (aNodes[aVertIt] < 1 || aNodes[aVertIt] > aNbNodes)
+        {
+          return Standard_False;
+        }
+      }
+      aTriangulation->SetTriangle (aTriIt, Poly_Triangle (aNodes[0], aNodes[1], aNodes[2]));
+    }
+
+    FaceData& aData = aFaces[aFaceIt];
+    aData.Triangulation = aTriangulation;
+
+    Standard_Integer aNbFaceEdges = 0;
+    BinTools::GetInteger (theStream, aNbFaceEdges);
+    if (!theStream || aNbFaceEdges < 0 || aNbFaceEdges > aNbEdges)
+    {
+      return Standard_False;
+    }
+
+    for (Standard_Integer aEdgeIt = 0; aEdgeIt < aNbFaceEdges; ++aEdgeIt)
+    {
+      Standard_Integer aEdgeIndex = 0, aNbPolygons = 0;
+      BinTools::GetInteger (theStream, aEdgeIndex);
+      BinTools::GetInteger (theStream, aNbPolygons);
+      if (!theStream || aEdgeIndex < 1 || aEdgeIndex > aNbEdges || aNbPolygons < 0 || aNbPolygons > 2)
+      {
+        return Standard_False;
+      }
+
+      Handle(Poly_PolygonOnTriangulation) aPolygons[2];
+      for (Standard_Integer aPolyIt = 0; aPolyIt < aNbPolygons; ++aPolyIt)
+      {
+        aPolygons[aPolyIt] = readPolygon (theStream, aNbNodes);
+        if (aPolygons[aPolyIt].IsNull())
+        {
+          return Standard_False;
+        }
+      }
+
+      aData.EdgeIndices.push_back (aEdgeIndex);
+      aData.Polygons1  .push_back (aPolygons[0]);
+      aData.Polygons2  .push_back (aPolygons[1]);
+    }
+  }
+
+  NCollection_DataMap<Standard_Integer, Handle(Poly_Polygon3D)> aFreePolygons;
+  for (Standard_Integer aEdgeIt = 1; aEdgeIt <= aNbEdges; ++aEdgeIt)
+  {
+    if (!aMaps.EdgeFaces (aEdgeIt).IsEmpty())
+    {
+      continue;
+    }
+
+    Standard_Boolean hasPolygon = Standard_False;
+    BinTools::GetBool (theStream, hasPolygon);
+    if (!hasPolygon)
+    {
+      continue;
+    }
+
+    Standard_Integer aNbNodes = 0;
+    Standard_Real    aDeflection = 0.;
+    Standard_Boolean hasParameters = Standard_False;
+    BinTools::GetInteger (theStream, aNbNodes);
+    BinTools::GetReal    (theStream, aDeflection);
+    BinTools::GetBool    (theStream, hasParameters);
+    if (!isAvailable (theStream, aNbNodes, THE_SIZE_OF_REAL * (hasParameters ? 4 : 3)))
+    {
+      return Standard_False;
+    }
+
+    Handle(Poly_Polygon3D) aPolygon = new Poly_Polygon3D (aNbNodes, hasParameters);
+    aPolygon->Deflection (aDeflection);
+    for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+    {
+      Standard_Real aXYZ[3];
+      BinTools::GetReal (theStream, aXYZ[0]);
+      BinTools::GetReal (theStream, aXYZ[1]);
+      BinTools::GetReal (theStream, aXYZ[2]);
+      aPolygon->ChangeNodes() (aNodeIt).SetCoord (aXYZ[0], aXYZ[1], aXYZ[2]);
+    }
+    if (hasParameters)
+    {
+      for (Standard_Integer aNodeIt = 1; aNodeIt <= aNbNodes; ++aNodeIt)
+      {
+        BinTools::GetReal (theStream, aPolygon->ChangeParameters() (aNodeIt));
+      }
+    }
+    aFreePolygons.Bind (aEdgeIt, aPolygon);
+  }
+
+  if (!theStream)
+  {
+    return Standard_False;
+  }
+
+  // Apply tessellation to the shape.
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aNbFaces; ++aFaceIt)
+  {
+    const FaceData& aData = aFaces[aFaceIt - 1];
+    const TopoDS_Face& aFace = TopoDS::Face (aMaps.Faces (aFaceIt));
+
+    TopLoc_Location aLoc;
+    const Handle(Poly_Triangulation) aOldTriangulation = BRep_Tool::Triangulation (aFace, aLoc);
+    if (!aOldTriangulation.IsNull())
+    {
+      for (TopExp_Explorer aEdgeIt (aFace, TopAbs_EDGE); aEdgeIt.More(); aEdgeIt.Next())
+      {
+        BRepMesh_ShapeTool::NullifyEdge (TopoDS::Edge (aEdgeIt.Current()), aOldTriangulation, aLoc);
+      }
+      BRepMesh_ShapeTool::NullifyFace (aFace);
+    }
+
+    if (aData.Triangulation.IsNull())
+    {
+      continue;
+    }
+
+    BRep_Builder aBuilder;
+    aBuilder.UpdateFace (aFace, aData.Triangulation);
+    for (size_t aEdgeIt = 0; aEdgeIt < aData.EdgeIndices.size(); ++aEdgeIt)
+    {
+      const TopoDS_Edge& aEdge = TopoDS::Edge (aMaps.EdgeFaces.FindKey (aData.EdgeIndices[aEdgeIt]));
+      if (!aData.Polygons2[aEdgeIt].IsNull())
+      {
+        BRepMesh_ShapeTool::UpdateEdge (TopoDS::Edge (aEdge.Oriented (TopAbs_FORWARD)),
+                                        aData.Polygons1[aEdgeIt], aData.Polygons2[aEdgeIt],
+                                        aData.Triangulation, aFace.Location());
+      }
+      else if (!aData.Polygons1[aEdgeIt].IsNull())
+      {
+        BRepMesh_ShapeTool::UpdateEdge (aEdge, aData.Polygons1[aEdgeIt],
+                                        aData.Triangulation, aFace.Location());
+      }
+    }
+  }
+
+  for (NCollection_DataMap<Standard_Integer, Handle(Poly_Polygon3D)>::Iterator aPolyIt (aFreePolygons);
+       aPolyIt.More(); aPolyIt.Next())
+  {
+    BRepMesh_ShapeTool::UpdateEdge (TopoDS::Edge (aMaps.EdgeFaces.FindKey (aPolyIt.Key())), aPolyIt.Value());
+  }
+
+  return Standard_True;
+}
+
+//=======================================================================
+// Function: HasTessellation
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_TessellationCache::HasTessellation (const TopoDS_Shape& theShape)
+{
+  for (TopExp_Explorer aFaceIt (theShape, TopAbs_FACE); aFaceIt.More(); aFaceIt.Next())
+  {
+    TopLoc_Location aLoc;
+    if (!BRep_Tool::Triangulation (TopoDS::Face (aFaceIt.Current()), aLoc).IsNull())
+    {
+      return Standard_True;
+    }
+  }
+
+  for (TopExp_Explorer aEdgeIt (theShape, TopAbs_EDGE, TopAbs_FACE); aEdgeIt.More(); aEdgeIt.Next())
+  {
+    TopLoc_Location aLoc;
+    if (!BRep_Tool::Polygon3D (TopoDS::Edge (aEdgeIt.Current()), aLoc).IsNull())
+    {
+      return Standard_True;
+    }
+  }
+  return Standard_False;
+}
+
+//=======================================================================
+// Function: Restore
+// Purpose :
+//=======================================================================
+Standard_Boolean BRepMesh_TessellationCache::Restore (const TopoDS_Shape&          theShape,
+                                                      const IMeshTools_Parameters& theParameters)
+{
+  if (theShape.IsNull())
+  {
+    return Standard_False;
+  }
+
+  const std::string aDescription = describe (theShape, theParameters);
+  const TCollection_AsciiString aKey = hashDescription (aDescription);
+
+  std::string aData;
+  Standard_Boolean isInMemory = Standard_False;
+  {
+    Standard_Mutex::Sentry aSentry (myMutex);
+    const Entry* aCached = myEntries.Seek (aKey);
+    if (aCached != NULL)
+    {
+      aData = aCached->Data;
+      isInMemory = Standard_True;
+      touchEntry (aKey);
+    }
+  }
+
+  if (!isInMemory && !myDirectory.IsEmpty())
+  {
+    std::ifstream aFile;
+    OSD_OpenStream (aFile, filePath (aKey).ToCString(), std::ios::in | std::ios::binary);
+    if (aFile.is_open())
+    {
+      std::ostringstream aBuffer;
+      aBuffer << aFile.rdbuf();
+      aData = aBuffer.str();
+    }
+  }
+
+  // The entry with the same key is verified to be made for the same shape and parameters.
+  std::istringstream aStream (aData);
+  const Standard_Boolean isRestored = !aData.empty()
+                                   && checkDescription (aStream, aDescription)
+                                   && Read (theShape, aStream);
+
+  Standard_Mutex::Sentry aSentry (myMutex);
+  if (!isRestored)
+  {
+    ++myNbMisses;
+    return Standard_False;
+  }
+
+  ++myNbHits;
+  if (!isInMemory)
+  {
+    bindEntry (aKey, aData);
+  }
+  return Standard_True;
+}
+
+//=======================================================================
+// Function: Store
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::Store (const TopoDS_Shape&          theShape,
+                                        const IMeshTools_Parameters& theParameters)
+{
+  if (theShape.IsNull())
+  {
+    return;
+  }
+
+  const std::string aDescription = describe (theShape, theParameters);
+  const TCollection_AsciiString aKey = hashDescription (aDescription);
+
+  std::ostringstream aStream;
+  writeDescription (aStream, aDescription);
+  if (!Write (theShape, aStream))
+  {
+    return;
+  }
+
+  const std::string aData = aStream.str();
+  {
+    Standard_Mutex::Sentry aSentry (myMutex);
+    bindEntry (aKey, aData);
+  }
+  if (myDirectory.IsEmpty())
+  {
+    return;
+  }
+
+  // Write into temporary file unique for the writer first,
+  // so that concurrent readers never see incomplete entry.
+  const TCollection_AsciiString aPath    = filePath (aKey);
+  const TCollection_AsciiString aTmpPath = aPath + "." + OSD_Process().ProcessId()
+                                         + "." + TCollection_AsciiString ((Standard_Integer )(OSD_Thread::Current() & 0x7FFFFFFF))
+                                         + ".tmp";
+  {
+    std::ofstream aFile;
+    OSD_OpenStream (aFile, aTmpPath.ToCString(), std::ios::out | std::ios::binary);
+    if (!aFile.is_open())
+    {
+      return;
+    }
+    aFile.write (aData.c_str(), (std::streamsize )aData.size());
+    if (!aFile)
+    {
+      aFile.close();
+      std::remove (aTmpPath.ToCString());
+      return;
+    }
+  }
+  if (std::rename (aTmpPath.ToCString(), aPath.ToCString()) != 0)
+  {
+    std::remove (aTmpPath.ToCString());
+  }
+}
+
+//=======================================================================
+// Function: SetMaxSize
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::SetMaxSize (const Standard_Size theMaxSize)
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  myMaxSize = theMaxSize;
+  shrink();
+}
+
+//=======================================================================
+// Function: Size
+// Purpose :
+//=======================================================================
+Standard_Size BRepMesh_TessellationCache::Size() const
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  return mySize;
+}
+
+//=======================================================================
+// Function: Extent
+// Purpose :
+//=======================================================================
+Standard_Integer BRepMesh_TessellationCache::Extent() const
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  return myEntries.Extent();
+}
+
+//=======================================================================
+// Function: Clear
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::Clear()
+{
+  Standard_Mutex::Sentry aSentry (myMutex);
+  myEntries.Clear();
+  myOldest.Clear();
+  myNewest.Clear();
+  mySize     = 0;
+  myNbHits   = 0;
+  myNbMisses = 0;
+}
+
+//=======================================================================
+// Function: filePath
+// Purpose :
+//=======================================================================
+TCollection_AsciiString BRepMesh_TessellationCache::filePath (const TCollection_AsciiString& theKey) const
+{
+  TCollection_AsciiString aPath = myDirectory;
+  if (!aPath.EndsWith ("/") && !aPath.EndsWith ("\\"))
+  {
+    aPath += "/";
+  }
+  return aPath + theKey + ".bmt";
+}
+
+//=======================================================================
+// Function: bindEntry
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::bindEntry (const TCollection_AsciiString& theKey,
+                                            const std::string&             theData)
+{
+  Entry* aEntry = myEntries.ChangeSeek (theKey);
+  if (aEntry != NULL)
+  {
+    mySize -= aEntry->Data.size();
+    aEntry->Data = theData;
+    touchEntry (theKey);
+  }
+  else
+  {
+    aEntry = myEntries.Bound (theKey, Entry());
+    aEntry->Data = theData;
+    linkEntry (theKey, *aEntry);
+  }
+  mySize += theData.size();
+  shrink();
+}
+
+//=======================================================================
+// Function: touchEntry
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::touchEntry (const TCollection_AsciiString& theKey)
+{
+  if (theKey == myNewest)
+  {
+    return;
+  }
+
+  Entry& aEntry = myEntries.ChangeFind (theKey);
+  unlinkEntry (aEntry);
+  linkEntry   (theKey, aEntry);
+}
+
+//=======================================================================
+// Function: unlinkEntry
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::unlinkEntry (Entry& theEntry)
+{
+  if (theEntry.Prev.IsEmpty())
+  {
+    myOldest = theEntry.Next;
+  }
+  else
+  {
+    myEntries.ChangeFind (theEntry.Prev).Next = theEntry.Next;
+  }
+
+  if (theEntry.Next.IsEmpty())
+  {
+    myNewest = theEntry.Prev;
+  }
+  else
+  {
+    myEntries.ChangeFind (theEntry.Next).Prev = theEntry.Prev;
+  }
+
+  theEntry.Prev.Clear();
+  theEntry.Next.Clear();
+}
+
+//=======================================================================
+// Function: linkEntry
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::linkEntry (const TCollection_AsciiString& theKey,
+                                            Entry&                         theEntry)
+{
+  theEntry.Prev = myNewest;
+  theEntry.Next.Clear();
+  if (myNewest.IsEmpty())
+  {
+    myOldest = theKey;
+  }
+  else
+  {
+    myEntries.ChangeFind (myNewest).Next = theKey;
+  }
+  myNewest = theKey;
+}
+
+//=======================================================================
+// Function: shrink
+// Purpose :
+//=======================================================================
+void BRepMesh_TessellationCache::shrink()
+{
+  while (mySize > myMaxSize && !myOldest.IsEmpty())
+  {
+    const TCollection_AsciiString aKey = myOldest;
+    Entry& aEntry = myEntries.ChangeFind (aKey);
+    mySize -= aEntry.Data.size();
+    unlinkEntry (aEntry);
+    myEntries.UnBind (aKey);
+  }
+}
@@ -0,0 +1,193 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BRepMesh_TessellationCache_HeaderFile
+#define _BRepMesh_TessellationCache_HeaderFile
+
+#include <IMeshTools_Parameters.hxx>
+#include <NCollection_DataMap.hxx>
+#include <Standard_Mutex.hxx>
+#include <Standard_Transient.hxx>
+#include <TCollection_AsciiString.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <string>
+
+//! Cache of tessellations produced by BRepMesh_IncrementalMesh.
+//!
+//! The cache entry is identified by the description of the meshing parameters
+//! and the geometry of the shape: surfaces of the faces, pcurves and 3d curves of
+//! their edges, tolerances, vertices, locations of the faces relative to the shape
+//! and sharing of the edges between them. The description does not depend on
+//! the addresses of objects in memory nor on the location of the shape itself,
+//! thus it remains the same for the identical shape loaded anew (e.g. read from file)
+//! in another session and for the moved or instanced shape.
+//! The entries are named by the key hashed from the description (see Key());
+//! each entry keeps the full description as well, which is compared on look-up,
+//! so that the tessellation of another shape is never applied in case of hash collision.
+//!
+//! The entry keeps triangulations of all faces of the shape together with polygons
+//! of their edges and 3d polygons of free edges, so that the tessellation restored
+//! from the cache is conformal in the same way as produced by the mesher.
+//! The entries are stored in compact binary form in memory and, if the directory
+//! is specified, in files named by the key in that directory. The files written
+//! by one process can be used by the others.
+//!
+//! The entries kept in memory are limited by size (see SetMaxSize()), the least
+//! recently used ones are discarded first (in constant time per entry). The files are read and written outside
+//! of the lock; the data read from file is validated before being applied.
+//!
+//! The cache is protected by mutex and can be shared between threads.
+class BRepMesh_TessellationCache : public Standard_Transient
+{
+public:
+
+  //! Constructor.
+  //! @param theDirectory directory for storing of the entries on disk;
+  //!                     if empty, the entries are stored in memory only.
+  Standard_EXPORT BRepMesh_TessellationCache (const TCollection_AsciiString& theDirectory = TCollection_AsciiString());
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BRepMesh_TessellationCache();
+
+  //! Returns directory used for storing of the entries on disk.
+  const TCollection_AsciiString& Directory() const
+  {
+    return myDirectory;
+  }
+
+  //! Returns maximum size of the entries kept in memory in bytes.
+  Standard_Size MaxSize() const
+  {
+    return myMaxSize;
+  }
+
+  //! Sets maximum size of the entries kept in memory in bytes (64 MiB by default).
+  //! The least recently used entries are discarded from memory when the size is exceeded,
+  //! the files on disk are kept.
+  Standard_EXPORT void SetMaxSize (const Standard_Size theMaxSize);
+
+  //! Restores tessellation of the shape from the cache.
+  //! The existing tessellation of the shape (if any) is replaced, thus the caller should
+  //! consult the cache only for the shape which would be meshed from scratch anyway.
+  //! @param theShape shape to be updated by the cached tessellation.
+  //! @param theParameters parameters the shape would be meshed with.
+  //! @return True if the entry has been found, matches the shape and has been applied to it.
+  Standard_EXPORT Standard_Boolean Restore (const TopoDS_Shape&          theShape,
+                                            const IMeshTools_Parameters& theParameters);
+
+  //! Stores the current tessellation of the shape in the cache.
+  //! The tessellation should be produced from scratch with the given parameters,
+  //! otherwise it does not correspond to the entry.
+  //! @param theShape shape with tessellation to be stored.
+  //! @param theParameters parameters the shape has been meshed with.
+  Standard_EXPORT void Store (const TopoDS_Shape&          theShape,
+                              const IMeshTools_Parameters& theParameters);
+
+  //! Returns the key naming the cache entry for the given shape and parameters.
+  //! Only the parameters defining the tessellation produced from scratch are taken into account.
+  Standard_EXPORT static TCollection_AsciiString Key (const TopoDS_Shape&          theShape,
+                                                      const IMeshTools_Parameters& theParameters);
+
+  //! Returns true if some face of the shape has triangulation or some free edge has polygon.
+  Standard_EXPORT static Standard_Boolean HasTessellation (const TopoDS_Shape& theShape);
+
+  //! Writes tessellation of the shape into the stream in binary format.
+  //! @return False if the shape has no tessellation to be stored.
+  Standard_EXPORT static Standard_Boolean Write (const TopoDS_Shape& theShape,
+                                                 Standard_OStream&   theStream);
+
+  //! Reads tessellation from the stream written by Write() method and applies it to the shape.
+  //! The shape should have the same structure as the one used for writing.
+  //! @return False if the data is corrupted or does not correspond to the shape;
+  //!         the shape is not modified in this case.
+  Standard_EXPORT static Standard_Boolean Read (const TopoDS_Shape& theShape,
+                                                Standard_IStream&   theStream);
+
+  //! Returns number of entries kept in memory.
+  Standard_EXPORT Standard_Integer Extent() const;
+
+  //! Returns size of the entries kept in memory in bytes.
+  Standard_EXPORT Standard_Size Size() const;
+
+  //! Returns number of successful look-ups.
+  Standard_Integer NbHits() const
+  {
+    return myNbHits;
+  }
+
+  //! Returns number of failed look-ups.
+  Standard_Integer NbMisses() const
+  {
+    return myNbMisses;
+  }
+
+  //! Clears the entries kept in memory and the statistics.
+  //! The files on disk are kept.
+  Standard_EXPORT void Clear();
+
+  DEFINE_STANDARD_RTTIEXT(BRepMesh_TessellationCache, Standard_Transient)
+
+private:
+
+  //! Returns path of the file for the given key.
+  TCollection_AsciiString filePath (const TCollection_AsciiString& theKey) const;
+
+  //! Puts the entry into memory as the most recently used one
+  //! and discards the least recently used entries exceeding the size limit.
+  //! Should be called under lock.
+  void bindEntry (const TCollection_AsciiString& theKey,
+                  const std::string&             theData);
+
+  //! Marks the entry as the most recently used one.
+  //! Should be called under lock.
+  void touchEntry (const TCollection_AsciiString& theKey);
+
+  //! Discards the least recently used entries exceeding the size limit.
+  //! Should be called under lock.
+  void shrink();
+
+private:
+
+  //! Entry kept in memory, linked into the list of entries
+  //! from the least to the most recently used one by keys of its neighbors.
+  struct Entry
+  {
+    std::string             Data;
+    TCollection_AsciiString Prev; //!< key of the less recently used neighbor, empty for the oldest entry
+    TCollection_AsciiString Next; //!< key of the more recently used neighbor, empty for the newest entry
+  };
+
+  //! Excludes the entry from the list of usage.
+  void unlinkEntry (Entry& theEntry);
+
+  //! Appends the entry to the list of usage as the most recently used one.
+  void linkEntry (const TCollection_AsciiString& theKey,
+                  Entry&                         theEntry);
+
+private:
+
+  TCollection_AsciiString                            myDirectory;
+  NCollection_DataMap<TCollection_AsciiString, Entry> myEntries;
+  TCollection_AsciiString                            myOldest; //!< key of the least recently used entry
+  TCollection_AsciiString                            myNewest; //!< key of the most recently used entry
+  Standard_Size                                      mySize;
+  Standard_Size                                      myMaxSize;
+  Standard_Integer                                   myNbHits;
+  Standard_Integer                                   myNbMisses;
+  mutable Standard_Mutex                             myMutex;
+};
+
+DEFINE_STANDARD_HANDLE(BRepMesh_TessellationCache, Standard_Transient)
+
+#endif
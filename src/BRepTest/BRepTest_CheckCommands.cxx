@@ -137,6 +137,10 @@ static void PrintSub(Standard_OStream& OS,
   TopExp_Explorer exp;
   for (exp.Init(S,Subtype); exp.More(); exp.Next()) {
     const Handle(BRepCheck_Result)& res = Ana.Result(exp.Current());
+    if (res.IsNull())
+    {
+      continue;
+    }
     const TopoDS_Shape& sub = exp.Current();
     for (res->InitContextIterator();
 	 res->MoreShapeInContext(); 
@@ -470,6 +474,10 @@ static void GetProblemSub(const BRepCheck_Analyzer& Ana,
   TopExp_Explorer exp;
   for (exp.Init(Shape,Subtype); exp.More(); exp.Next()) {
     const Handle(BRepCheck_Result)& res = Ana.Result(exp.Current());
+    if (res.IsNull())
+    {
+      continue;
+    }
 
     const TopoDS_Shape& sub = exp.Current();
     for (res->InitContextIterator();
@@ -842,7 +850,7 @@ static Standard_Integer checkshape (Draw_Interpretor& theCommands,
   if (narg == 1)
   {
     theCommands << "\n";
-    theCommands << "Usage : checkshape [-top] shape [result] [-short] [-parallel] [-exact]\n";
+    theCommands << "Usage : checkshape [-top] shape [result] [-short] [-parallel] [-exact] [-stop]\n";
     theCommands << "\n";
     theCommands << "Where :\n";
     theCommands << "   -top      - check topology only.\n";
@@ -852,10 +860,11 @@ static Standard_Integer checkshape (Draw_Interpretor& theCommands,
     theCommands << "   -short    - short description of check.\n";
     theCommands << "   -parallel - run check in parallel.\n";
     theCommands << "   -exact    - run check using exact method.\n";
+    theCommands << "   -stop     - stop check on the first failure (implies -short).\n";
     return 0;
   }
 
-  if (narg > 7)
+  if (narg > 8)
   {
     theCommands << "Invalid number of args!!!\n";
     theCommands << "No args to have help.\n";
@@ -890,6 +899,7 @@ static Standard_Integer checkshape (Draw_Interpretor& theCommands,
   Standard_Boolean IsContextDump = Standard_True;
   Standard_Boolean IsParallel = Standard_False;
   Standard_Boolean IsExact = Standard_False;
+  Standard_Boolean IsStopOnFailure = Standard_False;
   Standard_CString aPref(NULL);
   if (aCurInd < narg && strncmp(a[aCurInd], "-", 1))
   {
@@ -914,6 +924,11 @@ static Standard_Integer checkshape (Draw_Interpretor& theCommands,
     {
       IsExact = Standard_True;
     }
+    else if (anArg == "-stop")
+    {
+      IsStopOnFailure = Standard_True;
+      IsShortDump = Standard_True;
+    }
     else
     {
       theCommands << "Syntax error at '" << anArg << "'";
@@ -924,7 +939,7 @@ static Standard_Integer checkshape (Draw_Interpretor& theCommands,
   try 
   {
     OCC_CATCH_SIGNALS
-    BRepCheck_Analyzer anAna (aShape, aGeomCtrl, IsParallel, IsExact);
+    BRepCheck_Analyzer anAna (aShape, aGeomCtrl, IsParallel, IsExact, IsStopOnFailure);
     Standard_Boolean   isValid = anAna.IsValid();
 
     if (isValid)
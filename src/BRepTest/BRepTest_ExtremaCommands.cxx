@@ -62,7 +62,7 @@ static Standard_Integer distance (Draw_Interpretor& di,
 
 static Standard_Integer distmini(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
-  if (n < 4 || n > 6)
+  if (n < 4 || n > 7)
   {
     return 1;
   }
@@ -79,6 +79,7 @@ static Standard_Integer distmini(Draw_Interpretor& di, Standard_Integer n, const
   }
 
   Standard_Boolean isMultiThread = Standard_False;
+  Standard_Boolean isMeshBound = Standard_False;
   for (Standard_Integer anI = anIndex; anI < n; anI++)
   {
     TCollection_AsciiString anArg(a[anI]);
@@ -87,6 +88,10 @@ static Standard_Integer distmini(Draw_Interpretor& di, Standard_Integer n, const
     {
       isMultiThread = Standard_True;
     }
+    else if (anArg == "-meshbound")
+    {
+      isMeshBound = Standard_True;
+    }
     else
     {
       di << "Syntax error at '" << anArg << "'";
@@ -100,6 +105,7 @@ static Standard_Integer distmini(Draw_Interpretor& di, Standard_Integer n, const
   dst.LoadS2(S2);
   dst.SetDeflection(aDeflection);
   dst.SetMultiThread(isMultiThread);
+  dst.SetMeshBound(isMeshBound);
   dst.Perform(aProgress->Start());
 
   if (dst.IsDone()) 
@@ -436,10 +442,11 @@ void BRepTest::ExtremaCommands (Draw_Interpretor& theCommands)
                    aGroup);
 
   theCommands.Add ("distmini",
-                   "distmini name Shape1 Shape2 [deflection] [-parallel]",
+                   "distmini name Shape1 Shape2 [deflection] [-parallel] [-meshbound]",
                    "\n\t\t: Searches minimal distance between two shapes."
-                   "\n\t\t: The option is:"
-                   "\n\t\t:   -parallel : calculate distance in multithreaded mode"
+                   "\n\t\t: The options are:"
+                   "\n\t\t:   -parallel  : calculate distance in multithreaded mode"
+                   "\n\t\t:   -meshbound : use triangulations of the shapes to bound the distance"
                    __FILE__,
                    distmini,
                    aGroup);
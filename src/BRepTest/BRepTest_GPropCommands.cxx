@@ -22,6 +22,7 @@
 #include <BRepGProp.hxx>
 #include <TopoDS_Shape.hxx>
 #include <GProp_PrincipalProps.hxx>
+#include <NCollection_Array1.hxx>
 
 #include <Draw_Axis3D.hxx>
 #include <Precision.hxx>
@@ -34,7 +35,7 @@ Standard_IMPORT Draw_Viewer dout;
 Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
 {
   if (n < 2) {
-    di << "Use: " << a[0] << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]\n";
+    di << "Use: " << a[0] << " shape [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel]\n";
     di << "Compute properties of the shape, exact geometry (curves, surfaces) or\n";
     di << "some discrete data (polygons, triangulations) can be used for calculations\n";
     di << "The epsilon, if given, defines relative precision of computation\n";
@@ -43,10 +44,30 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
     di << "Shared entities will be take in account only one time in the skip mode\n";
     di << "All values are outputted with the full precision in the full mode.\n";
     di << "Preferable source of geometry data are triangulations in case if it exists, if the -tri key is used.\n";
-    di << "If epsilon is given, exact geometry (curves, surfaces) are used for calculations independently of using key -tri\n\n";
+    di << "If epsilon is given, exact geometry (curves, surfaces) are used for calculations independently of using key -tri\n";
+    di << "Faces are processed in parallel if the -parallel key is used (not applicable to linear properties).\n\n";
     return 1;
   }
 
+  // the -parallel key is accepted at any position after the shape name
+  Standard_Boolean IsParallel = Standard_False;
+  NCollection_Array1<const char*> anArgs (0, n - 1);
+  Standard_Integer aNbArgs = 0;
+  for (Standard_Integer anArgIter = 0; anArgIter < n; ++anArgIter)
+  {
+    if (anArgIter > 1 && strcmp(a[anArgIter], "-parallel") == 0)
+      IsParallel = Standard_True;
+    else
+      anArgs.SetValue (aNbArgs++, a[anArgIter]);
+  }
+  if (IsParallel && *a[0] == 'l')
+  {
+    di << "Syntax error: -parallel key is not applicable to linear properties\n";
+    return 1;
+  }
+  a = &anArgs.ChangeFirst();
+  n = aNbArgs;
+
   Standard_Boolean UseTriangulation = Standard_False;
   if (n >= 2 && strcmp(a[n - 1], "-tri") == 0)
   {
@@ -82,17 +103,17 @@ Standard_Integer props(Draw_Interpretor& di, Standard_Integer n, const char** a)
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S,G,SkipShared);
     else if (*a[0] == 's')
-      eps = BRepGProp::SurfaceProperties(S,G,eps,SkipShared);
+      eps = BRepGProp::SurfaceProperties(S,G,eps,SkipShared,IsParallel);
     else 
-      eps = BRepGProp::VolumeProperties(S,G,eps,onlyClosed,SkipShared);
+      eps = BRepGProp::VolumeProperties(S,G,eps,onlyClosed,SkipShared,IsParallel);
   }
   else {
     if (*a[0] == 'l')
       BRepGProp::LinearProperties(S, G, SkipShared, UseTriangulation);
     else if (*a[0] == 's')
-      BRepGProp::SurfaceProperties(S, G, SkipShared, UseTriangulation);
+      BRepGProp::SurfaceProperties(S, G, SkipShared, UseTriangulation, IsParallel);
     else 
-      BRepGProp::VolumeProperties(S,G,onlyClosed,SkipShared, UseTriangulation);
+      BRepGProp::VolumeProperties(S,G,onlyClosed,SkipShared, UseTriangulation, IsParallel);
   }
   
   gp_Pnt P = G.CentreOfMass();
@@ -333,9 +354,9 @@ void  BRepTest::GPropCommands(Draw_Interpretor& theCommands)
   theCommands.Add("lprops",
     "lprops name [x y z] [-skip] [-full] [-tri]: compute linear properties",
     __FILE__, props, g);
-  theCommands.Add("sprops", "sprops name [epsilon] [x y z] [-skip] [-full] [-tri]:\n"
+  theCommands.Add("sprops", "sprops name [epsilon] [x y z] [-skip] [-full] [-tri] [-parallel]:\n"
 "  compute surfacic properties", __FILE__, props, g);
-  theCommands.Add("vprops", "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri]:\n"
+  theCommands.Add("vprops", "vprops name [epsilon] [c[losed]] [x y z] [-skip] [-full] [-tri] [-parallel]:\n"
 "  compute volumic properties", __FILE__, props, g);
 
   theCommands.Add("vpropsgk",
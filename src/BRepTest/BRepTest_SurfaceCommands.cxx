@@ -337,13 +337,18 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   Standard_Boolean aSameParameterMode = Standard_True;
   Standard_Boolean aFloatingEdgesMode = Standard_False;
   Standard_Boolean aFaceMode = Standard_True;
+  Standard_Boolean aParallelMode = Standard_False;
   Standard_Boolean aSetMinTol = Standard_False;
   Standard_Real aMinTol = 0.;
   Standard_Real aMaxTol = Precision::Infinite();
 
   for (Standard_Integer i = 2; i < theArgc; i++)
   {
-    if (theArgv[i][0] == '-' || theArgv[i][0] == '+')
+    if (!strcasecmp (theArgv[i], "-parallel"))
+    {
+      aParallelMode = Standard_True;
+    }
+    else if (theArgv[i][0] == '-' || theArgv[i][0] == '+')
     {
       Standard_Boolean aVal = (theArgv[i][0] == '+' ? Standard_True : Standard_False);
       switch (tolower(theArgv[i][1]))
@@ -418,6 +423,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
     theDi << "  p - mode for same parameter processing for edges\n";
     theDi << "  e - mode for sewing floating edges\n";
     theDi << "  f - mode for sewing faces\n";
+    theDi << "Key -parallel switches on parallel computations\n";
     return (1);
   }
     
@@ -444,6 +450,7 @@ static Standard_Integer sewing (Draw_Interpretor& theDi,
   aSewing.SetFaceMode (aFaceMode);
   aSewing.SetMinTolerance (aMinTol);
   aSewing.SetMaxTolerance (aMaxTol);
+  aSewing.SetParallel (aParallelMode);
 
   for (Standard_Integer i = 1; i <= aSeq.Length(); i++)
     aSewing.Add(aSeq.Value(i));
@@ -745,7 +752,7 @@ void  BRepTest::SurfaceCommands(Draw_Interpretor& theCommands)
 		  __FILE__,pcurve,g);
 
   theCommands.Add("sewing",
-		  "sewing result [tolerance] shape1 shape2 ... [min tolerance] [max tolerance] [switches]",
+		  "sewing result [tolerance] shape1 shape2 ... [min tolerance] [max tolerance] [switches] [-parallel]",
 		  __FILE__,sewing, g);
 
   theCommands.Add("continuity", 
@@ -138,6 +138,24 @@ void BRepTools_ReShape::Remove (const TopoDS_Shape& shape)
   replace(shape, nulshape, TReplacementKind_Remove);
 }
 
+//=======================================================================
+//function : Append
+//purpose  : 
+//=======================================================================
+
+void BRepTools_ReShape::Append (const BRepTools_ReShape& theOther)
+{
+  for (TShapeToReplacement::Iterator aRIt (theOther.myShapeToReplacement);
+    aRIt.More(); aRIt.Next())
+  {
+    myShapeToReplacement.Bind (aRIt.Key(), aRIt.Value());
+  }
+  for (TopTools_MapOfShape::Iterator aNIt (theOther.myNewShapes); aNIt.More(); aNIt.Next())
+  {
+    myNewShapes.Add (aNIt.Value());
+  }
+}
+
 //=======================================================================
 //function : replace
 //purpose  : 
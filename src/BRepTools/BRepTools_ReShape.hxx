@@ -90,6 +90,14 @@ public:
     }
   }
 
+  //! Adds the requests recorded in another tool to this one.
+  //! The requests of the other tool override the ones recorded
+  //! here for the same shapes. Allows combining the requests of
+  //! the algorithms working in parallel on independent parts of
+  //! the shape, each with its own tool.
+  //! Both tools should have the same ModeConsiderLocation.
+  Standard_EXPORT void Append (const BRepTools_ReShape& theOther);
+
   //! Tells if a shape is recorded for Replace/Remove
   Standard_EXPORT virtual Standard_Boolean IsRecorded (const TopoDS_Shape& shape) const;
   
@@ -172,6 +172,56 @@ void BSplCLib_Cache::D0(const Standard_Real& theParameter, gp_Pnt& thePoint) con
     thePoint.ChangeCoord().Divide(aPoint[3]);
 }
 
+void BSplCLib_Cache::D0(const TColStd_Array1OfReal& theParameters,
+                        const Standard_Integer      theLower,
+                        const Standard_Integer      theUpper,
+                              TColgp_Array1OfPnt&   thePoints) const
+{
+  // Number of points evaluated together; the inner loops run over the points of the block
+  const Standard_Integer THE_BLOCK = 8;
+
+  const Standard_Real*   aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Integer aDimension  = myPolesWeights->RowLength(); // number of columns
+  const Standard_Integer aDegree     = myParams.Degree;
+
+  Standard_Real aParams[THE_BLOCK];
+  Standard_Real aPoint[4][THE_BLOCK];
+  for (Standard_Integer aStart = theLower; aStart <= theUpper; aStart += THE_BLOCK)
+  {
+    const Standard_Integer aNb = Min(THE_BLOCK, theUpper - aStart + 1);
+    for (Standard_Integer k = 0; k < aNb; ++k)
+    {
+      aParams[k] = (myParams.PeriodicNormalization(theParameters.Value(aStart + k)) - myParams.SpanStart)
+                 / myParams.SpanLength;
+    }
+
+    // Horner scheme
+    const Standard_Real* aRow = aPolesArray + aDegree * aDimension;
+    for (Standard_Integer aDim = 0; aDim < aDimension; ++aDim)
+    {
+      for (Standard_Integer k = 0; k < aNb; ++k)
+        aPoint[aDim][k] = aRow[aDim];
+    }
+    for (Standard_Integer aDeg = aDegree - 1; aDeg >= 0; --aDeg)
+    {
+      aRow = aPolesArray + aDeg * aDimension;
+      for (Standard_Integer aDim = 0; aDim < aDimension; ++aDim)
+      {
+        for (Standard_Integer k = 0; k < aNb; ++k)
+          aPoint[aDim][k] = aPoint[aDim][k] * aParams[k] + aRow[aDim];
+      }
+    }
+
+    for (Standard_Integer k = 0; k < aNb; ++k)
+    {
+      gp_Pnt& aPnt = thePoints.ChangeValue(aStart + k);
+      aPnt.SetCoord(aPoint[0][k], aPoint[1][k], aPoint[2][k]);
+      if (myIsRational)
+        aPnt.ChangeCoord().Divide(aPoint[3][k]);
+    }
+  }
+}
+
 
 void BSplCLib_Cache::D1(const Standard_Real& theParameter, gp_Pnt2d& thePoint, gp_Vec2d& theTangent) const
 {
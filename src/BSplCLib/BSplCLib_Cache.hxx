@@ -16,6 +16,7 @@
 
 #include <BSplCLib_CacheParams.hxx>
 #include <TColStd_HArray2OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
 
 //! \brief A cache class for Bezier and B-spline curves.
 //!
@@ -79,6 +80,18 @@ public:
   Standard_EXPORT void D0(const Standard_Real& theParameter, gp_Pnt2d& thePoint) const;
   Standard_EXPORT void D0(const Standard_Real& theParameter, gp_Pnt&   thePoint) const;
 
+  //! Calculates the points on the curve for the range of parameters lying in the cached span.
+  //! The points are processed in blocks to let the compiler vectorize evaluation
+  //! of the polynomial over several parameters at once.
+  //! \param[in]  theParameters parameters of the points
+  //! \param[in]  theLower      first index of the range in theParameters
+  //! \param[in]  theUpper      last index of the range in theParameters
+  //! \param[out] thePoints     the results of calculation placed with the same indices as parameters
+  Standard_EXPORT void D0(const TColStd_Array1OfReal& theParameters,
+                          const Standard_Integer      theLower,
+                          const Standard_Integer      theUpper,
+                                TColgp_Array1OfPnt&   thePoints) const;
+
   //! Calculates the point on the curve and its first derivative in the specified parameter
   //! \param[in]  theParameter parameter of calculation of the value
   //! \param[out] thePoint     the result of calculation (the point on the curve)
@@ -0,0 +1,142 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BSplCLib_SharedCache.hxx>
+
+#include <BSplCLib.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplCLib_SharedCache, Standard_Transient)
+
+namespace
+{
+  //! Number of slots for spans allocated at once.
+  static const Standard_Integer THE_CHUNK_SIZE = 64;
+}
+
+//=======================================================================
+//function : BSplCLib_SharedCache
+//purpose  :
+//=======================================================================
+BSplCLib_SharedCache::BSplCLib_SharedCache (const Standard_Integer               theDegree,
+                                            const Standard_Boolean               thePeriodic,
+                                            const Handle(TColStd_HArray1OfReal)& theFlatKnots,
+                                            const Handle(TColgp_HArray1OfPnt)&   thePoles,
+                                            const Handle(TColStd_HArray1OfReal)& theWeights,
+                                            const Standard_Integer               theMaxNbSpans)
+: myFlatKnots (theFlatKnots),
+  myPoles (thePoles),
+  myWeights (theWeights),
+  myParams (theDegree, thePeriodic, theFlatKnots->Array1()),
+  myNbSpans (myParams.SpanIndexMax - myParams.SpanIndexMin + 1),
+  myNbChunks ((myNbSpans + THE_CHUNK_SIZE - 1) / THE_CHUNK_SIZE),
+  myMaxNbSpans (Max (theMaxNbSpans, 0)),
+  myNbBuilt (0),
+  myChunks (NULL)
+{
+  myChunks = new std::atomic<std::atomic<BSplCLib_Cache*>*>[myNbChunks];
+  for (Standard_Integer aChunkIt = 0; aChunkIt < myNbChunks; ++aChunkIt)
+  {
+    myChunks[aChunkIt].store (NULL, std::memory_order_relaxed);
+  }
+}
+
+//=======================================================================
+//function : ~BSplCLib_SharedCache
+//purpose  :
+//=======================================================================
+BSplCLib_SharedCache::~BSplCLib_SharedCache()
+{
+  for (Standard_Integer aChunkIt = 0; aChunkIt < myNbChunks; ++aChunkIt)
+  {
+    std::atomic<BSplCLib_Cache*>* aChunk = myChunks[aChunkIt].load (std::memory_order_relaxed);
+    if (aChunk == NULL)
+    {
+      continue;
+    }
+
+    for (Standard_Integer aSpanIt = 0; aSpanIt < THE_CHUNK_SIZE; ++aSpanIt)
+    {
+      BSplCLib_Cache* aCache = aChunk[aSpanIt].load (std::memory_order_relaxed);
+      if (aCache != NULL && aCache->DecrementRefCounter() == 0)
+      {
+        aCache->Delete();
+      }
+    }
+    delete[] aChunk;
+  }
+  delete[] myChunks;
+}
+
+//=======================================================================
+//function : Cache
+//purpose  :
+//=======================================================================
+Handle(BSplCLib_Cache) BSplCLib_SharedCache::Cache (const Standard_Real theParameter) const
+{
+  // locate the span the same way as BSplCLib_CacheParams::LocateParameter() does
+  Standard_Real    aParam = myParams.PeriodicNormalization (theParameter);
+  Standard_Integer aSpan  = 0;
+  BSplCLib::LocateParameter (myParams.Degree, myFlatKnots->Array1(), BSplCLib::NoMults(),
+                             aParam, myParams.IsPeriodic, aSpan, aParam);
+  aSpan = Max (myParams.SpanIndexMin, Min (aSpan, myParams.SpanIndexMax)) - myParams.SpanIndexMin;
+
+  std::atomic<std::atomic<BSplCLib_Cache*>*>& aChunkSlot = myChunks[aSpan / THE_CHUNK_SIZE];
+  std::atomic<BSplCLib_Cache*>* aChunk = aChunkSlot.load (std::memory_order_acquire);
+  if (aChunk == NULL)
+  {
+    std::atomic<BSplCLib_Cache*>* aNewChunk = new std::atomic<BSplCLib_Cache*>[THE_CHUNK_SIZE];
+    for (Standard_Integer aSpanIt = 0; aSpanIt < THE_CHUNK_SIZE; ++aSpanIt)
+    {
+      aNewChunk[aSpanIt].store (NULL, std::memory_order_relaxed);
+    }
+    if (aChunkSlot.compare_exchange_strong (aChunk, aNewChunk, std::memory_order_acq_rel))
+    {
+      aChunk = aNewChunk;
+    }
+    else
+    {
+      // another thread has allocated the same chunk in the meantime
+      delete[] aNewChunk;
+    }
+  }
+
+  std::atomic<BSplCLib_Cache*>& aSlot = aChunk[aSpan % THE_CHUNK_SIZE];
+  BSplCLib_Cache* aCache = aSlot.load (std::memory_order_acquire);
+  if (aCache != NULL)
+  {
+    return aCache;
+  }
+
+  const TColStd_Array1OfReal* aWeights = !myWeights.IsNull() ? &myWeights->Array1() : NULL;
+  Handle(BSplCLib_Cache) aNewCache = new BSplCLib_Cache (myParams.Degree, myParams.IsPeriodic,
+                                                         myFlatKnots->Array1(), myPoles->Array1(), aWeights);
+  aNewCache->BuildCache (theParameter, myFlatKnots->Array1(), myPoles->Array1(), aWeights);
+  if (myNbBuilt.fetch_add (1, std::memory_order_relaxed) >= myMaxNbSpans)
+  {
+    // the limit is reached, the cache is not shared
+    myNbBuilt.fetch_sub (1, std::memory_order_relaxed);
+    return aNewCache;
+  }
+
+  // the reference held by the slot is released in destructor
+  aNewCache->IncrementRefCounter();
+  if (aSlot.compare_exchange_strong (aCache, aNewCache.get(), std::memory_order_acq_rel))
+  {
+    return aNewCache;
+  }
+
+  // another thread has built the same span in the meantime
+  aNewCache->DecrementRefCounter();
+  myNbBuilt.fetch_sub (1, std::memory_order_relaxed);
+  return aCache;
+}
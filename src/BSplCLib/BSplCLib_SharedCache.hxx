@@ -0,0 +1,91 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplCLib_SharedCache_HeaderFile
+#define _BSplCLib_SharedCache_HeaderFile
+
+#include <BSplCLib_Cache.hxx>
+#include <TColgp_HArray1OfPnt.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+
+#include <atomic>
+
+//! \brief Cache of all spans of a 3D B-spline curve shared between its evaluators.
+//!
+//! Unlike BSplCLib_Cache, which is rebuilt in going from span to span, this class
+//! keeps the caches of requested spans of the curve. The cache of a span is built on first
+//! request and is never modified afterwards, thus the object can be used concurrently
+//! by several threads without locks (see BSplSLib_SharedCache for details).
+//! The slots for the spans are allocated by chunks on first request, and the number
+//! of kept caches is limited; the caches of further spans are not shared.
+//!
+//! The object keeps references to the arrays of the curve, so it should be
+//! discarded when the curve is modified (see Geom_BSplineCurve::CreateSharedCache()).
+class BSplCLib_SharedCache : public Standard_Transient
+{
+public:
+
+  //! Constructor.
+  //! \param theDegree     degree of the curve
+  //! \param thePeriodic   identify whether the curve is periodic
+  //! \param theFlatKnots  knots of the curve (with repetitions)
+  //! \param thePoles      array of poles of the curve
+  //! \param theWeights    array of weights of corresponding poles, NULL for non-rational curve
+  //! \param theMaxNbSpans maximal number of spans kept in the cache
+  Standard_EXPORT BSplCLib_SharedCache (const Standard_Integer               theDegree,
+                                        const Standard_Boolean               thePeriodic,
+                                        const Handle(TColStd_HArray1OfReal)& theFlatKnots,
+                                        const Handle(TColgp_HArray1OfPnt)&   thePoles,
+                                        const Handle(TColStd_HArray1OfReal)& theWeights,
+                                        const Standard_Integer               theMaxNbSpans);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BSplCLib_SharedCache();
+
+  //! Returns the cache of the span containing the given parameter.
+  //! The cache is built on first request. When the limit of kept spans is reached,
+  //! the returned cache is built for the caller only. In any case it should not be
+  //! rebuilt by the caller.
+  Standard_EXPORT Handle(BSplCLib_Cache) Cache (const Standard_Real theParameter) const;
+
+  //! Returns number of spans having the cache kept.
+  Standard_Integer NbBuiltSpans() const { return myNbBuilt.load (std::memory_order_relaxed); }
+
+  //! Returns maximal number of spans kept in the cache.
+  Standard_Integer MaxNbSpans() const { return myMaxNbSpans; }
+
+  DEFINE_STANDARD_RTTIEXT(BSplCLib_SharedCache, Standard_Transient)
+
+private:
+
+  // copying is prohibited
+  BSplCLib_SharedCache (const BSplCLib_SharedCache&);
+  void operator = (const BSplCLib_SharedCache&);
+
+private:
+
+  Handle(TColStd_HArray1OfReal) myFlatKnots;
+  Handle(TColgp_HArray1OfPnt)   myPoles;
+  Handle(TColStd_HArray1OfReal) myWeights;
+  BSplCLib_CacheParams          myParams;  //!< parameters of spans
+  Standard_Integer              myNbSpans;    //!< number of spans
+  Standard_Integer              myNbChunks;   //!< number of chunks of slots
+  Standard_Integer              myMaxNbSpans; //!< maximal number of kept spans
+  mutable std::atomic<Standard_Integer> myNbBuilt; //!< number of kept spans
+  std::atomic<std::atomic<BSplCLib_Cache*>*>* myChunks; //!< chunks of slots allocated on first request,
+                                                        //!  each kept cache holds a reference
+};
+
+DEFINE_STANDARD_HANDLE(BSplCLib_SharedCache, Standard_Transient)
+
+#endif
@@ -141,6 +141,89 @@ void BSplSLib_Cache::D0(const Standard_Real& theU,
 }
 
 
+void BSplSLib_Cache::D0(const TColgp_Array1OfPnt2d& theUV,
+                        const Standard_Integer      theLower,
+                        const Standard_Integer      theUpper,
+                              TColgp_Array1OfPnt&   thePoints) const
+{
+  // Number of points evaluated together; the inner loops run over the points of the block
+  const Standard_Integer THE_BLOCK = 8;
+
+  const Standard_Real aSpanLengthU = 0.5 * myParamsU.SpanLength;
+  const Standard_Real aSpanStartU  = myParamsU.SpanStart + aSpanLengthU;
+  const Standard_Real aSpanLengthV = 0.5 * myParamsV.SpanLength;
+  const Standard_Real aSpanStartV  = myParamsV.SpanStart + aSpanLengthV;
+
+  const Standard_Real*   aPolesArray = ConvertArray(myPolesWeights);
+  const Standard_Integer aDimension  = myIsRational ? 4 : 3;
+  const Standard_Integer aCacheCols  = myPolesWeights->RowLength();
+  const Standard_Boolean isMaxU      = myParamsU.Degree > myParamsV.Degree;
+  const Standard_Integer aMinDegree  = Min(myParamsU.Degree, myParamsV.Degree);
+  const Standard_Integer aMaxDegree  = Max(myParamsU.Degree, myParamsV.Degree);
+
+  Standard_Real aParamMin[THE_BLOCK], aParamMax[THE_BLOCK];
+  Standard_Real aPoint[4][THE_BLOCK];
+  NCollection_LocalArray<Standard_Real> aTransientCoeffs(aCacheCols * THE_BLOCK); // [column][point]
+
+  for (Standard_Integer aStart = theLower; aStart <= theUpper; aStart += THE_BLOCK)
+  {
+    const Standard_Integer aNb = Min(THE_BLOCK, theUpper - aStart + 1);
+    for (Standard_Integer k = 0; k < aNb; ++k)
+    {
+      const gp_Pnt2d& aUV = theUV.Value(aStart + k);
+      const Standard_Real aNewU = (myParamsU.PeriodicNormalization(aUV.X()) - aSpanStartU) / aSpanLengthU;
+      const Standard_Real aNewV = (myParamsV.PeriodicNormalization(aUV.Y()) - aSpanStartV) / aSpanLengthV;
+      aParamMin[k] = isMaxU ? aNewV : aNewU;
+      aParamMax[k] = isMaxU ? aNewU : aNewV;
+    }
+
+    // Calculate intermediate value of cached polynomial along columns (Horner scheme)
+    const Standard_Real* aRow = aPolesArray + aMaxDegree * aCacheCols;
+    for (Standard_Integer aCol = 0; aCol < aCacheCols; ++aCol)
+    {
+      Standard_Real* aCoeffs = &aTransientCoeffs[aCol * THE_BLOCK];
+      for (Standard_Integer k = 0; k < aNb; ++k)
+        aCoeffs[k] = aRow[aCol];
+    }
+    for (Standard_Integer aDeg = aMaxDegree - 1; aDeg >= 0; --aDeg)
+    {
+      aRow = aPolesArray + aDeg * aCacheCols;
+      for (Standard_Integer aCol = 0; aCol < aCacheCols; ++aCol)
+      {
+        Standard_Real* aCoeffs = &aTransientCoeffs[aCol * THE_BLOCK];
+        for (Standard_Integer k = 0; k < aNb; ++k)
+          aCoeffs[k] = aCoeffs[k] * aParamMax[k] + aRow[aCol];
+      }
+    }
+
+    // Calculate total value
+    for (Standard_Integer aDim = 0; aDim < aDimension; ++aDim)
+    {
+      const Standard_Real* aCoeffs = &aTransientCoeffs[(aMinDegree * aDimension + aDim) * THE_BLOCK];
+      for (Standard_Integer k = 0; k < aNb; ++k)
+        aPoint[aDim][k] = aCoeffs[k];
+    }
+    for (Standard_Integer aDeg = aMinDegree - 1; aDeg >= 0; --aDeg)
+    {
+      for (Standard_Integer aDim = 0; aDim < aDimension; ++aDim)
+      {
+        const Standard_Real* aCoeffs = &aTransientCoeffs[(aDeg * aDimension + aDim) * THE_BLOCK];
+        for (Standard_Integer k = 0; k < aNb; ++k)
+          aPoint[aDim][k] = aPoint[aDim][k] * aParamMin[k] + aCoeffs[k];
+      }
+    }
+
+    for (Standard_Integer k = 0; k < aNb; ++k)
+    {
+      gp_Pnt& aPnt = thePoints.ChangeValue(aStart + k);
+      aPnt.SetCoord(aPoint[0][k], aPoint[1][k], aPoint[2][k]);
+      if (myIsRational)
+        aPnt.ChangeCoord().Divide(aPoint[3][k]);
+    }
+  }
+}
+
+
 void BSplSLib_Cache::D1(const Standard_Real& theU, 
                         const Standard_Real& theV, 
                               gp_Pnt&        thePoint, 
@@ -16,6 +16,8 @@
 
 #include <TColStd_HArray2OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 
 #include <BSplCLib_CacheParams.hxx>
 
@@ -73,6 +75,18 @@ public:
   //! \param[out] thePoint  the result of calculation (the point on the surface)
   Standard_EXPORT void D0(const Standard_Real& theU, const Standard_Real& theV, gp_Pnt& thePoint) const;
 
+  //! Calculates the points on the surface for the range of parameters lying in the cached span.
+  //! The points are processed in blocks to let the compiler vectorize evaluation
+  //! of the polynomials over several parameters at once.
+  //! \param[in]  theUV      parameters of the points
+  //! \param[in]  theLower   first index of the range in theUV
+  //! \param[in]  theUpper   last index of the range in theUV
+  //! \param[out] thePoints  the results of calculation placed with the same indices as parameters
+  Standard_EXPORT void D0(const TColgp_Array1OfPnt2d& theUV,
+                          const Standard_Integer      theLower,
+                          const Standard_Integer      theUpper,
+                                TColgp_Array1OfPnt&   thePoints) const;
+
   //! Calculates the point on the surface and its first derivative
   //! \param[in]  theU         first parameter of calculation of the value
   //! \param[in]  theV         second parameter of calculation of the value
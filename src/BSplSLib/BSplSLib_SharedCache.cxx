@@ -0,0 +1,155 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#include <BSplSLib_SharedCache.hxx>
+
+#include <BSplCLib.hxx>
+
+IMPLEMENT_STANDARD_RTTIEXT(BSplSLib_SharedCache, Standard_Transient)
+
+//=======================================================================
+//function : BSplSLib_SharedCache
+//purpose  :
+//=======================================================================
+BSplSLib_SharedCache::BSplSLib_SharedCache (const Standard_Integer               theDegreeU,
+                                            const Standard_Boolean               thePeriodicU,
+                                            const Handle(TColStd_HArray1OfReal)& theFlatKnotsU,
+                                            const Standard_Integer               theDegreeV,
+                                            const Standard_Boolean               thePeriodicV,
+                                            const Handle(TColStd_HArray1OfReal)& theFlatKnotsV,
+                                            const Handle(TColgp_HArray2OfPnt)&   thePoles,
+                                            const Handle(TColStd_HArray2OfReal)& theWeights,
+                                            const Standard_Integer               theMaxNbSpans)
+: myFlatKnotsU (theFlatKnotsU),
+  myFlatKnotsV (theFlatKnotsV),
+  myPoles (thePoles),
+  myWeights (theWeights),
+  myParamsU (theDegreeU, thePeriodicU, theFlatKnotsU->Array1()),
+  myParamsV (theDegreeV, thePeriodicV, theFlatKnotsV->Array1()),
+  myNbSpansU (myParamsU.SpanIndexMax - myParamsU.SpanIndexMin + 1),
+  myNbSpansV (myParamsV.SpanIndexMax - myParamsV.SpanIndexMin + 1),
+  myMaxNbSpans (Max (theMaxNbSpans, 0)),
+  myNbBuilt (0),
+  myRows (NULL)
+{
+  myRows = new std::atomic<std::atomic<BSplSLib_Cache*>*>[myNbSpansU];
+  for (Standard_Integer aRowIt = 0; aRowIt < myNbSpansU; ++aRowIt)
+  {
+    myRows[aRowIt].store (NULL, std::memory_order_relaxed);
+  }
+}
+
+//=======================================================================
+//function : ~BSplSLib_SharedCache
+//purpose  :
+//=======================================================================
+BSplSLib_SharedCache::~BSplSLib_SharedCache()
+{
+  for (Standard_Integer aRowIt = 0; aRowIt < myNbSpansU; ++aRowIt)
+  {
+    std::atomic<BSplSLib_Cache*>* aRow = myRows[aRowIt].load (std::memory_order_relaxed);
+    if (aRow == NULL)
+    {
+      continue;
+    }
+
+    for (Standard_Integer aSpanIt = 0; aSpanIt < myNbSpansV; ++aSpanIt)
+    {
+      BSplSLib_Cache* aCache = aRow[aSpanIt].load (std::memory_order_relaxed);
+      if (aCache != NULL && aCache->DecrementRefCounter() == 0)
+      {
+        aCache->Delete();
+      }
+    }
+    delete[] aRow;
+  }
+  delete[] myRows;
+}
+
+//=======================================================================
+//function : locateSpan
+//purpose  :
+//=======================================================================
+Standard_Integer BSplSLib_SharedCache::locateSpan (const BSplCLib_CacheParams& theParams,
+                                                   const TColStd_Array1OfReal& theFlatKnots,
+                                                   const Standard_Real         theParameter)
+{
+  // the same way as BSplCLib_CacheParams::LocateParameter() does
+  Standard_Real    aParam = theParams.PeriodicNormalization (theParameter);
+  Standard_Integer aSpanIndex = 0;
+  BSplCLib::LocateParameter (theParams.Degree, theFlatKnots, BSplCLib::NoMults(),
+                             aParam, theParams.IsPeriodic, aSpanIndex, aParam);
+  return Max (theParams.SpanIndexMin, Min (aSpanIndex, theParams.SpanIndexMax));
+}
+
+//=======================================================================
+//function : Cache
+//purpose  :
+//=======================================================================
+Handle(BSplSLib_Cache) BSplSLib_SharedCache::Cache (const Standard_Real theU,
+                                                    const Standard_Real theV) const
+{
+  const Standard_Integer aSpanU = locateSpan (myParamsU, myFlatKnotsU->Array1(), theU);
+  const Standard_Integer aSpanV = locateSpan (myParamsV, myFlatKnotsV->Array1(), theV);
+  std::atomic<std::atomic<BSplSLib_Cache*>*>& aRowSlot = myRows[aSpanU - myParamsU.SpanIndexMin];
+  std::atomic<BSplSLib_Cache*>* aRow = aRowSlot.load (std::memory_order_acquire);
+  if (aRow == NULL)
+  {
+    std::atomic<BSplSLib_Cache*>* aNewRow = new std::atomic<BSplSLib_Cache*>[myNbSpansV];
+    for (Standard_Integer aSpanIt = 0; aSpanIt < myNbSpansV; ++aSpanIt)
+    {
+      aNewRow[aSpanIt].store (NULL, std::memory_order_relaxed);
+    }
+    if (aRowSlot.compare_exchange_strong (aRow, aNewRow, std::memory_order_acq_rel))
+    {
+      aRow = aNewRow;
+    }
+    else
+    {
+      // another thread has allocated the same row in the meantime
+      delete[] aNewRow;
+    }
+  }
+
+  std::atomic<BSplSLib_Cache*>& aSlot = aRow[aSpanV - myParamsV.SpanIndexMin];
+  BSplSLib_Cache* aCache = aSlot.load (std::memory_order_acquire);
+  if (aCache != NULL)
+  {
+    return aCache;
+  }
+
+  const TColStd_Array2OfReal* aWeights = !myWeights.IsNull() ? &myWeights->Array2() : NULL;
+  Handle(BSplSLib_Cache) aNewCache = new BSplSLib_Cache (myParamsU.Degree, myParamsU.IsPeriodic, myFlatKnotsU->Array1(),
+                                                         myParamsV.Degree, myParamsV.IsPeriodic, myFlatKnotsV->Array1(),
+                                                         aWeights);
+  aNewCache->BuildCache (theU, theV, myFlatKnotsU->Array1(), myFlatKnotsV->Array1(),
+                         myPoles->Array2(), aWeights);
+  if (myNbBuilt.fetch_add (1, std::memory_order_relaxed) >= myMaxNbSpans)
+  {
+    // the limit is reached, the cache is not shared
+    myNbBuilt.fetch_sub (1, std::memory_order_relaxed);
+    return aNewCache;
+  }
+
+  // the reference held by the slot is released in destructor
+  aNewCache->IncrementRefCounter();
+  if (aSlot.compare_exchange_strong (aCache, aNewCache.get(), std::memory_order_acq_rel))
+  {
+    return aNewCache;
+  }
+
+  // another thread has built the same span in the meantime
+  aNewCache->DecrementRefCounter();
+  myNbBuilt.fetch_sub (1, std::memory_order_relaxed);
+  return aCache;
+}
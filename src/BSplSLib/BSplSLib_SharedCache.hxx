@@ -0,0 +1,107 @@
+// Copyright (c) 2023 OPEN CASCADE SAS
+//
+// This file is part of Open CASCADE Technology software library.
+//
+// This library is free software; you can redistribute it and/or modify it under
+// the terms of the GNU Lesser General Public License version 2.1 as published
+// by the Free Software Foundation, with special exception defined in the file
+// OCCT_LGPL_EXCEPTION.txt. Consult the file LICENSE_LGPL_21.txt included in OCCT
+// distribution for complete text of the license and disclaimer of any warranty.
+//
+// Alternatively, this file may be used under the terms of Open CASCADE
+// commercial license or contractual agreement.
+
+#ifndef _BSplSLib_SharedCache_HeaderFile
+#define _BSplSLib_SharedCache_HeaderFile
+
+#include <BSplSLib_Cache.hxx>
+#include <TColgp_HArray2OfPnt.hxx>
+#include <TColStd_HArray1OfReal.hxx>
+
+#include <atomic>
+
+//! \brief Cache of all spans of a B-spline surface shared between its evaluators.
+//!
+//! Unlike BSplSLib_Cache, which is rebuilt in going from span to span, this class
+//! keeps the caches of requested spans of the surface. The cache of a span is built on first
+//! request and is never modified afterwards, thus the object can be used concurrently
+//! by several threads: the look-up does not involve locks, concurrent requests of
+//! the same span not built yet may build it twice, only one result is kept.
+//! The slots for the spans of a row (along V) are allocated on first request of a span
+//! of this row, and the number of kept caches is limited; the caches of further spans
+//! are not shared.
+//!
+//! The object keeps references to the arrays of the surface, so it should be
+//! discarded when the surface is modified (see Geom_BSplineSurface::CreateSharedCache()).
+class BSplSLib_SharedCache : public Standard_Transient
+{
+public:
+
+  //! Constructor.
+  //! \param theDegreeU    degree along the first parameter (U) of the surface
+  //! \param thePeriodicU  identify the surface is periodical along U axis
+  //! \param theFlatKnotsU knots of the surface (with repetition) along U axis
+  //! \param theDegreeV    degree along the second parameter (V) of the surface
+  //! \param thePeriodicV  identify the surface is periodical along V axis
+  //! \param theFlatKnotsV knots of the surface (with repetition) along V axis
+  //! \param thePoles      array of poles of the surface
+  //! \param theWeights    array of weights of corresponding poles, NULL for non-rational surface
+  //! \param theMaxNbSpans maximal number of spans kept in the cache
+  Standard_EXPORT BSplSLib_SharedCache (const Standard_Integer               theDegreeU,
+                                        const Standard_Boolean               thePeriodicU,
+                                        const Handle(TColStd_HArray1OfReal)& theFlatKnotsU,
+                                        const Standard_Integer               theDegreeV,
+                                        const Standard_Boolean               thePeriodicV,
+                                        const Handle(TColStd_HArray1OfReal)& theFlatKnotsV,
+                                        const Handle(TColgp_HArray2OfPnt)&   thePoles,
+                                        const Handle(TColStd_HArray2OfReal)& theWeights,
+                                        const Standard_Integer               theMaxNbSpans);
+
+  //! Destructor.
+  Standard_EXPORT virtual ~BSplSLib_SharedCache();
+
+  //! Returns the cache of the span containing the point with the given parameters.
+  //! The cache is built on first request. When the limit of kept spans is reached,
+  //! the returned cache is built for the caller only. In any case it should not be
+  //! rebuilt by the caller.
+  Standard_EXPORT Handle(BSplSLib_Cache) Cache (const Standard_Real theU,
+                                                const Standard_Real theV) const;
+
+  //! Returns number of spans having the cache kept.
+  Standard_Integer NbBuiltSpans() const { return myNbBuilt.load (std::memory_order_relaxed); }
+
+  //! Returns maximal number of spans kept in the cache.
+  Standard_Integer MaxNbSpans() const { return myMaxNbSpans; }
+
+  DEFINE_STANDARD_RTTIEXT(BSplSLib_SharedCache, Standard_Transient)
+
+private:
+
+  //! Returns index of the span containing the given parameter.
+  static Standard_Integer locateSpan (const BSplCLib_CacheParams& theParams,
+                                      const TColStd_Array1OfReal& theFlatKnots,
+                                      const Standard_Real         theParameter);
+
+  // copying is prohibited
+  BSplSLib_SharedCache (const BSplSLib_SharedCache&);
+  void operator = (const BSplSLib_SharedCache&);
+
+private:
+
+  Handle(TColStd_HArray1OfReal) myFlatKnotsU;
+  Handle(TColStd_HArray1OfReal) myFlatKnotsV;
+  Handle(TColgp_HArray2OfPnt)   myPoles;
+  Handle(TColStd_HArray2OfReal) myWeights;
+  BSplCLib_CacheParams          myParamsU;   //!< parameters of spans along U
+  BSplCLib_CacheParams          myParamsV;   //!< parameters of spans along V
+  Standard_Integer              myNbSpansU;   //!< number of spans along U
+  Standard_Integer              myNbSpansV;   //!< number of spans along V
+  Standard_Integer              myMaxNbSpans; //!< maximal number of kept spans
+  mutable std::atomic<Standard_Integer> myNbBuilt; //!< number of kept spans
+  std::atomic<std::atomic<BSplSLib_Cache*>*>* myRows; //!< rows of slots allocated on first request,
+                                                      //!  each kept cache holds a reference
+};
+
+DEFINE_STANDARD_HANDLE(BSplSLib_SharedCache, Standard_Transient)
+
+#endif
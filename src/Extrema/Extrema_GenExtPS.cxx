@@ -32,7 +32,11 @@
 #include <math_FunctionSetRoot.hxx>
 #include <math_NewtonFunctionSetRoot.hxx>
 #include <math_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
+#include <Standard_ErrorHandler.hxx>
+#include <Standard_NotImplemented.hxx>
 #include <Standard_OutOfRange.hxx>
 #include <StdFail_NotDone.hxx>
 #include <TColStd_Array2OfInteger.hxx>
@@ -516,77 +520,88 @@ const Extrema_POnSurfParams& Extrema_GenExtPS::ComputeEdgeParameters
   }
 }
 
-void Extrema_GenExtPS::BuildGrid(const gp_Pnt &thePoint)
+void Extrema_GenExtPS::BuildGridPoints()
 {
+  //if grid was already built skip its creation
+  if (myInit)
+    return;
+
   Standard_Integer NoU, NoV;
+  //build parametric grid in case of a complex surface geometry (BSpline and Bezier surfaces)
+  GetGridPoints(*myS);
+  
+  //build grid in other cases 
+  if( myUParams.IsNull() )
+  {
+    Standard_Real PasU = myusup - myumin;
+    Standard_Real U0 = PasU / myusample / 100.;
+    PasU = (PasU - U0) / (myusample - 1);
+    U0 = U0/2. + myumin;
+    myUParams = new TColStd_HArray1OfReal(1,myusample );
+    Standard_Real U = U0;
+    for ( NoU = 1 ; NoU <= myusample; NoU++, U += PasU) 
+      myUParams->SetValue(NoU, U);
+  }
 
-  //if grid was already built skip its creation
-  if (!myInit) {
-    //build parametric grid in case of a complex surface geometry (BSpline and Bezier surfaces)
-    GetGridPoints(*myS);
+  if( myVParams.IsNull())
+  {
+    Standard_Real PasV = myvsup - myvmin;
+    Standard_Real V0 = PasV / myvsample / 100.;
+    PasV = (PasV - V0) / (myvsample - 1);
+    V0 = V0/2. + myvmin;
     
-    //build grid in other cases 
-    if( myUParams.IsNull() )
-    {
-      Standard_Real PasU = myusup - myumin;
-      Standard_Real U0 = PasU / myusample / 100.;
-      PasU = (PasU - U0) / (myusample - 1);
-      U0 = U0/2. + myumin;
-      myUParams = new TColStd_HArray1OfReal(1,myusample );
-      Standard_Real U = U0;
-      for ( NoU = 1 ; NoU <= myusample; NoU++, U += PasU) 
-        myUParams->SetValue(NoU, U);
-    }
-  
-    if( myVParams.IsNull())
-    {
-      Standard_Real PasV = myvsup - myvmin;
-      Standard_Real V0 = PasV / myvsample / 100.;
-      PasV = (PasV - V0) / (myvsample - 1);
-      V0 = V0/2. + myvmin;
-      
-      myVParams = new TColStd_HArray1OfReal(1,myvsample );
-      Standard_Real V = V0;
-     
-      for ( NoV = 1, V = V0; NoV <= myvsample; NoV++, V += PasV)
-        myVParams->SetValue(NoV, V);
-    }
+    myVParams = new TColStd_HArray1OfReal(1,myvsample );
+    Standard_Real V = V0;
+   
+    for ( NoV = 1, V = V0; NoV <= myvsample; NoV++, V += PasV)
+      myVParams->SetValue(NoV, V);
+  }
 
-    //If flag was changed and extrema not reinitialized Extrema would fail
-    myPoints.Resize (0, myusample + 1, 0, myvsample + 1, false);
-    // Calculation of distances
-  
-    for ( NoU = 1 ; NoU <= myusample; NoU++ ) {
-      for ( NoV = 1 ; NoV <= myvsample; NoV++) {
-        gp_Pnt aP1 = myS->Value(myUParams->Value(NoU), myVParams->Value(NoV));
-        Extrema_POnSurfParams aParam
-          (myUParams->Value(NoU), myVParams->Value(NoV), aP1);
-
-        aParam.SetElementType(Extrema_Node);
-        aParam.SetIndices(NoU, NoV);
-        myPoints.SetValue(NoU, NoV, aParam);
-      }
-    }
+  //If flag was changed and extrema not reinitialized Extrema would fail
+  myPoints.Resize (0, myusample + 1, 0, myvsample + 1, false);
+  // Calculation of grid nodes, evaluated row by row in batches
+  TColgp_Array1OfPnt2d aRowUV (1, myvsample);
+  TColgp_Array1OfPnt   aRowPnts (1, myvsample);
+  for ( NoU = 1 ; NoU <= myusample; NoU++ ) {
+    for ( NoV = 1 ; NoV <= myvsample; NoV++)
+      aRowUV.SetValue(NoV, gp_Pnt2d(myUParams->Value(NoU), myVParams->Value(NoV)));
+    myS->BatchD0(aRowUV, aRowPnts);
 
-    myFacePntParams .Resize (0, myusample,     0, myvsample, false);
-    myUEdgePntParams.Resize (1, myusample - 1, 1, myvsample, false);
-    myVEdgePntParams.Resize (1, myusample,     1, myvsample - 1, false);
+    for ( NoV = 1 ; NoV <= myvsample; NoV++) {
+      Extrema_POnSurfParams aParam
+        (myUParams->Value(NoU), myVParams->Value(NoV), aRowPnts.Value(NoV));
 
-    // Fill boundary with negative square distance.
-    // It is used for computation of Maximum.
-    for (NoV = 0; NoV <= myvsample + 1; NoV++) {
-      myPoints.ChangeValue(0, NoV).SetSqrDistance(-1.);
-      myPoints.ChangeValue(myusample + 1, NoV).SetSqrDistance(-1.);
+      aParam.SetElementType(Extrema_Node);
+      aParam.SetIndices(NoU, NoV);
+      myPoints.SetValue(NoU, NoV, aParam);
     }
+  }
 
-    for (NoU = 1; NoU <= myusample; NoU++) {
-      myPoints.ChangeValue(NoU, 0).SetSqrDistance(-1.);
-      myPoints.ChangeValue(NoU, myvsample + 1).SetSqrDistance(-1.);
-    }
-    
-    myInit = Standard_True;
+  myFacePntParams .Resize (0, myusample,     0, myvsample, false);
+  myUEdgePntParams.Resize (1, myusample - 1, 1, myvsample, false);
+  myVEdgePntParams.Resize (1, myusample,     1, myvsample - 1, false);
+
+  // Fill boundary with negative square distance.
+  // It is used for computation of Maximum.
+  for (NoV = 0; NoV <= myvsample + 1; NoV++) {
+    myPoints.ChangeValue(0, NoV).SetSqrDistance(-1.);
+    myPoints.ChangeValue(myusample + 1, NoV).SetSqrDistance(-1.);
   }
 
+  for (NoU = 1; NoU <= myusample; NoU++) {
+    myPoints.ChangeValue(NoU, 0).SetSqrDistance(-1.);
+    myPoints.ChangeValue(NoU, myvsample + 1).SetSqrDistance(-1.);
+  }
+  
+  myInit = Standard_True;
+}
+
+void Extrema_GenExtPS::BuildGrid(const gp_Pnt &thePoint)
+{
+  Standard_Integer NoU, NoV;
+
+  BuildGridPoints();
+
   // Compute distances to mesh.
   // Step 1. Compute distances to nodes.
   for ( NoU = 1 ; NoU <= myusample; NoU++ ) {
@@ -827,7 +842,6 @@ void Extrema_GenExtPS::BuildTree()
   Standard_Real PasV = myvsup - myvmin;
   Standard_Real U0 = PasU / myusample / 100.;
   Standard_Real V0 = PasV / myvsample / 100.;
-  gp_Pnt P1;
   PasU = (PasU - U0) / (myusample - 1);
   PasV = (PasV - V0) / (myvsample - 1);
   U0 = U0/2. + myumin;
@@ -850,9 +864,15 @@ void Extrema_GenExtPS::BuildTree()
   
   mySphereArray = new Bnd_HArray1OfSphere(0, myusample * myvsample);
  
+  TColgp_Array1OfPnt2d aRowUV (1, myvsample);
+  TColgp_Array1OfPnt   aRowPnts (1, myvsample);
   for ( NoU = 1; NoU <= myusample; NoU++ ) {
+    for ( NoV = 1; NoV <= myvsample; NoV++)
+      aRowUV.SetValue(NoV, gp_Pnt2d(myUParams->Value(NoU), myVParams->Value(NoV)));
+    myS->BatchD0(aRowUV, aRowPnts);
+
     for ( NoV = 1; NoV <= myvsample; NoV++) {
-      P1 = myS->Value(myUParams->Value(NoU), myVParams->Value(NoV));
+      const gp_Pnt& P1 = aRowPnts.Value(NoV);
       Bnd_Sphere aSph(P1.XYZ(), 0/*mytolu < mytolv ? mytolu : mytolv*/, NoU, NoV);
       aFiller.Add(i, aSph);
       mySphereArray->SetValue( i, aSph );
@@ -1066,6 +1086,182 @@ void Extrema_GenExtPS::Perform(const gp_Pnt& P)
     }
   }
 }
+
+//=======================================================================
+//class   : Extrema_GenExtPS_BatchFunctor
+//purpose : Projects points of the batch by the per-thread search objects
+//=======================================================================
+class Extrema_GenExtPS_BatchFunctor
+{
+public:
+  Extrema_GenExtPS_BatchFunctor (NCollection_Array1<Extrema_GenExtPS>& theExtPS,
+                                 const TColgp_Array1OfPnt& thePoints,
+                                 TColStd_Array1OfReal&     theSqDist,
+                                 TColgp_Array1OfPnt2d&     theUV)
+  : myExtPS (theExtPS),
+    myPoints (thePoints),
+    mySqDist (theSqDist),
+    myUV (theUV)
+  {
+  }
+
+  void operator() (Standard_Integer theThreadIndex, Standard_Integer theIndex) const
+  {
+    const Standard_Integer anOutIndex = theIndex - myPoints.Lower();
+    Standard_Real& aSqDist = mySqDist.ChangeValue (mySqDist.Lower() + anOutIndex);
+    gp_Pnt2d&      aUV     = myUV    .ChangeValue (myUV    .Lower() + anOutIndex);
+    aSqDist = -1.;
+    try
+    {
+      OCC_CATCH_SIGNALS
+      Extrema_GenExtPS& anExtPS = myExtPS.ChangeValue (theThreadIndex);
+      anExtPS.Perform (myPoints.Value (theIndex));
+      if (!anExtPS.IsDone())
+      {
+        return;
+      }
+
+      for (Standard_Integer anExtIt = 1; anExtIt <= anExtPS.NbExt(); ++anExtIt)
+      {
+        const Standard_Real aDist = anExtPS.SquareDistance (anExtIt);
+        if (aSqDist < 0. || aDist < aSqDist)
+        {
+          Standard_Real aU = 0., aV = 0.;
+          anExtPS.Point (anExtIt).Parameter (aU, aV);
+          aSqDist = aDist;
+          aUV.SetCoord (aU, aV);
+        }
+      }
+    }
+    catch (Standard_Failure const&)
+    {
+      aSqDist = -1.;
+    }
+  }
+
+private:
+  Extrema_GenExtPS_BatchFunctor& operator= (const Extrema_GenExtPS_BatchFunctor&) Standard_DELETE;
+
+private:
+  NCollection_Array1<Extrema_GenExtPS>& myExtPS;
+  const TColgp_Array1OfPnt&             myPoints;
+  TColStd_Array1OfReal&                 mySqDist;
+  TColgp_Array1OfPnt2d&                 myUV;
+};
+
+//=======================================================================
+//function : Perform
+//purpose  : 
+//=======================================================================
+void Extrema_GenExtPS::Perform (const TColgp_Array1OfPnt& thePoints,
+                                TColStd_Array1OfReal&     theSqDist,
+                                TColgp_Array1OfPnt2d&     theUV,
+                                const Standard_Boolean    theToRunParallel)
+{
+  if (myS == NULL)
+  {
+    throw StdFail_NotDone ("Extrema_GenExtPS::Perform() - the surface is not initialized");
+  }
+  if (theSqDist.Length() != thePoints.Length()
+   || theUV    .Length() != thePoints.Length())
+  {
+    throw Standard_DimensionMismatch ("Extrema_GenExtPS::Perform() - arrays of different size");
+  }
+  if (thePoints.IsEmpty())
+  {
+    return;
+  }
+
+  // build the sampling once for all queries
+  if (myAlgo == Extrema_ExtAlgo_Grad)
+  {
+    BuildGridPoints();
+  }
+  else
+  {
+    BuildTree();
+  }
+
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  Standard_Integer aNbThreads = theToRunParallel
+                              ? Min (thePoints.Length(), aThreadPool->NbDefaultThreadsToLaunch())
+                              : 1;
+  NCollection_Array1<Handle(Adaptor3d_Surface)> aSurfaces (0, aNbThreads - 1);
+  if (aNbThreads > 1)
+  {
+    try
+    {
+      for (Standard_Integer aThreadIt = 0; aThreadIt < aNbThreads; ++aThreadIt)
+      {
+        aSurfaces.SetValue (aThreadIt, myS->ShallowCopy());
+      }
+    }
+    catch (Standard_NotImplemented const&)
+    {
+      // the adaptor cannot be shared between threads
+      aNbThreads = 1;
+    }
+  }
+
+  NCollection_Array1<Extrema_GenExtPS> anExtPS (0, aNbThreads - 1);
+  for (Standard_Integer aThreadIt = 0; aThreadIt < aNbThreads; ++aThreadIt)
+  {
+    anExtPS.ChangeValue (aThreadIt).CopySampling (*this, aNbThreads > 1 ? *aSurfaces.Value (aThreadIt) : *myS);
+  }
+
+  Extrema_GenExtPS_BatchFunctor aFunctor (anExtPS, thePoints, theSqDist, theUV);
+  if (aNbThreads > 1)
+  {
+    OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+    aLauncher.Perform (thePoints.Lower(), thePoints.Upper() + 1, aFunctor);
+  }
+  else
+  {
+    for (Standard_Integer aPntIt = thePoints.Lower(); aPntIt <= thePoints.Upper(); ++aPntIt)
+    {
+      aFunctor (0, aPntIt);
+    }
+  }
+}
+
+//=======================================================================
+//function : CopySampling
+//purpose  : 
+//=======================================================================
+void Extrema_GenExtPS::CopySampling (const Extrema_GenExtPS&  theOther,
+                                     const Adaptor3d_Surface& theSurf)
+{
+  myS       = &theSurf;
+  myumin    = theOther.myumin;
+  myusup    = theOther.myusup;
+  myvmin    = theOther.myvmin;
+  myvsup    = theOther.myvsup;
+  myusample = theOther.myusample;
+  myvsample = theOther.myvsample;
+  mytolu    = theOther.mytolu;
+  mytolv    = theOther.mytolv;
+  myFlag    = Extrema_ExtFlag_MIN;
+  myAlgo    = theOther.myAlgo;
+  myF.Initialize (theSurf);
+
+  // the parameters and the tree are read-only during the search and can be shared
+  myUParams      = theOther.myUParams;
+  myVParams      = theOther.myVParams;
+  mySphereUBTree = theOther.mySphereUBTree;
+  mySphereArray  = theOther.mySphereArray;
+
+  // the grid keeps distances to the current point and thus is copied
+  myInit = theOther.myInit;
+  if (myInit)
+  {
+    myPoints.Resize (theOther.myPoints.LowerRow(), theOther.myPoints.UpperRow(),
+                     theOther.myPoints.LowerCol(), theOther.myPoints.UpperCol(), false);
+    myPoints.Assign (theOther.myPoints);
+    myFacePntParams .Resize (0, myusample,     0, myvsample, false);
+    myUEdgePntParams.Resize (1, myusample - 1, 1, myvsample, false);
+    myVEdgePntParams.Resize (1, myusample,     1, myvsample - 1, false);
+  }
+}
 //=============================================================================
 
 Standard_Boolean Extrema_GenExtPS::IsDone () const { return myDone; }
@@ -25,6 +25,8 @@
 #include <Extrema_ExtFlag.hxx>
 #include <Extrema_ExtAlgo.hxx>
 #include <TColStd_HArray1OfReal.hxx>
+#include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 
 class Adaptor3d_Surface;
 
@@ -79,6 +81,25 @@ public:
   //! An exception is raised if the fields have not
   //! been initialized.
   Standard_EXPORT void Perform (const gp_Pnt& P);
+
+  //! Searches the nearest point on the surface for each point of the given set.
+  //! Only the minimum distance is searched, independently of the flag set by SetFlag().
+  //! The sampling of the surface (grid or tree of samples depending on the algorithm)
+  //! is built once and shared by all queries, the samples are evaluated in batches.
+  //! In parallel mode the queries are distributed between threads, each thread working
+  //! with its own shallow copy of the surface adaptor; if the adaptor does not support
+  //! shallow copying the queries are performed sequentially.
+  //! The results of the single-point Perform() are not affected.
+  //! An exception is raised if the fields have not been initialized.
+  //! @param thePoints        [in]  points to be projected
+  //! @param theSqDist        [out] square distances to the nearest points on the surface,
+  //!                               -1 for the points which could not be projected
+  //! @param theUV            [out] parameters of the nearest points on the surface
+  //! @param theToRunParallel [in]  flag to perform the queries in parallel
+  Standard_EXPORT void Perform (const TColgp_Array1OfPnt& thePoints,
+                                TColStd_Array1OfReal&     theSqDist,
+                                TColgp_Array1OfPnt2d&     theUV,
+                                const Standard_Boolean    theToRunParallel = Standard_False);
   
   Standard_EXPORT void SetFlag (const Extrema_ExtFlag F);
   
@@ -105,8 +126,15 @@ private:
   //! Selection of points to build grid, depending on the type of surface
   Standard_EXPORT void GetGridPoints (const Adaptor3d_Surface& theSurf);
   
-  //! Creation of grid of parametric points
+  //! Creation of grid of parametric points and evaluation of its nodes
+  Standard_EXPORT void BuildGridPoints();
+
+  //! Computation of distances from the point to the grid
   Standard_EXPORT void BuildGrid (const gp_Pnt& thePoint);
+
+  //! Initializes this object for searching of minimum distances to the given
+  //! surface adaptor using the sampling already built by theOther.
+  void CopySampling (const Extrema_GenExtPS& theOther, const Adaptor3d_Surface& theSurf);
   
   //! Compute new edge parameters.
   Standard_EXPORT const Extrema_POnSurfParams& ComputeEdgeParameters (const Standard_Boolean IsUEdge, const Extrema_POnSurfParams& theParam0, const Extrema_POnSurfParams& theParam1, const gp_Pnt& thePoints, const Standard_Real theDiffTol);
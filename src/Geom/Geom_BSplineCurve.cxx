@@ -31,6 +31,7 @@
 
 
 #include <BSplCLib.hxx>
+#include <BSplCLib_SharedCache.hxx>
 #include <ElCLib.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_Geometry.hxx>
@@ -112,6 +113,31 @@ Handle(Geom_Geometry) Geom_BSplineCurve::Copy() const
   return C;
 }
 
+//=======================================================================
+//function : CreateSharedCache
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineCurve::CreateSharedCache (const Standard_Integer theMaxNbSpans)
+{
+  if (mySharedCache.IsNull())
+  {
+    mySharedCache = new BSplCLib_SharedCache (deg, periodic, flatknots, poles,
+                                              rational ? weights : Handle(TColStd_HArray1OfReal)(),
+                                              theMaxNbSpans);
+  }
+}
+
+//=======================================================================
+//function : ReleaseSharedCache
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineCurve::ReleaseSharedCache()
+{
+  mySharedCache.Nullify();
+}
+
 //=======================================================================
 //function : Geom_BSplineCurve
 //purpose  : 
@@ -227,6 +253,7 @@ Standard_Integer Geom_BSplineCurve::MaxDegree ()
 
 void Geom_BSplineCurve::IncreaseDegree  (const Standard_Integer Degree)
 {
+  invalidateSharedCache();
   if (Degree == deg) return;
   
   if (Degree < deg || Degree > Geom_BSplineCurve::MaxDegree()) {
@@ -275,6 +302,7 @@ void Geom_BSplineCurve::IncreaseDegree  (const Standard_Integer Degree)
 void Geom_BSplineCurve::IncreaseMultiplicity  (const Standard_Integer Index,
 					       const Standard_Integer M)
 {
+  invalidateSharedCache();
   TColStd_Array1OfReal k(1,1);
   k(1) = knots->Value(Index);
   TColStd_Array1OfInteger m(1,1);
@@ -291,6 +319,7 @@ void Geom_BSplineCurve::IncreaseMultiplicity  (const Standard_Integer I1,
 					       const Standard_Integer I2,
 					       const Standard_Integer M)
 {
+  invalidateSharedCache();
   Handle(TColStd_HArray1OfReal)  tk = knots;
   TColStd_Array1OfReal k((knots->Array1())(I1),I1,I2);
   TColStd_Array1OfInteger m(I1,I2);
@@ -310,6 +339,7 @@ void Geom_BSplineCurve::IncrementMultiplicity
  const Standard_Integer I2,
  const Standard_Integer Step)
 {
+  invalidateSharedCache();
   Handle(TColStd_HArray1OfReal) tk = knots;
   TColStd_Array1OfReal    k((knots->Array1())(I1),I1,I2);
   TColStd_Array1OfInteger m(I1,I2) ;
@@ -328,6 +358,7 @@ void Geom_BSplineCurve::InsertKnot
  const Standard_Real ParametricTolerance,
  const Standard_Boolean Add)
 {
+  invalidateSharedCache();
   TColStd_Array1OfReal k(1,1);
   k(1) = U;
   TColStd_Array1OfInteger m(1,1);
@@ -345,6 +376,7 @@ void  Geom_BSplineCurve::InsertKnots(const TColStd_Array1OfReal& Knots,
 				     const Standard_Real Epsilon,
 				     const Standard_Boolean Add)
 {
+  invalidateSharedCache();
   // Check and compute new sizes
   Standard_Integer nbpoles,nbknots;
 
@@ -393,6 +425,7 @@ Standard_Boolean  Geom_BSplineCurve::RemoveKnot(const Standard_Integer Index,
 						const Standard_Integer M, 
 						const Standard_Real Tolerance)
 {
+  invalidateSharedCache();
   if (M < 0) return Standard_True;
 
   Standard_Integer I1  = FirstUKnotIndex ();
@@ -454,6 +487,7 @@ Standard_Boolean  Geom_BSplineCurve::RemoveKnot(const Standard_Integer Index,
 
 void Geom_BSplineCurve::Reverse ()
 { 
+  invalidateSharedCache();
   BSplCLib::Reverse(knots->ChangeArray1());
   BSplCLib::Reverse(mults->ChangeArray1());
   Standard_Integer last;
@@ -487,6 +521,7 @@ void Geom_BSplineCurve::Segment(const Standard_Real U1,
                                 const Standard_Real U2,
                                 const Standard_Real theTolerance)
 {
+  invalidateSharedCache();
   if (U2 < U1)
     throw Standard_DomainError("Geom_BSplineCurve::Segment");
   
@@ -645,6 +680,7 @@ void Geom_BSplineCurve::SetKnot
 (const Standard_Integer Index,
  const Standard_Real K)
 {
+  invalidateSharedCache();
   if (Index < 1 || Index > knots->Length())     throw Standard_OutOfRange("BSpline curve: SetKnot: Index and #knots mismatch");
   Standard_Real DK = Abs(Epsilon (K));
   if (Index == 1) { 
@@ -676,6 +712,7 @@ void Geom_BSplineCurve::SetKnot
 void Geom_BSplineCurve::SetKnots
 (const TColStd_Array1OfReal& K)
 {
+  invalidateSharedCache();
   CheckCurveData(poles->Array1(),K,mults->Array1(),deg,periodic);
   knots->ChangeArray1() = K;
   maxderivinvok = 0;
@@ -692,6 +729,7 @@ void Geom_BSplineCurve::SetKnot
  const Standard_Real K,
  const Standard_Integer M)
 {
+  invalidateSharedCache();
   IncreaseMultiplicity (Index, M);
   SetKnot (Index, K);
 }
@@ -703,6 +741,7 @@ void Geom_BSplineCurve::SetKnot
 
 void Geom_BSplineCurve::SetPeriodic ()
 {
+  invalidateSharedCache();
   Standard_Integer first = FirstUKnotIndex();
   Standard_Integer last  = LastUKnotIndex();
 
@@ -745,6 +784,7 @@ void Geom_BSplineCurve::SetPeriodic ()
 
 void Geom_BSplineCurve::SetOrigin(const Standard_Integer Index)
 {
+  invalidateSharedCache();
   if (!periodic)
     throw Standard_NoSuchObject("Geom_BSplineCurve::SetOrigin");
 
@@ -835,6 +875,7 @@ void Geom_BSplineCurve::SetOrigin(const Standard_Integer Index)
 void Geom_BSplineCurve::SetOrigin(const Standard_Real U,
 				  const Standard_Real Tol)
 {
+  invalidateSharedCache();
   if (!periodic)
     throw Standard_NoSuchObject("Geom_BSplineCurve::SetOrigin");
   //U est il dans la period.
@@ -880,6 +921,7 @@ void Geom_BSplineCurve::SetOrigin(const Standard_Real U,
 
 void Geom_BSplineCurve::SetNotPeriodic () 
 { 
+  invalidateSharedCache();
   if ( periodic) {
     Standard_Integer NbKnots, NbPoles;
     BSplCLib::PrepareUnperiodize( deg, mults->Array1(),NbKnots,NbPoles);
@@ -924,6 +966,7 @@ void Geom_BSplineCurve::SetPole
 (const Standard_Integer Index,
  const gp_Pnt& P)
 {
+  invalidateSharedCache();
   if (Index < 1 || Index > poles->Length()) throw Standard_OutOfRange("BSpline curve: SetPole: index and #pole mismatch");
   poles->SetValue (Index, P);
   maxderivinvok = 0;
@@ -939,6 +982,7 @@ void Geom_BSplineCurve::SetPole
  const gp_Pnt& P,
  const Standard_Real W)
 {
+  invalidateSharedCache();
   SetPole(Index,P);
   SetWeight(Index,W);
 }
@@ -952,6 +996,7 @@ void Geom_BSplineCurve::SetWeight
 (const Standard_Integer Index,
  const Standard_Real W)
 {
+  invalidateSharedCache();
   if (Index < 1 || Index > poles->Length())   throw Standard_OutOfRange("BSpline curve: SetWeight: Index and #pole mismatch");
 
   if (W <= gp::Resolution ())     throw Standard_ConstructionError("BSpline curve: SetWeight: Weight too small");
@@ -989,6 +1034,7 @@ void Geom_BSplineCurve::MovePoint(const Standard_Real U,
                                   Standard_Integer& FirstModifiedPole,
                                   Standard_Integer& LastmodifiedPole)
 {
+  invalidateSharedCache();
   if (Index1 < 1 || Index1 > poles->Length() || 
       Index2 < 1 || Index2 > poles->Length() || Index1 > Index2) {
     throw Standard_OutOfRange("BSpline curve: MovePoint: Index and #pole mismatch");
@@ -1012,13 +1058,14 @@ void Geom_BSplineCurve::MovePoint(const Standard_Real U,
 //=======================================================================
 
 void Geom_BSplineCurve::MovePointAndTangent(const Standard_Real    U,
-                                            const gp_Pnt&          P,
-                                            const gp_Vec&          Tangent,
-                                            const Standard_Real    Tolerance,
-                                            const Standard_Integer StartingCondition,
-                                            const Standard_Integer EndingCondition,
-                                            Standard_Integer&      ErrorStatus) 
+                                               const gp_Pnt&          P,
+                                               const gp_Vec&          Tangent,
+                                               const Standard_Real    Tolerance,
+                                               const Standard_Integer StartingCondition,
+                                               const Standard_Integer EndingCondition,
+                                               Standard_Integer&      ErrorStatus) 
 {
+  invalidateSharedCache();
   Standard_Integer ii ;
   if (IsPeriodic()) {
     //
@@ -1062,6 +1109,7 @@ void Geom_BSplineCurve::MovePointAndTangent(const Standard_Real    U,
 
 void Geom_BSplineCurve::UpdateKnots()
 {
+  invalidateSharedCache();
   rational = !weights.IsNull();
 
   Standard_Integer MaxKnotMult = 0;
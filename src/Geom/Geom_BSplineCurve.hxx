@@ -31,6 +31,8 @@
 #include <TColgp_Array1OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColStd_Array1OfInteger.hxx>
+#include <BSplCLib_SharedCache.hxx>
+
 class gp_Pnt;
 class gp_Vec;
 class gp_Trsf;
@@ -773,7 +775,24 @@ public:
   
   //! Creates a new object which is a copy of this BSpline curve.
   Standard_EXPORT Handle(Geom_Geometry) Copy() const Standard_OVERRIDE;
-  
+
+  //! Creates the cache of polynomial coefficients of spans of the curve
+  //! shared by its evaluators (e.g. GeomAdaptor_Curve) working in parallel threads.
+  //! Without this cache each evaluator rebuilds its own one in going from span to span,
+  //! so it is worth creating only when many evaluators of the same large curve are used.
+  //! Does nothing if the cache already exists.
+  //! Any modification of the curve releases the cache.
+  //! Should not be called concurrently with evaluation of the curve.
+  //! @param theMaxNbSpans [in] maximal number of spans kept in the cache
+  Standard_EXPORT void CreateSharedCache (const Standard_Integer theMaxNbSpans = 1024);
+
+  //! Releases the shared cache of spans, if any.
+  //! Should not be called concurrently with evaluation of the curve.
+  Standard_EXPORT void ReleaseSharedCache();
+
+  //! Returns the shared cache of spans or NULL if it has not been created.
+  const Handle(BSplCLib_SharedCache)& SharedCache() const { return mySharedCache; }
+
   //! Comapare two Bspline curve on identity;
   Standard_EXPORT Standard_Boolean IsEqual (const Handle(Geom_BSplineCurve)& theOther, const Standard_Real thePreci) const;
 
@@ -796,6 +815,9 @@ private:
   //! Recompute  the  flatknots,  the knotsdistribution, the continuity.
   Standard_EXPORT void UpdateKnots();
 
+  //! Discards the shared cache of spans on modification of the curve.
+  void invalidateSharedCache() { mySharedCache.Nullify(); }
+
   Standard_Boolean rational;
   Standard_Boolean periodic;
   GeomAbs_BSplKnotDistribution knotSet;
@@ -808,6 +830,7 @@ private:
   Handle(TColStd_HArray1OfInteger) mults;
   Standard_Real maxderivinv;
   Standard_Boolean maxderivinvok;
+  Handle(BSplCLib_SharedCache) mySharedCache;
 
 
 };
@@ -15,6 +15,7 @@
 // commercial license or contractual agreement.
 
 #include <BSplCLib.hxx>
+#include <BSplCLib_SharedCache.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_UndefinedDerivative.hxx>
 #include <gp.hxx>
@@ -674,6 +675,7 @@ Standard_Boolean Geom_BSplineCurve::IsRational () const
 void Geom_BSplineCurve::Transform
   (const gp_Trsf& T)
 {
+  invalidateSharedCache();
   TColgp_Array1OfPnt & CPoles = poles->ChangeArray1();
   for (Standard_Integer I = 1; I <= CPoles.Length(); I++)  
     CPoles (I).Transform (T);
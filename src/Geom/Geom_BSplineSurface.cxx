@@ -25,6 +25,7 @@
 
 #include <BSplCLib.hxx>
 #include <BSplSLib.hxx>
+#include <BSplSLib_SharedCache.hxx>
 #include <Geom_BSplineSurface.hxx>
 #include <Geom_Geometry.hxx>
 #include <Geom_UndefinedDerivative.hxx>
@@ -146,6 +147,31 @@ Handle(Geom_Geometry) Geom_BSplineSurface::Copy () const
   return S;
 }
 
+//=======================================================================
+//function : CreateSharedCache
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineSurface::CreateSharedCache (const Standard_Integer theMaxNbSpans)
+{
+  if (mySharedCache.IsNull())
+  {
+    mySharedCache = new BSplSLib_SharedCache (udeg, uperiodic, ufknots, vdeg, vperiodic, vfknots, poles,
+                                              (urational || vrational) ? weights : Handle(TColStd_HArray2OfReal)(),
+                                              theMaxNbSpans);
+  }
+}
+
+//=======================================================================
+//function : ReleaseSharedCache
+//purpose  : 
+//=======================================================================
+
+void Geom_BSplineSurface::ReleaseSharedCache()
+{
+  mySharedCache.Nullify();
+}
+
 //=======================================================================
 //function : Geom_BSplineSurface
 //purpose  : 
@@ -290,6 +316,7 @@ Geom_BSplineSurface::Geom_BSplineSurface
 
 void Geom_BSplineSurface::ExchangeUV ()
 {
+  invalidateSharedCache();
   Standard_Integer LC = poles->LowerCol();
   Standard_Integer UC = poles->UpperCol();
   Standard_Integer LR = poles->LowerRow();
@@ -339,6 +366,7 @@ void Geom_BSplineSurface::ExchangeUV ()
 void Geom_BSplineSurface::IncreaseDegree (const Standard_Integer UDegree,
 					  const Standard_Integer VDegree)
 { 
+  invalidateSharedCache();
   if (UDegree != udeg) {
     if ( UDegree < udeg || UDegree > Geom_BSplineSurface::MaxDegree())
       throw Standard_ConstructionError("Geom_BSplineSurface::IncreaseDegree: bad U degree value");
@@ -453,6 +481,7 @@ void Geom_BSplineSurface::IncreaseUMultiplicity
 (const Standard_Integer UIndex, 
  const Standard_Integer M)
 {
+  invalidateSharedCache();
   TColStd_Array1OfReal k(1,1);
   k(1) = uknots->Value(UIndex);
   TColStd_Array1OfInteger m(1,1);
@@ -470,6 +499,7 @@ void Geom_BSplineSurface::IncreaseUMultiplicity
  const Standard_Integer ToI2,
  const Standard_Integer M)
 {
+  invalidateSharedCache();
   Handle(TColStd_HArray1OfReal) tk = uknots;
   TColStd_Array1OfReal k((uknots->Array1())(FromI1),FromI1,ToI2);
   TColStd_Array1OfInteger m(FromI1, ToI2);
@@ -487,6 +517,7 @@ void Geom_BSplineSurface::IncreaseVMultiplicity
 (const Standard_Integer VIndex, 
  const Standard_Integer M)
 {
+  invalidateSharedCache();
   TColStd_Array1OfReal k(1,1);
   k(1) = vknots->Value(VIndex);
   TColStd_Array1OfInteger m(1,1);
@@ -504,6 +535,7 @@ void Geom_BSplineSurface::IncreaseVMultiplicity
  const Standard_Integer ToI2,
  const Standard_Integer M)
 {
+  invalidateSharedCache();
   Handle(TColStd_HArray1OfReal) tk = vknots;
   TColStd_Array1OfReal k((vknots->Array1())(FromI1),FromI1,ToI2);
   TColStd_Array1OfInteger m(FromI1,ToI2);
@@ -526,6 +558,7 @@ void Geom_BSplineSurface::segment(const Standard_Real U1,
                                   const Standard_Boolean SegmentInU,
                                   const Standard_Boolean SegmentInV)
 {
+  invalidateSharedCache();
   Standard_Real deltaU = U2 - U1;
   if (uperiodic) {
     Standard_Real aUPeriod = uknots->Last() - uknots->First();
@@ -751,6 +784,7 @@ void Geom_BSplineSurface::Segment(const Standard_Real U1,
                                   const Standard_Real theUTolerance,
                                   const Standard_Real theVTolerance)
 {
+  invalidateSharedCache();
   if ((U2 < U1) || (V2 < V1))
     throw Standard_DomainError("Geom_BSplineSurface::Segment");
 
@@ -775,6 +809,7 @@ void Geom_BSplineSurface::CheckAndSegment(const Standard_Real U1,
                                           const Standard_Real theUTolerance,
                                           const Standard_Real theVTolerance)
 {
+  invalidateSharedCache();
 
   if ((U2 < U1) || (V2 < V1))
     throw Standard_DomainError("Geom_BSplineSurface::CheckAndSegment");
@@ -804,6 +839,7 @@ void Geom_BSplineSurface::SetUKnot
 (const Standard_Integer UIndex,
  const Standard_Real    K      )
 {
+  invalidateSharedCache();
   if (UIndex < 1 || UIndex > uknots->Length())
     throw Standard_OutOfRange("Geom_BSplineSurface::SetUKnot: Index and #knots mismatch");
 
@@ -838,6 +874,7 @@ void Geom_BSplineSurface::SetUKnot
 //=======================================================================
 
 void Geom_BSplineSurface::SetUKnots (const TColStd_Array1OfReal& UK) {
+  invalidateSharedCache();
 
   Standard_Integer Lower = UK.Lower();
   Standard_Integer Upper = UK.Upper();
@@ -880,6 +917,7 @@ void Geom_BSplineSurface::SetUKnot
  const Standard_Real    K,
  const Standard_Integer M)
 {
+  invalidateSharedCache();
   IncreaseUMultiplicity (UIndex, M);
   SetUKnot (UIndex, K);
 }
@@ -893,6 +931,7 @@ void Geom_BSplineSurface::SetVKnot
 (const Standard_Integer VIndex,
  const Standard_Real    K)
 {
+  invalidateSharedCache();
   if (VIndex < 1 || VIndex > vknots->Length())
     throw Standard_OutOfRange("Geom_BSplineSurface::SetVKnot: Index and #knots mismatch");
   Standard_Integer NewIndex = VIndex + vknots->Lower() - 1;
@@ -927,6 +966,7 @@ void Geom_BSplineSurface::SetVKnot
 //=======================================================================
 
 void Geom_BSplineSurface::SetVKnots (const TColStd_Array1OfReal& VK) {
+  invalidateSharedCache();
 
   Standard_Integer Lower = VK.Lower();
   Standard_Integer Upper = VK.Upper();
@@ -969,6 +1009,7 @@ void Geom_BSplineSurface::SetVKnot
  const Standard_Real    K,
  const Standard_Integer M)
 {
+  invalidateSharedCache();
   IncreaseVMultiplicity (VIndex, M);
   SetVKnot (VIndex, K);
 }
@@ -984,6 +1025,7 @@ void Geom_BSplineSurface::InsertUKnot
  const Standard_Real    ParametricTolerance,
  const Standard_Boolean Add)
 {
+  invalidateSharedCache();
   TColStd_Array1OfReal k(1,1);
   k(1) = U;
   TColStd_Array1OfInteger m(1,1);
@@ -1002,6 +1044,7 @@ void Geom_BSplineSurface::InsertVKnot
  const Standard_Real    ParametricTolerance,
  const Standard_Boolean Add)
 {
+  invalidateSharedCache();
   TColStd_Array1OfReal k(1,1);
   k(1) = V;
   TColStd_Array1OfInteger m(1,1);
@@ -1019,6 +1062,7 @@ void  Geom_BSplineSurface::IncrementUMultiplicity
  const Standard_Integer ToI2,
  const Standard_Integer Step)
 {
+  invalidateSharedCache();
   Handle(TColStd_HArray1OfReal) tk = uknots;
   TColStd_Array1OfReal k( (uknots->Array1())(FromI1), FromI1, ToI2);
   TColStd_Array1OfInteger m( FromI1, ToI2) ;
@@ -1036,6 +1080,7 @@ void  Geom_BSplineSurface::IncrementVMultiplicity
  const Standard_Integer ToI2,
  const Standard_Integer Step)
 {
+  invalidateSharedCache();
   Handle(TColStd_HArray1OfReal) tk = vknots;
   TColStd_Array1OfReal k( (vknots->Array1())(FromI1), FromI1, ToI2);
 
@@ -1052,6 +1097,7 @@ void  Geom_BSplineSurface::IncrementVMultiplicity
 
 void Geom_BSplineSurface::UpdateUKnots()
 {
+  invalidateSharedCache();
 
   Standard_Integer MaxKnotMult = 0;
   BSplCLib::KnotAnalysis (udeg, uperiodic,
@@ -1091,6 +1137,7 @@ void Geom_BSplineSurface::UpdateUKnots()
 
 void Geom_BSplineSurface::UpdateVKnots()
 {
+  invalidateSharedCache();
   Standard_Integer MaxKnotMult = 0;
   BSplCLib::KnotAnalysis (vdeg, vperiodic,
 		vknots->Array1(), 
@@ -1183,6 +1230,7 @@ void Geom_BSplineSurface::SetWeight (const Standard_Integer UIndex,
 				     const Standard_Integer VIndex,
 				     const Standard_Real    Weight)
 {
+  invalidateSharedCache();
   if (Weight <= gp::Resolution())
     throw Standard_ConstructionError("Geom_BSplineSurface::SetWeight: Weight too small");
   TColStd_Array2OfReal & Weights = weights->ChangeArray2();
@@ -1203,6 +1251,7 @@ void Geom_BSplineSurface::SetWeightCol
 (const Standard_Integer       VIndex, 
  const TColStd_Array1OfReal&  CPoleWeights)
 {
+  invalidateSharedCache();
   TColStd_Array2OfReal & Weights = weights->ChangeArray2();   
   if (VIndex < 1 || VIndex > Weights.RowLength()) {
     throw Standard_OutOfRange("Geom_BSplineSurface::SetWeightCol: Index and #pole mismatch");
@@ -1235,6 +1284,7 @@ void Geom_BSplineSurface::SetWeightRow
 (const Standard_Integer       UIndex, 
  const TColStd_Array1OfReal&  CPoleWeights)
 {
+  invalidateSharedCache();
   TColStd_Array2OfReal & Weights = weights->ChangeArray2();   
   if (UIndex < 1 || UIndex > Weights.ColLength()) {
     throw Standard_OutOfRange("Geom_BSplineSurface::SetWeightRow: Index and #pole mismatch");
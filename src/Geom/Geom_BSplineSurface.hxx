@@ -34,6 +34,8 @@
 #include <TColStd_Array1OfInteger.hxx>
 #include <TColStd_Array2OfReal.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <BSplSLib_SharedCache.hxx>
+
 class gp_Pnt;
 class gp_Vec;
 class Geom_Curve;
@@ -1180,6 +1182,23 @@ public:
   //! Creates a new object which is a copy of this BSpline surface.
   Standard_EXPORT Handle(Geom_Geometry) Copy() const Standard_OVERRIDE;
 
+  //! Creates the cache of polynomial coefficients of spans of the surface
+  //! shared by its evaluators (e.g. GeomAdaptor_Surface) working in parallel threads.
+  //! Without this cache each evaluator rebuilds its own one in going from span to span,
+  //! so it is worth creating only when many evaluators of the same large surface are used.
+  //! Does nothing if the cache already exists.
+  //! Any modification of the surface releases the cache.
+  //! Should not be called concurrently with evaluation of the surface.
+  //! @param theMaxNbSpans [in] maximal number of spans kept in the cache
+  Standard_EXPORT void CreateSharedCache (const Standard_Integer theMaxNbSpans = 1024);
+
+  //! Releases the shared cache of spans, if any.
+  //! Should not be called concurrently with evaluation of the surface.
+  Standard_EXPORT void ReleaseSharedCache();
+
+  //! Returns the shared cache of spans or NULL if it has not been created.
+  const Handle(BSplSLib_SharedCache)& SharedCache() const { return mySharedCache; }
+
   //! Dumps the content of me into the stream
   Standard_EXPORT virtual void DumpJson (Standard_OStream& theOStream, Standard_Integer theDepth = -1) const Standard_OVERRIDE;
 
@@ -1213,6 +1232,9 @@ private:
   //! continuity for V.
   Standard_EXPORT void UpdateVKnots();
 
+  //! Discards the shared cache of spans on modification of the surface.
+  void invalidateSharedCache() { mySharedCache.Nullify(); }
+
   Standard_Boolean urational;
   Standard_Boolean vrational;
   Standard_Boolean uperiodic;
@@ -1234,6 +1256,7 @@ private:
   Standard_Real umaxderivinv;
   Standard_Real vmaxderivinv;
   Standard_Boolean maxderivinvok;
+  Handle(BSplSLib_SharedCache) mySharedCache;
 
 
 };
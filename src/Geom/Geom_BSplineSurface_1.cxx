@@ -25,6 +25,7 @@
 
 #include <BSplCLib.hxx>
 #include <BSplSLib.hxx>
+#include <BSplSLib_SharedCache.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_BSplineSurface.hxx>
 #include <Geom_Curve.hxx>
@@ -775,6 +776,7 @@ const TColStd_Array2OfReal* Geom_BSplineSurface::Weights() const
 
 void Geom_BSplineSurface::Transform (const gp_Trsf& T)
 {
+  invalidateSharedCache();
   TColgp_Array2OfPnt & VPoles = poles->ChangeArray2();
   for (Standard_Integer j = VPoles.LowerCol(); j <= VPoles.UpperCol(); j++) {
     for (Standard_Integer i = VPoles.LowerRow(); i <= VPoles.UpperRow(); i++) {
@@ -790,6 +792,7 @@ void Geom_BSplineSurface::Transform (const gp_Trsf& T)
 
 void Geom_BSplineSurface::SetUPeriodic ()
 {
+  invalidateSharedCache();
   Standard_Integer i,j;
 
   Standard_Integer first = FirstUKnotIndex();
@@ -856,6 +859,7 @@ void Geom_BSplineSurface::SetUPeriodic ()
 
 void Geom_BSplineSurface::SetVPeriodic ()
 {
+  invalidateSharedCache();
   Standard_Integer i,j;
 
   Standard_Integer first = FirstVKnotIndex();
@@ -915,6 +919,7 @@ void Geom_BSplineSurface::SetVPeriodic ()
 
 void Geom_BSplineSurface::SetUOrigin(const Standard_Integer Index)
 {
+  invalidateSharedCache();
   if (!uperiodic)
     throw Standard_NoSuchObject("Geom_BSplineSurface::SetUOrigin: surface is not U periodic");
 
@@ -1013,6 +1018,7 @@ void Geom_BSplineSurface::SetUOrigin(const Standard_Integer Index)
 
 void Geom_BSplineSurface::SetVOrigin(const Standard_Integer Index)
 {
+  invalidateSharedCache();
   if (!vperiodic)
     throw Standard_NoSuchObject("Geom_BSplineSurface::SetVOrigin: surface is not V periodic");
 
@@ -1111,6 +1117,7 @@ void Geom_BSplineSurface::SetVOrigin(const Standard_Integer Index)
 
 void Geom_BSplineSurface::SetUNotPeriodic () 
 { 
+  invalidateSharedCache();
   if ( uperiodic) {
     Standard_Integer NbKnots, NbPoles;
     BSplCLib::PrepareUnperiodize( udeg, umults->Array1(), NbKnots, NbPoles);
@@ -1163,6 +1170,7 @@ void Geom_BSplineSurface::SetUNotPeriodic ()
 
 void Geom_BSplineSurface::SetVNotPeriodic ()
 {
+  invalidateSharedCache();
   if ( vperiodic) {
     Standard_Integer NbKnots, NbPoles;
     BSplCLib::PrepareUnperiodize( vdeg, vmults->Array1(), NbKnots, NbPoles);
@@ -1429,6 +1437,7 @@ void Geom_BSplineSurface::LocateV
 
 void Geom_BSplineSurface::UReverse ()
 {
+  invalidateSharedCache();
   BSplCLib::Reverse(umults->ChangeArray1());
   BSplCLib::Reverse(uknots->ChangeArray1());
   Standard_Integer last;
@@ -1460,6 +1469,7 @@ Standard_Real Geom_BSplineSurface::UReversedParameter
 
 void Geom_BSplineSurface::VReverse ()
 {
+  invalidateSharedCache();
   BSplCLib::Reverse(vmults->ChangeArray1());
   BSplCLib::Reverse(vknots->ChangeArray1());
   Standard_Integer last;
@@ -1492,6 +1502,7 @@ Standard_Real Geom_BSplineSurface::VReversedParameter
 void Geom_BSplineSurface::SetPoleCol (const Standard_Integer      VIndex,
 				      const TColgp_Array1OfPnt&   CPoles)
 {
+  invalidateSharedCache();
   if (VIndex < 1 || VIndex > poles->RowLength())
   {
     throw Standard_OutOfRange("Geom_BSplineSurface::SetPoleCol: VIndex out of range");
@@ -1518,6 +1529,7 @@ void Geom_BSplineSurface::SetPoleCol (const Standard_Integer      VIndex,
 				      const TColgp_Array1OfPnt&   CPoles,
 				      const TColStd_Array1OfReal& CPoleWeights)
 {
+  invalidateSharedCache();
   SetPoleCol  (VIndex, CPoles);
   SetWeightCol(VIndex, CPoleWeights); 
 }
@@ -1530,6 +1542,7 @@ void Geom_BSplineSurface::SetPoleCol (const Standard_Integer      VIndex,
 void Geom_BSplineSurface::SetPoleRow (const Standard_Integer    UIndex,
 				      const TColgp_Array1OfPnt& CPoles)
 {
+  invalidateSharedCache();
   if (UIndex < 1 || UIndex > poles->ColLength())
   {
     throw Standard_OutOfRange("Geom_BSplineSurface::SetPoleRow: UIndex out of range");
@@ -1556,6 +1569,7 @@ void Geom_BSplineSurface::SetPoleRow(const Standard_Integer      UIndex,
 				     const TColgp_Array1OfPnt &  CPoles,
 				     const TColStd_Array1OfReal& CPoleWeights)
 {
+  invalidateSharedCache();
   SetPoleRow  (UIndex, CPoles);
   SetWeightRow(UIndex, CPoleWeights);  
 }
@@ -1569,6 +1583,7 @@ void Geom_BSplineSurface::SetPole (const Standard_Integer UIndex,
 				   const Standard_Integer VIndex,
 				   const gp_Pnt&          P)
 {
+  invalidateSharedCache();
   poles->SetValue (UIndex+poles->LowerRow()-1, VIndex+poles->LowerCol()-1, P);
 }
 
@@ -1582,6 +1597,7 @@ void Geom_BSplineSurface::SetPole (const Standard_Integer UIndex,
 				   const gp_Pnt&          P, 
 				   const Standard_Real    Weight)
 {
+  invalidateSharedCache();
   SetWeight(UIndex, VIndex, Weight);
   SetPole  (UIndex, VIndex, P);
 }
@@ -1603,6 +1619,7 @@ void Geom_BSplineSurface::MovePoint(const Standard_Real U,
 				    Standard_Integer& VFirstModifiedPole,
 				    Standard_Integer& VLastmodifiedPole)
 {
+  invalidateSharedCache();
   if (UIndex1 < 1 || UIndex1 > poles->UpperRow() || 
       UIndex2 < 1 || UIndex2 > poles->UpperRow() || UIndex1 > UIndex2 ||
       VIndex1 < 1 || VIndex1 > poles->UpperCol() || 
@@ -1776,6 +1793,7 @@ void  Geom_BSplineSurface::InsertUKnots
    const Standard_Real            ParametricTolerance,
    const Standard_Boolean         Add)
 {
+  invalidateSharedCache();
   // Check and compute new sizes
   Standard_Integer nbpoles, nbknots;
 
@@ -1843,6 +1861,7 @@ void  Geom_BSplineSurface::InsertVKnots
    const Standard_Real ParametricTolerance,
    const Standard_Boolean Add)
 {
+  invalidateSharedCache();
   // Check and compute new sizes
   Standard_Integer nbpoles, nbknots;
 
@@ -1909,6 +1928,7 @@ Standard_Boolean  Geom_BSplineSurface::RemoveUKnot
    const Standard_Integer M, 
    const Standard_Real Tolerance)
 {
+  invalidateSharedCache();
   if ( M < 0 ) return Standard_True;
   
   Standard_Integer I1 = FirstUKnotIndex ();
@@ -1992,6 +2012,7 @@ Standard_Boolean  Geom_BSplineSurface::RemoveVKnot
    const Standard_Integer M,
    const Standard_Real Tolerance)
 {
+  invalidateSharedCache();
   if ( M < 0 ) return Standard_True;
   
   Standard_Integer I1 = FirstVKnotIndex ();
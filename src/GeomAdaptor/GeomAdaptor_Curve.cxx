@@ -26,6 +26,7 @@
 #include <Adaptor3d_Curve.hxx>
 #include <BSplCLib.hxx>
 #include <BSplCLib_Cache.hxx>
+#include <BSplCLib_SharedCache.hxx>
 #include <Geom_BezierCurve.hxx>
 #include <Geom_BSplineCurve.hxx>
 #include <Geom_Circle.hxx>
@@ -46,6 +47,7 @@
 #include <gp_Pnt.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NotImplemented.hxx>
@@ -1165,12 +1167,22 @@ void GeomAdaptor_Curve::RebuildCache(const Standard_Real theParameter) const
 }
   else if (myTypeCurve == GeomAbs_BSplineCurve)
 {
-    // Create cache for B-spline
-    if (myCurveCache.IsNull())
-      myCurveCache = new BSplCLib_Cache(myBSplineCurve->Degree(), myBSplineCurve->IsPeriodic(),
-        myBSplineCurve->KnotSequence(), myBSplineCurve->Poles(), myBSplineCurve->Weights());
-    myCurveCache->BuildCache (theParameter, myBSplineCurve->KnotSequence(),
-                              myBSplineCurve->Poles(), myBSplineCurve->Weights());
+    const Handle(BSplCLib_SharedCache)& aSharedCache = myBSplineCurve->SharedCache();
+    if (!aSharedCache.IsNull())
+    {
+      // Take cache of the span shared by all adaptors of the B-spline
+      myCurveCache = aSharedCache->Cache (theParameter);
+    }
+    else
+    {
+      // Create cache for B-spline; the cache taken from the shared one
+      // (referenced by it as well) should not be rebuilt
+      if (myCurveCache.IsNull() || myCurveCache->GetRefCount() > 1)
+        myCurveCache = new BSplCLib_Cache(myBSplineCurve->Degree(), myBSplineCurve->IsPeriodic(),
+          myBSplineCurve->KnotSequence(), myBSplineCurve->Poles(), myBSplineCurve->Weights());
+      myCurveCache->BuildCache (theParameter, myBSplineCurve->KnotSequence(),
+                                myBSplineCurve->Poles(), myBSplineCurve->Weights());
+    }
 }
 }
 
@@ -1253,6 +1265,51 @@ void GeomAdaptor_Curve::D0(const Standard_Real U, gp_Pnt& P) const
 }
 }
 
+//=======================================================================
+//function : BatchD0
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Curve::BatchD0(const TColStd_Array1OfReal& theParams,
+                                TColgp_Array1OfPnt&         thePoints) const
+{
+  if (myTypeCurve != GeomAbs_BezierCurve &&
+      myTypeCurve != GeomAbs_BSplineCurve)
+  {
+    Adaptor3d_Curve::BatchD0(theParams, thePoints);
+    return;
+  }
+
+  Standard_DimensionMismatch_Raise_if (theParams.Lower() != thePoints.Lower() || theParams.Upper() != thePoints.Upper(),
+                                       "GeomAdaptor_Curve::BatchD0");
+  Standard_Integer aSpanStart = 0, aSpanFinish = 0;
+  for (Standard_Integer aStart = theParams.Lower(); aStart <= theParams.Upper();)
+  {
+    const Standard_Real aStartParam = theParams.Value(aStart);
+    if (IsBoundary(aStartParam, aSpanStart, aSpanFinish))
+    {
+      // points on the span boundaries are evaluated as in D0()
+      myBSplineCurve->LocalD0(aStartParam, aSpanStart, aSpanFinish, thePoints.ChangeValue(aStart));
+      ++aStart;
+      continue;
+    }
+
+    if (myCurveCache.IsNull() || !myCurveCache->IsCacheValid(aStartParam))
+      RebuildCache(aStartParam);
+
+    Standard_Integer anEnd = aStart + 1;
+    for (; anEnd <= theParams.Upper(); ++anEnd)
+    {
+      const Standard_Real aParam = theParams.Value(anEnd);
+      if (!myCurveCache->IsCacheValid(aParam) || IsBoundary(aParam, aSpanStart, aSpanFinish))
+        break;
+    }
+
+    myCurveCache->D0(theParams, aStart, anEnd - 1, thePoints);
+    aStart = anEnd;
+  }
+}
+
 //=======================================================================
 //function : D1
 //purpose  : 
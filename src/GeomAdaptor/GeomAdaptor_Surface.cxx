@@ -27,6 +27,7 @@
 #include <Adaptor3d_Surface.hxx>
 #include <BSplCLib.hxx>
 #include <BSplSLib_Cache.hxx>
+#include <BSplSLib_SharedCache.hxx>
 #include <Geom_BezierSurface.hxx>
 #include <Geom_Circle.hxx>
 #include <Geom_ConicalSurface.hxx>
@@ -54,6 +55,7 @@
 #include <gp_Torus.hxx>
 #include <gp_Vec.hxx>
 #include <Precision.hxx>
+#include <Standard_DimensionMismatch.hxx>
 #include <Standard_DomainError.hxx>
 #include <Standard_NoSuchObject.hxx>
 #include <Standard_NullObject.hxx>
@@ -701,14 +703,24 @@ void GeomAdaptor_Surface::RebuildCache(const Standard_Real theU,
   }
   else if (mySurfaceType == GeomAbs_BSplineSurface)
   {
-    // Create cache for B-spline
-    if (mySurfaceCache.IsNull())
-      mySurfaceCache = new BSplSLib_Cache(
-        myBSplineSurface->UDegree(), myBSplineSurface->IsUPeriodic(), myBSplineSurface->UKnotSequence(),
-        myBSplineSurface->VDegree(), myBSplineSurface->IsVPeriodic(), myBSplineSurface->VKnotSequence(),
-        myBSplineSurface->Weights());
-    mySurfaceCache->BuildCache (theU, theV, myBSplineSurface->UKnotSequence(), myBSplineSurface->VKnotSequence(),
-                                myBSplineSurface->Poles(), myBSplineSurface->Weights());
+    const Handle(BSplSLib_SharedCache)& aSharedCache = myBSplineSurface->SharedCache();
+    if (!aSharedCache.IsNull())
+    {
+      // Take cache of the span shared by all adaptors of the B-spline
+      mySurfaceCache = aSharedCache->Cache (theU, theV);
+    }
+    else
+    {
+      // Create cache for B-spline; the cache taken from the shared one
+      // (referenced by it as well) should not be rebuilt
+      if (mySurfaceCache.IsNull() || mySurfaceCache->GetRefCount() > 1)
+        mySurfaceCache = new BSplSLib_Cache(
+          myBSplineSurface->UDegree(), myBSplineSurface->IsUPeriodic(), myBSplineSurface->UKnotSequence(),
+          myBSplineSurface->VDegree(), myBSplineSurface->IsVPeriodic(), myBSplineSurface->VKnotSequence(),
+          myBSplineSurface->Weights());
+      mySurfaceCache->BuildCache (theU, theV, myBSplineSurface->UKnotSequence(), myBSplineSurface->VKnotSequence(),
+                                  myBSplineSurface->Poles(), myBSplineSurface->Weights());
+    }
   }
 }
 
@@ -755,6 +767,42 @@ void GeomAdaptor_Surface::D0(const Standard_Real U,
   }
 }
 
+//=======================================================================
+//function : BatchD0
+//purpose  : 
+//=======================================================================
+
+void GeomAdaptor_Surface::BatchD0(const TColgp_Array1OfPnt2d& theUV,
+                                  TColgp_Array1OfPnt&         thePoints) const
+{
+  if (mySurfaceType != GeomAbs_BezierSurface &&
+      mySurfaceType != GeomAbs_BSplineSurface)
+  {
+    Adaptor3d_Surface::BatchD0(theUV, thePoints);
+    return;
+  }
+
+  Standard_DimensionMismatch_Raise_if (theUV.Lower() != thePoints.Lower() || theUV.Upper() != thePoints.Upper(),
+                                       "GeomAdaptor_Surface::BatchD0");
+  for (Standard_Integer aStart = theUV.Lower(); aStart <= theUV.Upper();)
+  {
+    const gp_Pnt2d& aStartUV = theUV.Value(aStart);
+    if (mySurfaceCache.IsNull() || !mySurfaceCache->IsCacheValid(aStartUV.X(), aStartUV.Y()))
+      RebuildCache(aStartUV.X(), aStartUV.Y());
+
+    Standard_Integer anEnd = aStart + 1;
+    for (; anEnd <= theUV.Upper(); ++anEnd)
+    {
+      const gp_Pnt2d& aUV = theUV.Value(anEnd);
+      if (!mySurfaceCache->IsCacheValid(aUV.X(), aUV.Y()))
+        break;
+    }
+
+    mySurfaceCache->D0(theUV, aStart, anEnd - 1, thePoints);
+    aStart = anEnd;
+  }
+}
+
 
 //=======================================================================
 //function : D1
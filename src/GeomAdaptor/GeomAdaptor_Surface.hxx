@@ -145,6 +145,11 @@ public:
   
   //! Computes the point of parameters U,V on the surface.
   Standard_EXPORT void D0 (const Standard_Real U, const Standard_Real V, gp_Pnt& P) const Standard_OVERRIDE;
+
+  //! Computes the points of the surface for the array of parameters.
+  //! For Bezier and B-spline surfaces, the consecutive points lying
+  //! in the same span are evaluated at once using the span cache.
+  Standard_EXPORT void BatchD0 (const TColgp_Array1OfPnt2d& theUV, TColgp_Array1OfPnt& thePoints) const Standard_OVERRIDE;
   
   //! Computes the point  and the first derivatives on
   //! the surface.
@@ -21,6 +21,7 @@
 #include <GeometryTest.hxx>
 #include <GeomAPI_ProjectPointOnCurve.hxx>
 #include <GeomAPI_ProjectPointOnSurf.hxx>
+#include <Extrema_GenExtPS.hxx>
 #include <Extrema_GenLocateExtPS.hxx>
 #include <GeomAPI_ExtremaCurveCurve.hxx>
 #include <GeomAPI_ExtremaCurveSurface.hxx>
@@ -34,6 +35,7 @@
 #include <Draw_MarkerShape.hxx>
 #include <Message.hxx>
 #include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 #include <TColgp_Array2OfPnt.hxx>
 #include <TColStd_Array2OfReal.hxx>
 #include <Precision.hxx>
@@ -168,6 +170,126 @@ static Standard_Integer proj (Draw_Interpretor& di, Standard_Integer n, const ch
   return 0;
 }
 
+//=======================================================================
+//function : projpoints
+//purpose  : compares batch projection of points on surface with point-wise one
+//=======================================================================
+
+static Standard_Integer projpoints (Draw_Interpretor& theDI, Standard_Integer theArgc, const char** theArgv)
+{
+  if (theArgc < 3)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  Handle(Geom_Surface) aSurf = DrawTrSurf::GetSurface (theArgv[1]);
+  const Standard_Integer aNbPnts = Draw::Atoi (theArgv[2]);
+  if (aSurf.IsNull() || aNbPnts < 1)
+  {
+    theDI << "Syntax error: surface and number of points are expected";
+    return 1;
+  }
+
+  Extrema_ExtAlgo anAlgo = Extrema_ExtAlgo_Grad;
+  Standard_Boolean isParallel = Standard_False;
+  for (Standard_Integer anArgIter = 3; anArgIter < theArgc; ++anArgIter)
+  {
+    TCollection_AsciiString anArg (theArgv[anArgIter]);
+    anArg.LowerCase();
+    if (anArg == "-tree")
+    {
+      anAlgo = Extrema_ExtAlgo_Tree;
+    }
+    else if (anArg == "-parallel")
+    {
+      isParallel = Standard_True;
+    }
+    else
+    {
+      theDI << "Syntax error: unknown argument '" << theArgv[anArgIter] << "'";
+      return 1;
+    }
+  }
+
+  Standard_Real aU1, aU2, aV1, aV2;
+  aSurf->Bounds (aU1, aU2, aV1, aV2);
+  if (Precision::IsInfinite (aU1) || Precision::IsInfinite (aU2)
+   || Precision::IsInfinite (aV1) || Precision::IsInfinite (aV2))
+  {
+    theDI << "Error: surface " << theArgv[1] << " is not bounded";
+    return 1;
+  }
+
+  // points scattered around the surface (quasi-random sequence of parameters and offsets)
+  TColgp_Array1OfPnt aPoints (1, aNbPnts);
+  for (Standard_Integer aPntIter = 1; aPntIter <= aNbPnts; ++aPntIter)
+  {
+    const Standard_Real aU = aU1 + (aU2 - aU1) * (aPntIter * 0.6180339887 - Floor (aPntIter * 0.6180339887));
+    const Standard_Real aV = aV1 + (aV2 - aV1) * (aPntIter * 0.7548776662 - Floor (aPntIter * 0.7548776662));
+    const gp_XYZ anOffset (Sin (aPntIter * 1.3), Cos (aPntIter * 2.1), Sin (aPntIter * 0.7 + 1.0));
+    aPoints.SetValue (aPntIter, aSurf->Value (aU, aV).XYZ() + anOffset);
+  }
+
+  const Standard_Integer aNbSamples = 20;
+  GeomAdaptor_Surface anAdaptor (aSurf);
+  Extrema_GenExtPS anExtPS;
+  anExtPS.SetFlag (Extrema_ExtFlag_MIN);
+  anExtPS.SetAlgo (anAlgo);
+  anExtPS.Initialize (anAdaptor, aNbSamples, aNbSamples, Precision::PConfusion(), Precision::PConfusion());
+
+  TColStd_Array1OfReal aSqDists (1, aNbPnts);
+  TColgp_Array1OfPnt2d aUVs (1, aNbPnts);
+  anExtPS.Perform (aPoints, aSqDists, aUVs, isParallel);
+
+  // point-wise projection by a separate object
+  Extrema_GenExtPS aRefExtPS;
+  aRefExtPS.SetFlag (Extrema_ExtFlag_MIN);
+  aRefExtPS.SetAlgo (anAlgo);
+  aRefExtPS.Initialize (anAdaptor, aNbSamples, aNbSamples, Precision::PConfusion(), Precision::PConfusion());
+
+  Standard_Integer aNbFailed = 0, aNbMismatches = 0;
+  Standard_Real aMaxDiff = 0.0;
+  for (Standard_Integer aPntIter = 1; aPntIter <= aNbPnts; ++aPntIter)
+  {
+    aRefExtPS.Perform (aPoints.Value (aPntIter));
+    Standard_Real aRefSqDist = -1.0;
+    if (aRefExtPS.IsDone())
+    {
+      for (Standard_Integer anExtIter = 1; anExtIter <= aRefExtPS.NbExt(); ++anExtIter)
+      {
+        const Standard_Real aSqDist = aRefExtPS.SquareDistance (anExtIter);
+        if (aRefSqDist < 0.0 || aSqDist < aRefSqDist)
+        {
+          aRefSqDist = aSqDist;
+        }
+      }
+    }
+
+    const Standard_Real aSqDist = aSqDists.Value (aPntIter);
+    if (aSqDist < 0.0)
+    {
+      ++aNbFailed;
+    }
+    if ((aSqDist < 0.0) != (aRefSqDist < 0.0))
+    {
+      ++aNbMismatches;
+    }
+    else if (aSqDist >= 0.0)
+    {
+      const gp_Pnt2d& aUV = aUVs.Value (aPntIter);
+      aMaxDiff = Max (aMaxDiff, Abs (Sqrt (aSqDist) - Sqrt (aRefSqDist)));
+      aMaxDiff = Max (aMaxDiff, Abs (aSurf->Value (aUV.X(), aUV.Y()).Distance (aPoints.Value (aPntIter)) - Sqrt (aSqDist)));
+    }
+  }
+
+  theDI << "Number of points: " << aNbPnts << "\n";
+  theDI << "Number of not projected points: " << aNbFailed << "\n";
+  theDI << "Number of mismatches with point-wise projection: " << aNbMismatches << "\n";
+  theDI << "Max difference of distances: " << aMaxDiff << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : appro
 //purpose  : 
@@ -754,6 +876,10 @@ void GeometryTest::APICommands(Draw_Interpretor& theCommands)
                   "\t\tOptional parameters are relevant to surf only.\n"
                   "\t\tIf initial {u v} are given then local extrema is called",__FILE__, proj);
 
+  theCommands.Add("projpoints", "projpoints surf nbpoints [-tree] [-parallel]\n"
+                  "\t\tProjects the set of points scattered around the surface in a single batch\n"
+                  "\t\tand compares the results with projection of each point",__FILE__, projpoints);
+
   theCommands.Add("appro", "appro result nbpoint [curve]",__FILE__, appro);
   theCommands.Add("surfapp","surfapp result nbupoint nbvpoint x y z ....",
 		  __FILE__,
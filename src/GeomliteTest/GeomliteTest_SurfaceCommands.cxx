@@ -41,6 +41,7 @@
 #include <Geom2d_OffsetCurve.hxx>
 
 #include <TColgp_Array1OfPnt.hxx>
+#include <TColgp_Array1OfPnt2d.hxx>
 #include <TColgp_Array2OfPnt.hxx>
 #include <TColStd_Array1OfReal.hxx>
 #include <TColStd_Array2OfReal.hxx>
@@ -68,6 +69,8 @@
 #include <GeomConvert_ApproxSurface.hxx>
 #include <GeomLib_Tool.hxx>
 #include <Geom_Curve.hxx>
+#include <GeomAdaptor_Curve.hxx>
+#include <GeomAdaptor_Surface.hxx>
 #include <Message.hxx>
 
 #include <stdio.h>
@@ -1064,6 +1067,107 @@ static Standard_Integer derivative(Draw_Interpretor&,
   return 0;
 }
 
+//=======================================================================
+//function : batchvalue
+//purpose  : compares batch evaluation of points with point-wise one
+//=======================================================================
+
+static Standard_Integer batchvalue (Draw_Interpretor& theDI,
+                                    Standard_Integer theArgc,
+                                    const char** theArgv)
+{
+  if (theArgc != 3 && theArgc != 4)
+  {
+    theDI << "Syntax error: wrong number of arguments";
+    return 1;
+  }
+
+  const Standard_Integer aNbU = Draw::Atoi (theArgv[2]);
+  const Standard_Integer aNbV = theArgc > 3 ? Draw::Atoi (theArgv[3]) : 1;
+  if (aNbU < 2 || aNbV < 1)
+  {
+    theDI << "Syntax error: wrong number of samples";
+    return 1;
+  }
+
+  Standard_Real aMaxDev = 0.0;
+  Standard_Integer aNbPnts = 0;
+  if (theArgc == 4)
+  {
+    Handle(Geom_Surface) aSurf = DrawTrSurf::GetSurface (theArgv[1]);
+    if (aSurf.IsNull() || aNbV < 2)
+    {
+      theDI << "Syntax error: surface and two numbers of samples are expected";
+      return 1;
+    }
+
+    Standard_Real aU1, aU2, aV1, aV2;
+    aSurf->Bounds (aU1, aU2, aV1, aV2);
+    if (Precision::IsInfinite (aU1) || Precision::IsInfinite (aU2)
+     || Precision::IsInfinite (aV1) || Precision::IsInfinite (aV2))
+    {
+      theDI << "Error: surface " << theArgv[1] << " is not bounded";
+      return 1;
+    }
+
+    // the rows are traversed in alternating directions to check runs of points going backward
+    TColgp_Array1OfPnt2d aParams (1, aNbU * aNbV);
+    for (Standard_Integer aVIter = 0; aVIter < aNbV; ++aVIter)
+    {
+      const Standard_Real aV = aV1 + (aV2 - aV1) * aVIter / (aNbV - 1);
+      for (Standard_Integer aUIter = 0; aUIter < aNbU; ++aUIter)
+      {
+        const Standard_Integer anIndex = (aVIter % 2 == 0) ? aUIter : aNbU - 1 - aUIter;
+        aParams.SetValue (++aNbPnts, gp_Pnt2d (aU1 + (aU2 - aU1) * anIndex / (aNbU - 1), aV));
+      }
+    }
+
+    GeomAdaptor_Surface anAdaptor (aSurf);
+    TColgp_Array1OfPnt aPoints (1, aNbPnts);
+    anAdaptor.BatchD0 (aParams, aPoints);
+    for (Standard_Integer aPntIter = 1; aPntIter <= aNbPnts; ++aPntIter)
+    {
+      const gp_Pnt2d& aUV = aParams.Value (aPntIter);
+      aMaxDev = Max (aMaxDev, anAdaptor.Value (aUV.X(), aUV.Y()).Distance (aPoints.Value (aPntIter)));
+    }
+  }
+  else
+  {
+    Handle(Geom_Curve) aCurve = DrawTrSurf::GetCurve (theArgv[1]);
+    if (aCurve.IsNull())
+    {
+      theDI << "Syntax error: curve is expected";
+      return 1;
+    }
+
+    const Standard_Real aT1 = aCurve->FirstParameter();
+    const Standard_Real aT2 = aCurve->LastParameter();
+    if (Precision::IsInfinite (aT1) || Precision::IsInfinite (aT2))
+    {
+      theDI << "Error: curve " << theArgv[1] << " is not bounded";
+      return 1;
+    }
+
+    TColStd_Array1OfReal aParams (1, aNbU);
+    for (aNbPnts = 0; aNbPnts < aNbU; ++aNbPnts)
+    {
+      aParams.SetValue (aNbPnts + 1, aT1 + (aT2 - aT1) * aNbPnts / (aNbU - 1));
+    }
+
+    GeomAdaptor_Curve anAdaptor (aCurve);
+    TColgp_Array1OfPnt aPoints (1, aNbPnts);
+    anAdaptor.BatchD0 (aParams, aPoints);
+    for (Standard_Integer aPntIter = 1; aPntIter <= aNbPnts; ++aPntIter)
+    {
+      aMaxDev = Max (aMaxDev, anAdaptor.Value (aParams.Value (aPntIter)).Distance (aPoints.Value (aPntIter)));
+    }
+  }
+
+  theDI << "Number of points: " << aNbPnts << "\n";
+  theDI << "Max deviation from point-wise evaluation: " << aMaxDev << "\n";
+  return 0;
+}
+
 //=======================================================================
 //function : movepole
 //purpose  : 
@@ -1988,6 +2092,14 @@ void  GeomliteTest::SurfaceCommands(Draw_Interpretor& theCommands)
     __FILE__,
     derivative, g);
 
+  theCommands.Add("batchvalue",
+    "batchvalue curvename NbSamples\n"
+    "batchvalue surfname NbSamplesU NbSamplesV\n"
+    "    Evaluates points on a regular grid of parameters in a single batch\n"
+    "    and reports the maximal deviation from the point-wise evaluation",
+    __FILE__,
+    batchvalue, g);
+
   theCommands.Add("parameters",
 		  "parameters surf/curve X Y [Z] Tol U [V] : {X Y Z} point, {U V} output parameter(s)",
 		  __FILE__,
@@ -1258,7 +1258,7 @@ Standard_Boolean IGESData_ParamReader::ReadingReal (const Standard_Integer num,
     if (orig[i] == '\0') break;
   }
   if (FP.ParamType() == Interface_ParamReal) 
-    val = Atof(text);
+    val = Interface_FileReaderData::Fastof(text);
   else if (FP.ParamType() == Interface_ParamEnum) {  // convention
     if (!pbrealform) {
       if (testconv < 0) testconv = 0; //Interface_Static::IVal("iges.convert.read");
@@ -1274,7 +1274,7 @@ Standard_Boolean IGESData_ParamReader::ReadingReal (const Standard_Integer num,
     // mais avec exposant (sinon ce serait un entier)
     // -> un message avertissement + on ajoute le point puis on convertit
     
-    val = Atof(text);
+    val = Interface_FileReaderData::Fastof(text);
   } else if (FP.ParamType() == Interface_ParamVoid) {
     val = 0.0;    // DEFAULT
   } else {
@@ -1326,7 +1326,7 @@ Standard_Boolean IGESData_ParamReader::ReadingReal
     if (orig[i] == '\0') break;
   }
   if (FP.ParamType() == Interface_ParamReal) 
-    val = Atof(text);
+    val = Interface_FileReaderData::Fastof(text);
   else if (FP.ParamType() == Interface_ParamEnum) {  // convention
     if (!pbrealform) {
       if (testconv < 0) testconv = 0; //Interface_Static::IVal("iges.convert.read");
@@ -1342,7 +1342,7 @@ Standard_Boolean IGESData_ParamReader::ReadingReal
     // mais avec exposant (sinon ce serait un entier)
     // -> un message avertissement + on ajoute le point puis on convertit
     
-    val = Atof(text);
+    val = Interface_FileReaderData::Fastof(text);
   } else if (FP.ParamType() == Interface_ParamVoid) {
     val = 0.0;    // DEFAULT
   } else {
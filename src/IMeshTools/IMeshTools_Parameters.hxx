@@ -32,6 +32,8 @@ struct IMeshTools_Parameters {
     DeflectionInterior(-1.0),
     MinSize (-1.0),
     InParallel (Standard_False),
+    InParallelFace (Standard_False),
+    SharedSplineCache (Standard_False),
     Relative (Standard_False),
     InternalVerticesMode (Standard_True),
     ControlSurfaceDeflection (Standard_True),
@@ -71,6 +73,20 @@ struct IMeshTools_Parameters {
   //! Switches on/off multi-thread computation
   Standard_Boolean                                 InParallel;
 
+  //! Switches on/off multi-thread computation within a single face.
+  //! The surface evaluations performed to control the deflection of the
+  //! triangulation of large faces are distributed between threads.
+  //! Useful for the shapes consisting of a few huge faces. Disabled by default.
+  Standard_Boolean                                 InParallelFace;
+
+  //! Switches on/off sharing of the caches of spans of B-spline surfaces and curves
+  //! between all their evaluators for the time of meshing (see
+  //! Geom_BSplineSurface::CreateSharedCache()), so that threads and adaptor copies
+  //! do not rebuild the cache in going from span to span. Useful for faces on
+  //! B-spline surfaces with many spans, especially with InParallelFace.
+  //! Disabled by default.
+  Standard_Boolean                                 SharedSplineCache;
+
   //! Switches on/off relative computation of edge tolerance<br>
   //! If true, deflection used for the polygonalisation of each edge will be 
   //! <defle> * Size of Edge. The deflection used for the faces will be the 
@@ -97,87 +97,75 @@ IntTools_Context::IntTools_Context
 //=======================================================================
 IntTools_Context::~IntTools_Context()
 {
-  for (NCollection_DataMap<TopoDS_Shape, IntTools_FClass2d*, TopTools_ShapeMapHasher>::Iterator anIt (myFClass2dMap);
-       anIt.More(); anIt.Next())
-  {
-    IntTools_FClass2d* pFClass2d = anIt.Value();;
-    (*pFClass2d).~IntTools_FClass2d();
-    myAllocator->Free (pFClass2d);
-  }
-  myFClass2dMap.Clear();
-
-  clearCachedPOnSProjectors();
-  for (NCollection_DataMap<TopoDS_Shape, GeomAPI_ProjectPointOnCurve*, TopTools_ShapeMapHasher>::Iterator anIt (myProjPCMap);
-       anIt.More(); anIt.Next())
-  {
-    GeomAPI_ProjectPointOnCurve* pProjPC = anIt.Value();
-    (*pProjPC).~GeomAPI_ProjectPointOnCurve();
-    myAllocator->Free (pProjPC);
-  }
-  myProjPCMap.Clear();
-
-  for (NCollection_DataMap<TopoDS_Shape, BRepClass3d_SolidClassifier*, TopTools_ShapeMapHasher>::Iterator anIt (mySClassMap);
-       anIt.More(); anIt.Next())
-  {
-    BRepClass3d_SolidClassifier* pSC = anIt.Value();
-    (*pSC).~BRepClass3d_SolidClassifier();
-    myAllocator->Free (pSC);
-  }
-  mySClassMap.Clear();
-
-  for (NCollection_DataMap<Handle(Geom_Curve), GeomAPI_ProjectPointOnCurve*, TColStd_MapTransientHasher>::Iterator anIt (myProjPTMap);
-       anIt.More(); anIt.Next())
-  {
-    GeomAPI_ProjectPointOnCurve* pProjPT = anIt.Value();
-    (*pProjPT).~GeomAPI_ProjectPointOnCurve();
-    myAllocator->Free (pProjPT);
-  }
-  myProjPTMap.Clear();
-
-  for (NCollection_DataMap<TopoDS_Shape, Geom2dHatch_Hatcher*, TopTools_ShapeMapHasher>::Iterator anIt (myHatcherMap);
-       anIt.More(); anIt.Next())
-  {
-    Geom2dHatch_Hatcher* pHatcher = anIt.Value();
-    (*pHatcher).~Geom2dHatch_Hatcher();
-    myAllocator->Free (pHatcher);
-  }
-  myHatcherMap.Clear();
+  Clear();
+}
 
-  for (NCollection_DataMap<TopoDS_Shape, IntTools_SurfaceRangeLocalizeData*, TopTools_ShapeMapHasher>::Iterator anIt (myProjSDataMap);
-       anIt.More(); anIt.Next())
+namespace
+{
+  //! Destroys the objects cached in the map and clears the map
+  template <class TheKey, class TheData, class TheHasher>
+  void clearMap (NCollection_DataMap<TheKey, TheData*, TheHasher>& theMap,
+                 const Handle(NCollection_BaseAllocator)& theAllocator)
   {
-    IntTools_SurfaceRangeLocalizeData* pSData = anIt.Value();
-    (*pSData).~IntTools_SurfaceRangeLocalizeData();
-    myAllocator->Free (pSData);
+    for (typename NCollection_DataMap<TheKey, TheData*, TheHasher>::Iterator anIt (theMap);
+         anIt.More(); anIt.Next())
+    {
+      TheData* pData = anIt.Value();
+      pData->~TheData();
+      theAllocator->Free (pData);
+    }
+    theMap.Clear();
   }
-  myProjSDataMap.Clear();
 
-  for (NCollection_DataMap<TopoDS_Shape, Bnd_Box*, TopTools_ShapeMapHasher>::Iterator anIt (myBndBoxDataMap);
-       anIt.More(); anIt.Next())
+  //! Destroys the object cached in the map for the shape
+  template <class TheData>
+  void removeFromMap (NCollection_DataMap<TopoDS_Shape, TheData*, TopTools_ShapeMapHasher>& theMap,
+                      const TopoDS_Shape& theShape,
+                      const Handle(NCollection_BaseAllocator)& theAllocator)
   {
-    Bnd_Box* pBox = anIt.Value();
-    (*pBox).~Bnd_Box();
-    myAllocator->Free (pBox);
+    TheData* pData = NULL;
+    if (theMap.Find (theShape, pData))
+    {
+      pData->~TheData();
+      theAllocator->Free (pData);
+      theMap.UnBind (theShape);
+    }
   }
-  myBndBoxDataMap.Clear();
+}
 
-  for (NCollection_DataMap<TopoDS_Shape, BRepAdaptor_Surface*, TopTools_ShapeMapHasher>::Iterator anIt (mySurfAdaptorMap);
-       anIt.More(); anIt.Next())
-  {
-    BRepAdaptor_Surface* pSurfAdaptor = anIt.Value();
-    (*pSurfAdaptor).~BRepAdaptor_Surface();
-    myAllocator->Free (pSurfAdaptor);
-  }
-  mySurfAdaptorMap.Clear();
+//=======================================================================
+//function : Clear
+//purpose  : 
+//=======================================================================
+void IntTools_Context::Clear()
+{
+  clearMap (myFClass2dMap, myAllocator);
+  clearCachedPOnSProjectors();
+  clearMap (myProjPCMap, myAllocator);
+  clearMap (mySClassMap, myAllocator);
+  clearMap (myProjPTMap, myAllocator);
+  clearMap (myHatcherMap, myAllocator);
+  clearMap (myProjSDataMap, myAllocator);
+  clearMap (myBndBoxDataMap, myAllocator);
+  clearMap (mySurfAdaptorMap, myAllocator);
+  clearMap (myOBBMap, myAllocator);
+}
 
-  for (NCollection_DataMap<TopoDS_Shape, Bnd_OBB*, TopTools_ShapeMapHasher>::Iterator anIt (myOBBMap);
-       anIt.More(); anIt.Next())
-  {
-    Bnd_OBB* pOBB = anIt.Value();
-    (*pOBB).~Bnd_OBB();
-    myAllocator->Free (pOBB);
-  }
-  myOBBMap.Clear();
+//=======================================================================
+//function : Remove
+//purpose  : 
+//=======================================================================
+void IntTools_Context::Remove (const TopoDS_Shape& theShape)
+{
+  removeFromMap (myFClass2dMap, theShape, myAllocator);
+  removeFromMap (myProjPSMap, theShape, myAllocator);
+  removeFromMap (myProjPCMap, theShape, myAllocator);
+  removeFromMap (mySClassMap, theShape, myAllocator);
+  removeFromMap (myHatcherMap, theShape, myAllocator);
+  removeFromMap (myProjSDataMap, theShape, myAllocator);
+  removeFromMap (myBndBoxDataMap, theShape, myAllocator);
+  removeFromMap (mySurfAdaptorMap, theShape, myAllocator);
+  removeFromMap (myOBBMap, theShape, myAllocator);
 }
 
 //=======================================================================
@@ -48,6 +48,12 @@ class Bnd_OBB;
 //! and topological toolkit (classifiers, projectors, etc).
 //! The intersection Context is for caching the tools
 //! to increase the performance.
+//!
+//! The cached data is bound to the shapes, which are kept alive by the
+//! context, and is valid only while these shapes are not modified.
+//! The context is not bounded in size: when it is shared between several
+//! operations, it should be cleared (or released) when the shapes it has
+//! been used for are no longer needed.
 class IntTools_Context : public Standard_Transient
 {
 public:
@@ -57,6 +63,14 @@ public:
 Standard_EXPORT virtual  ~IntTools_Context();
   
   Standard_EXPORT IntTools_Context(const Handle(NCollection_BaseAllocator)& theAllocator);
+
+  //! Removes all cached data
+  Standard_EXPORT void Clear();
+
+  //! Removes the data cached for the given shape.
+  //! It has to be called for the shape modified in place (e.g. whose tolerance
+  //! has been increased) as well as for all shapes containing it.
+  Standard_EXPORT void Remove (const TopoDS_Shape& theShape);
   
 
   //! Returns a reference to point classifier
@@ -31,12 +31,8 @@ IMPLEMENT_STANDARD_RTTIEXT(Interface_FileReaderData,Standard_Transient)
 //  Chaque norme peut s en servir comme base (listes de parametres litteraux,
 //  entites associees) et y ajoute ses donnees propres.
 //  Travaille sous le controle de FileReaderTool
-//  Optimisation : Champs pas possibles, car Param est const. Dommage
-//  Donc, on suppose qu on lit un fichier a la fois (hypothese raisonnable)
-//  On note en champ un numero de fichier, par rapport auquel on optimise
-static Standard_Integer thefic = 0;
-static Standard_Integer thenm0 = -1;
-static Standard_Integer thenp0 = -1;
+//  Param and ChangeParam keep no cache of the last record: the parameters
+//  may be read by several threads at once (see Interface_FileReaderTool)
 
 
 Interface_FileReaderData::Interface_FileReaderData (const Standard_Integer nbr,
@@ -45,8 +41,6 @@ Interface_FileReaderData::Interface_FileReaderData (const Standard_Integer nbr,
 {
   theparams = new Interface_ParamSet (npar);
   thenumpar.Init(0);
-  thenm0 = -1;
-  thenum0 = ++thefic;
 }
 
     Standard_Integer Interface_FileReaderData::NbRecords () const
@@ -117,17 +111,13 @@ Interface_FileReaderData::Interface_FileReaderData (const Standard_Integer nbr,
     const Interface_FileParameter& Interface_FileReaderData::Param
   (const Standard_Integer num, const Standard_Integer nump) const
 {
-  if (thefic != thenum0) return theparams->Param(thenumpar(num-1)+nump);
-  if (thenm0 != num) {  thenp0 = thenumpar(num-1);  thenm0 = num;  }
-  return theparams->Param (thenp0+nump);
+  return theparams->Param (thenumpar(num-1)+nump);
 }
 
     Interface_FileParameter& Interface_FileReaderData::ChangeParam
   (const Standard_Integer num, const Standard_Integer nump)
 {
-  if (thefic != thenum0) return theparams->ChangeParam(thenumpar(num-1)+nump);
-  if (thenm0 != num) {  thenp0 = thenumpar(num-1);  thenm0 = num;  }
-  return theparams->ChangeParam (thenp0+nump);
+  return theparams->ChangeParam (thenumpar(num-1)+nump);
 }
 
     Interface_ParamType Interface_FileReaderData::ParamType
@@ -239,7 +229,90 @@ void Interface_FileReaderData::Destroy ()
 {
 }
 
+namespace
+{
+  //! Exact powers of ten representable by a double
+  static const double THE_POW10[] =
+  {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+
+  //! Converts a decimal number without going through Strtod() when the result
+  //! can be obtained by a single exact operation (Clinger's fast path):
+  //! the digits fit into the 53 bits of a double and the power of ten is exact,
+  //! so that the product (or quotient) is correctly rounded as Strtod() would give.
+  //! Returns False if the text is not in this simple form.
+  static Standard_Boolean fastDecimal (const char* theText, Standard_Real& theValue)
+  {
+    const char* aPtr = theText;
+    const Standard_Boolean isNegative = (*aPtr == '-');
+    if (*aPtr == '-' || *aPtr == '+')
+      ++aPtr;
+
+    unsigned long long aMantissa = 0;
+    int aNbDigits = 0, anExp = 0;
+    const char* aDigits = aPtr;
+    for (; *aPtr >= '0' && *aPtr <= '9'; ++aPtr)
+    {
+      if (aMantissa != 0 || *aPtr != '0')
+      {
+        if (++aNbDigits > 19) return Standard_False;
+        aMantissa = aMantissa * 10 + (*aPtr - '0');
+      }
+    }
+    if (*aPtr == '.')
+    {
+      for (++aPtr; *aPtr >= '0' && *aPtr <= '9'; ++aPtr)
+      {
+        --anExp;
+        if (aMantissa != 0 || *aPtr != '0')
+        {
+          if (++aNbDigits > 19) return Standard_False;
+          aMantissa = aMantissa * 10 + (*aPtr - '0');
+        }
+      }
+    }
+    if (aPtr == aDigits || (aPtr == aDigits + 1 && *aDigits == '.'))
+      return Standard_False;
+
+    if (*aPtr == 'E' || *aPtr == 'e')
+    {
+      ++aPtr;
+      const Standard_Boolean isNegExp = (*aPtr == '-');
+      if (*aPtr == '-' || *aPtr == '+')
+        ++aPtr;
+      if (*aPtr < '0' || *aPtr > '9')
+        return Standard_False;
+      int anExpValue = 0;
+      for (; *aPtr >= '0' && *aPtr <= '9'; ++aPtr)
+      {
+        if (anExpValue > 1000) return Standard_False;
+        anExpValue = anExpValue * 10 + (*aPtr - '0');
+      }
+      anExp += isNegExp ? -anExpValue : anExpValue;
+    }
+    if (*aPtr != '\0')
+      return Standard_False;
+
+    if (aMantissa == 0)
+      anExp = 0;
+    for (; aMantissa != 0 && aMantissa % 10 == 0; aMantissa /= 10)
+      ++anExp;
+    if (aMantissa > (1ULL << 53) || anExp < -22 || anExp > 22)
+      return Standard_False;
+
+    const double aValue = (double )aMantissa;
+    const double aResult = anExp < 0 ? aValue / THE_POW10[-anExp] : aValue * THE_POW10[anExp];
+    theValue = isNegative ? -aResult : aResult;
+    return Standard_True;
+  }
+}
+
 Standard_Real Interface_FileReaderData::Fastof (const Standard_CString ligne)
 {
+  Standard_Real aValue = 0.;
+  if (fastDecimal (ligne, aValue))
+    return aValue;
   return Strtod (ligne, 0);
 }
@@ -26,6 +26,7 @@
 #include <Interface_ReportEntity.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_ErrorHandler.hxx>
 #include <Standard_Failure.hxx>
 #include <Standard_Transient.hxx>
@@ -43,6 +44,8 @@
 // To use TCollectionHAsciiString
 #include <TCollection_HAsciiString.hxx>
 
+#include <vector>
+
 // Failure pour recuperer erreur en lecture fichier,
 // TypeMismatch pour message d erreur circonstancie (cas particulier important)
 
@@ -60,10 +63,69 @@ Interface_FileReaderTool::Interface_FileReaderTool ()
 {
   themessenger = Message::DefaultMessenger();
   theerrhand = Standard_True;
+  theparallel = Standard_False;
   thetrace = 0;
   thenbrep0 = thenbreps = 0;
 }
 
+namespace
+{
+  //! Functor analysing records of entities by several threads.
+  //! Resulting checks are stored by record numbers. For a record which raised
+  //! an exception, a copy of the exception is stored instead : the entity is
+  //! left partly filled, so it is not analysed again, the exception is raised
+  //! again by the sequential loop which performs the usual recovery.
+  class Interface_AnalyseRecordFunctor
+  {
+  public:
+
+    Interface_AnalyseRecordFunctor (Interface_FileReaderTool& theTool,
+                                    const Handle(Interface_FileReaderData)& theReader,
+                                    const std::vector<Standard_Integer>& theRecords,
+                                    const Handle(TColStd_HArray1OfTransient)& theChecks)
+    : myTool (theTool),
+      myReader (theReader),
+      myRecords (theRecords),
+      myChecks (theChecks) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Standard_Integer aNum = myRecords[theIndex];
+      const Handle(Standard_Transient)& anEnt = myReader->BoundEntity (aNum);
+      Handle(Interface_Check) aCheck = new Interface_Check (anEnt);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        myTool.AnalyseRecord (aNum, anEnt, aCheck);
+        myChecks->SetValue (aNum, aCheck);
+      }
+      catch (Standard_Failure const& anException)
+      {
+        Handle(Standard_Failure) aFailure;
+#ifdef _WIN32
+        if (anException.IsKind (STANDARD_TYPE(OSD_Exception)))
+          aFailure = new OSD_Exception (anException.GetMessageString());
+#else
+        if (anException.IsKind (STANDARD_TYPE(OSD_Signal)))
+          aFailure = new OSD_Signal (anException.GetMessageString());
+#endif
+        else
+          aFailure = new Standard_Failure (anException.GetMessageString());
+        myChecks->SetValue (aNum, aFailure);
+      }
+    }
+
+  private:
+    Interface_AnalyseRecordFunctor& operator= (const Interface_AnalyseRecordFunctor&);
+
+  private:
+    Interface_FileReaderTool& myTool;
+    const Handle(Interface_FileReaderData)& myReader;
+    const std::vector<Standard_Integer>& myRecords;
+    const Handle(TColStd_HArray1OfTransient)& myChecks;
+  };
+}
+
 //=======================================================================
 //function : SetData
 //purpose  : 
@@ -185,6 +247,27 @@ Standard_Boolean  Interface_FileReaderTool::ErrorHandle() const
   return theerrhand;
 }
 
+//=======================================================================
+//function : SetParallel
+//purpose  : 
+//=======================================================================
+
+void Interface_FileReaderTool::SetParallel (const Standard_Boolean theIsParallel)
+{
+  theparallel = theIsParallel;
+}
+
+
+//=======================================================================
+//function : IsParallel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean Interface_FileReaderTool::IsParallel() const
+{
+  return theparallel;
+}
+
 //  ....            Actions Connexes au CHARGEMENT DU MODELE            ....
 
 // SetEntities fait appel a des methodes a fournir :
@@ -342,6 +425,24 @@ void Interface_FileReaderTool::LoadModel
 
   amodel->Reservate (thereader->NbEntities());
 
+  //  ..            Mode parallele : analyse des records par threads            ..
+  //  Entities are independent once bound to records (SetEntities) : their
+  //  records are analysed concurrently, LoadedEntity below only completes
+  //  the model sequentially. Records having a report since recognition
+  //  are left to the sequential loop.
+  if (theparallel) {
+    std::vector<Standard_Integer> aRecords;
+    aRecords.reserve (thereader->NbEntities());
+    for (Standard_Integer aNum = thereader->FindNextRecord(0); aNum > 0;
+         aNum = thereader->FindNextRecord(aNum)) {
+      if (thenbrep0 > 0 && !thereports->Value(aNum).IsNull()) continue;
+      aRecords.push_back (aNum);
+    }
+    thechecks = new TColStd_HArray1OfTransient (1,thereader->NbRecords());
+    Interface_AnalyseRecordFunctor aFunctor (*this, thereader, aRecords, thechecks);
+    OSD_Parallel::For (0, (Standard_Integer)aRecords.size(), aFunctor);
+  }
+
   Standard_Integer num, num0 = thereader->FindNextRecord(0);
   num = num0;
 
@@ -469,6 +570,8 @@ void Interface_FileReaderTool::LoadModel
     }    // -----  fin complete du try/catch
   }      // -----  fin du while
 
+  thechecks.Nullify();
+
 //  ..        Ajout des Reports, silya
   if (!thereports.IsNull()) {
     if (thetrace > 0) 
@@ -542,7 +645,22 @@ Handle(Standard_Transient) Interface_FileReaderTool::LoadedEntity
     }
   }
 //  ..        Chargement proprement dit : Specifique de la Norme        ..
-  AnalyseRecord(num,anent,ach);
+//            (deja fait par LoadModel en mode parallele)
+  Handle(Interface_Check) aLoadedCheck;
+  if (!thechecks.IsNull())
+  {
+    Handle(Standard_Transient) aLoaded = thechecks->Value(num);
+    thechecks->ChangeValue(num).Nullify();
+    //  Exception en mode parallele : l entite est partiellement remplie,
+    //  elle n est pas analysee une deuxieme fois, l exception est relancee
+    //  pour la recuperation par LoadModel, comme en mode sequentiel
+    Handle(Standard_Failure) aFailure = Handle(Standard_Failure)::DownCast (aLoaded);
+    if (!aFailure.IsNull())
+      aFailure->Jump();
+    aLoadedCheck = Handle(Interface_Check)::DownCast (aLoaded);
+  }
+  if (aLoadedCheck.IsNull()) AnalyseRecord(num,anent,ach);
+  else                       ach = aLoadedCheck;
 
 //  ..        Ajout dans le modele de l entite telle quelle        ..
 //            ATTENTION, ReportEntity traitee en bloc apres les Load
@@ -604,4 +722,5 @@ void Interface_FileReaderTool::Clear()
   thereader.Nullify();
   themodel.Nullify();
   thereports.Nullify();
+  thechecks.Nullify();
 }
@@ -97,6 +97,18 @@ public:
   //! Returns ErrorHandle flag
   Standard_EXPORT Standard_Boolean ErrorHandle() const;
   
+  //! Sets parallel mode of LoadModel : when True, records of the
+  //! entities are analysed (AnalyseRecord) concurrently, then the
+  //! entities are added to the model in the order of the file.
+  //! It requires AnalyseRecord to be thread-safe for different
+  //! records. A record raising an exception is not analysed again,
+  //! the entity is recovered by LoadModel as in sequential mode.
+  //! Default is False
+  Standard_EXPORT void SetParallel (const Standard_Boolean theIsParallel);
+  
+  //! Returns Parallel flag
+  Standard_EXPORT Standard_Boolean IsParallel() const;
+  
   //! Fills records with empty entities; once done, each entity can
   //! ask the FileReaderTool for any entity referenced through an
   //! identifier. Calls Recognize which is specific to each specific
@@ -203,9 +215,11 @@ private:
   Handle(Message_Messenger) themessenger;
   Standard_Integer thetrace;
   Standard_Boolean theerrhand;
+  Standard_Boolean theparallel;
   Standard_Integer thenbrep0;
   Standard_Integer thenbreps;
   Handle(TColStd_HArray1OfTransient) thereports;
+  Handle(TColStd_HArray1OfTransient) thechecks;
 
 
 };
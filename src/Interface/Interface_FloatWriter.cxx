@@ -15,6 +15,86 @@
 
 #include <Interface_FloatWriter.hxx>
 
+#include <cmath>
+
+namespace
+{
+  //! Writes the decimal digits of <theValue> (at least <theMinDigits>,
+  //! completed by leading zeros) and returns the position after them
+  static char* writeDigits (char* theText, unsigned long long theValue, int theMinDigits)
+  {
+    char aBuf[24];
+    int aNb = 0;
+    do
+    {
+      aBuf[aNb++] = char('0' + theValue % 10);
+      theValue /= 10;
+    }
+    while (theValue != 0);
+    for (; aNb < theMinDigits; ) aBuf[aNb++] = '0';
+    while (aNb > 0) *theText++ = aBuf[--aNb];
+    return theText;
+  }
+
+  //! Formats <theVal> by a format of the form "%W.PE" or "%W.Pf" (as set by
+  //! Interface_FloatWriter::SetDefaults) without calling Sprintf, when the decimal
+  //! expansion of the value is exact with 12 fractional digits (integers and values
+  //! with a few binary fractional digits, such as 0., 1., 0.5 - frequent in CAD data)
+  //! and no rounding is required. The result is then the same as given by Sprintf.
+  //! Returns False if the format or the value is not in this simple case.
+  static Standard_Boolean fastFormat (char* theText, const Standard_Real theVal, const char* theForm)
+  {
+    // parse format
+    const char* aForm = theForm;
+    if (*aForm++ != '%') return Standard_False;
+    int aWidth = 0, aPrec = 0;
+    for (; *aForm >= '0' && *aForm <= '9'; ++aForm) aWidth = aWidth * 10 + (*aForm - '0');
+    if (*aForm++ != '.') return Standard_False;
+    for (; *aForm >= '0' && *aForm <= '9'; ++aForm) aPrec = aPrec * 10 + (*aForm - '0');
+    const char aType = *aForm++;
+    if ((aType != 'E' && aType != 'f') || *aForm != '\0'
+      || aPrec < 12 || aPrec > 17 || aWidth > aPrec + 2)
+    {
+      return Standard_False;
+    }
+
+    // value = aScaled / 10^12 exactly if value * 2^12 is integer
+    if (!(std::fabs (theVal) < 1.e7)) return Standard_False;
+    const Standard_Real aBin = std::fabs (theVal) * 4096.;
+    if (aBin != std::floor (aBin)) return Standard_False;
+    const unsigned long long aScaled = (unsigned long long )aBin * 244140625ULL; // 5^12
+    const unsigned long long aPow12  = 1000000000000ULL;
+
+    char* aPtr = theText;
+    if (std::signbit (theVal)) *aPtr++ = '-';
+    if (aType == 'f')
+    {
+      aPtr = writeDigits (aPtr, aScaled / aPow12, 1);
+      *aPtr++ = '.';
+      aPtr = writeDigits (aPtr, aScaled % aPow12, 12);
+      for (int i = 12; i < aPrec; ++i) *aPtr++ = '0';
+      *aPtr = '\0';
+      return Standard_True;
+    }
+
+    // exponent form : all significant digits must be written without rounding
+    char aDigits[24];
+    const int aNbDigits = int(writeDigits (aDigits, aScaled, 1) - aDigits);
+    int aNbSignif = aNbDigits;
+    while (aNbSignif > 1 && aDigits[aNbSignif - 1] == '0') --aNbSignif;
+    if (aNbSignif > aPrec + 1) return Standard_False;
+    const int anExp = (aScaled == 0) ? 0 : aNbDigits - 1 - 12;
+    *aPtr++ = aDigits[0];
+    *aPtr++ = '.';
+    for (int i = 1; i <= aPrec; ++i) *aPtr++ = (i < aNbSignif) ? aDigits[i] : '0';
+    *aPtr++ = 'E';
+    *aPtr++ = (anExp < 0) ? '-' : '+';
+    aPtr = writeDigits (aPtr, (unsigned long long )(anExp < 0 ? -anExp : anExp), 2);
+    *aPtr = '\0';
+    return Standard_True;
+  }
+}
+
 Interface_FloatWriter::Interface_FloatWriter (const Standard_Integer chars)
 {
   SetDefaults(chars);
@@ -106,10 +186,9 @@ Standard_Integer Interface_FloatWriter::Convert (const Standard_Real val,
 
   pText=(char *)text;
   //
-  if ( (val >= R1 && val <  R2) || (val <= -R1 && val > -R2) ) 
-    Sprintf(pText,rangeform,val);
-  else 
-    Sprintf(pText,mainform,val);
+  const Standard_CString aForm = ( (val >= R1 && val <  R2) || (val <= -R1 && val > -R2) ) ? rangeform : mainform;
+  if (!fastFormat (pText, val, aForm))
+    Sprintf(pText,aForm,val);
   
   if (zsup) 
   {
@@ -75,6 +75,9 @@ OSD_Chronometer chAdd11, chAdd12, chAdd2, chUpdate, chPointValid;
 OSD_Chronometer chIsos, chPointsOnIsos;
 #endif
 
+//! Change tracker shared by the calls of incmesh command with -track option.
+static Handle(BRepMesh_ChangeTracker) THE_MESH_CHANGE_TRACKER;
+
 //=======================================================================
 //function : incrementalmesh
 //purpose  : 
@@ -91,7 +94,9 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
 
   TopoDS_ListOfShape aListOfShapes;
   IMeshTools_Parameters aMeshParams;
-  bool hasDefl = false, hasAngDefl = false, isPrsDefl = false;
+  bool hasDefl = false, hasAngDefl = false, isPrsDefl = false, toTrack = false;
+  Handle(BRepMesh_TessellationCache) aCache;
+  NCollection_Vector<Standard_Real> aLODs;
 
   Handle(IMeshTools_Context) aContext = new BRepMesh_Context();
   for (Standard_Integer anArgIter = 1; anArgIter < theNbArgs; ++anArgIter)
@@ -108,6 +113,14 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.InParallel = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-parallel_face")
+    {
+      aMeshParams.InParallelFace = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-shared_cache")
+    {
+      aMeshParams.SharedSplineCache = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
     else if (aNameCase == "-int_vert_off")
     {
       aMeshParams.InternalVerticesMode = !Draw::ParseOnOffIterator (theNbArgs, theArgVec, anArgIter);
@@ -128,6 +141,35 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     {
       aMeshParams.AllowQualityDecrease = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
     }
+    else if (aNameCase == "-track")
+    {
+      toTrack = Draw::ParseOnOffNoIterator (theNbArgs, theArgVec, anArgIter);
+    }
+    else if (aNameCase == "-cache"
+          && anArgIter + 1 < theNbArgs)
+    {
+      aCache = new BRepMesh_TessellationCache (theArgVec[++anArgIter]);
+    }
+    else if (aNameCase == "-lods"
+          && anArgIter + 1 < theNbArgs)
+    {
+      const TCollection_AsciiString aList (theArgVec[++anArgIter]);
+      for (Standard_Integer aTokenIter = 1;; ++aTokenIter)
+      {
+        const TCollection_AsciiString aToken = aList.Token (" \t", aTokenIter);
+        if (aToken.IsEmpty())
+        {
+          break;
+        }
+        const Standard_Real aVal = aToken.IsRealValue (true) ? aToken.RealValue() : 0.0;
+        if (aVal <= Precision::Confusion())
+        {
+          theDI << "Syntax error: invalid deflection of level of detail '" << aToken << "'";
+          return 1;
+        }
+        aLODs.Append (aVal);
+      }
+    }
     else if (aNameCase == "-algo"
           && anArgIter + 1 < theNbArgs)
     {
@@ -274,11 +316,54 @@ static Standard_Integer incrementalmesh (Draw_Interpretor& theDI,
     }
   }
 
+  if ((toTrack ? 1 : 0) + (aCache.IsNull() ? 0 : 1) + (aLODs.IsEmpty() ? 0 : 1) > 1)
+  {
+    theDI << "Syntax error: -track, -cache and -lods options cannot be combined";
+    return 1;
+  }
+
+  if (toTrack)
+  {
+    if (THE_MESH_CHANGE_TRACKER.IsNull())
+    {
+      THE_MESH_CHANGE_TRACKER = new BRepMesh_ChangeTracker();
+    }
+    Handle(BRepMesh_Context)::DownCast (aContext)->SetChangeTracker (THE_MESH_CHANGE_TRACKER);
+  }
+
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (theDI, 1);
   BRepMesh_IncrementalMesh aMesher;
   aMesher.SetShape (aShape);
   aMesher.ChangeParameters() = aMeshParams;
-  aMesher.Perform (aContext, aProgress->Start());
+  if (!aLODs.IsEmpty())
+  {
+    TColStd_Array1OfReal aDeflections (1, aLODs.Length());
+    for (Standard_Integer aLodIter = 1; aLodIter <= aLODs.Length(); ++aLodIter)
+    {
+      aDeflections.SetValue (aLodIter, aLODs.Value (aLodIter - 1));
+    }
+    aMesher.PerformLODs (aDeflections, aProgress->Start());
+  }
+  else if (!aCache.IsNull())
+  {
+    // the cache is used only with default context
+    aMesher.SetCache (aCache);
+    aMesher.Perform (aProgress->Start());
+    theDI << "Tessellation cache: "
+          << (aCache->NbHits()   != 0 ? "hit"
+            : aCache->NbMisses() != 0 ? "miss" : "not used") << "\n";
+  }
+  else
+  {
+    aMesher.Perform (aContext, aProgress->Start());
+  }
+
+  if (toTrack)
+  {
+    theDI << "Modified edges: " << THE_MESH_CHANGE_TRACKER->NbModifiedEdges()
+          << ", modified faces: " << THE_MESH_CHANGE_TRACKER->NbModifiedFaces()
+          << ", restored faces: " << THE_MESH_CHANGE_TRACKER->NbRestoredFaces() << "\n";
+  }
 
   theDI << "Meshing statuses: ";
   const Standard_Integer aStatus = aMesher.GetStatusFlags();
@@ -1601,11 +1686,13 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
 
   theCommands.Add("incmesh",
     "incmesh Shape LinDefl [-angular Angle]=28.64 [-prs]"
-    "\n\t\t:   [-relative {0|1}]=0 [-parallel {0|1}]=0 [-min Size]"
+    "\n\t\t:   [-relative {0|1}]=0 [-parallel {0|1}]=0 [-parallel_face {0|1}]=0"
+    "\n\t\t:   [-shared_cache {0|1}]=0 [-min Size]"
     "\n\t\t:   [-algo {watson|delabella}]=watson"
     "\n\t\t:   [-di Value] [-ai Angle]=57.29"
     "\n\t\t:   [-int_vert_off {0|1}]=0 [-surf_def_off {0|1}]=0 [-adjust_min {0|1}]=0"
-    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0"
+    "\n\t\t:   [-force_face_def {0|1}]=0 [-decrease {0|1}]=0 [-track {0|1}]=0"
+    "\n\t\t:   [-cache Dir] [-lods {Defl1 Defl2 ...}]"
     "\n\t\t: Builds triangular mesh for the shape."
     "\n\t\t:  LinDefl         linear deflection to control mesh quality;"
     "\n\t\t:  -angular        angular deflection for edges in deg (~28.64 deg = 0.5 rad by default);"
@@ -1613,6 +1700,9 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:                  (20 deg angular deflection, 0.001 of bounding box linear deflection);"
     "\n\t\t:  -relative       notifies that relative deflection is used (FALSE by default);"
     "\n\t\t:  -parallel       enables parallel execution (FALSE by default);"
+    "\n\t\t:  -parallel_face  enables parallel execution within a single face (FALSE by default);"
+    "\n\t\t:  -shared_cache   shares the caches of spans of B-spline surfaces and curves"
+    "\n\t\t:                  between the threads for the time of meshing (FALSE by default);"
     "\n\t\t:  -algo           changes core triangulation algorithm to one with specified id (watson by default);"
     "\n\t\t:  -min            minimum size parameter limiting size of triangle's edges to prevent sinking"
     "\n\t\t:                  into amplification in case of distorted curves and surfaces;"
@@ -1623,7 +1713,14 @@ void  MeshTest::Commands(Draw_Interpretor& theCommands)
     "\n\t\t:  -adjust_min     enables local adjustment of min size depending on edge size (FALSE by default);"
     "\n\t\t:  -force_face_def disables usage of shape tolerances for computing face deflection (FALSE by default);"
     "\n\t\t:  -decrease       enforces the meshing of the shape even if current mesh satisfies the new criteria"
-    "\n\t\t:                  (FALSE by default).",
+    "\n\t\t:                  (FALSE by default);"
+    "\n\t\t:  -track          remeshes only the faces modified since the previous call with this option,"
+    "\n\t\t:                  restores the mesh of unmodified faces which have lost it and prints"
+    "\n\t\t:                  the number of modified edges, modified and restored faces (FALSE by default);"
+    "\n\t\t:  -cache          restores the mesh of the shape having no mesh from the cache of tessellations"
+    "\n\t\t:                  stored in the given directory or stores the new mesh there;"
+    "\n\t\t:  -lods           builds levels of detail with the given linear deflections"
+    "\n\t\t:                  (LinDefl is ignored), the finest one becomes active.",
   __FILE__, incrementalmesh, g);
   theCommands.Add("tessellate","Builds triangular mesh for the surface, run w/o args for help",__FILE__, tessellate, g);
   theCommands.Add("MemLeakTest","MemLeakTest",__FILE__, MemLeakTest, g);
@@ -21,6 +21,7 @@
 #include <Interface_ReaderLib.hxx>
 #include <RWStepAP214_ReadWriteModule.hxx>
 #include <Standard_Transient.hxx>
+#include <Standard_Mutex.hxx>
 #include <Standard_Type.hxx>
 #include <StepAP214_Protocol.hxx>
 #include <StepData_StepReaderData.hxx>
@@ -2355,6 +2356,15 @@ static TCollection_AsciiString Reco_CubicBezierTriangulatedFace("CUBIC_BEZIER_TR
 static NCollection_DataMap<TCollection_AsciiString, Standard_Integer> typenums;
 static NCollection_DataMap<TCollection_AsciiString, Standard_Integer> typeshor;
 
+// cache of recognized complex types, the key is the list of components as read
+static NCollection_DataMap<TCollection_AsciiString, Standard_Integer> typecomplex;
+
+static Standard_Mutex& typecomplexMutex()
+{
+  static Standard_Mutex aMutex;
+  return aMutex;
+}
+
 RWStepAP214_ReadWriteModule::RWStepAP214_ReadWriteModule ()
 {
 //  Handle(StepAP214_Protocol) protocol = new StepAP214_Protocol;
@@ -3673,6 +3683,33 @@ Standard_Integer RWStepAP214_ReadWriteModule::CaseStep
 
 Standard_Integer RWStepAP214_ReadWriteModule::CaseStep
 (const TColStd_SequenceOfAsciiString& theTypes) const
+{
+  // The same complex types are usually repeated many times in a file :
+  // sorting and comparison of components are done once for each of them
+  TCollection_AsciiString aKey;
+  for (Standard_Integer i = 1; i <= theTypes.Length(); i++)
+  {
+    if (i > 1) aKey.AssignCat (',');
+    aKey.AssignCat (theTypes(i));
+  }
+  Standard_Integer aNum = 0;
+  {
+    Standard_Mutex::Sentry aSentry (typecomplexMutex());
+    if (typecomplex.Find (aKey, aNum)) return aNum;
+  }
+  aNum = caseComplexStep (theTypes);
+  Standard_Mutex::Sentry aSentry (typecomplexMutex());
+  typecomplex.Bind (aKey, aNum);
+  return aNum;
+}
+
+//=======================================================================
+//function : caseComplexStep
+//purpose  : 
+//=======================================================================
+
+Standard_Integer RWStepAP214_ReadWriteModule::caseComplexStep
+(const TColStd_SequenceOfAsciiString& theTypes) const
 {
   
   // Optimized by FMA : le test sur le nombre de composant est repete meme
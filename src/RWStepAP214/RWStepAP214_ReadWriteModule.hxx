@@ -74,8 +74,8 @@ protected:
 
 private:
 
-
-
+  //! recognizes a Complex entity by comparison of its sorted components
+  Standard_Integer caseComplexStep (const TColStd_SequenceOfAsciiString& theTypes) const;
 
 };
 
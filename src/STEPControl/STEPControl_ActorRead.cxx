@@ -29,7 +29,12 @@
 #include <Interface_Macros.hxx>
 #include <Interface_Static.hxx>
 #include <Message_Messenger.hxx>
+#include <Message_Printer.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_Sequence.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 #include <Precision.hxx>
 #include <Standard_ErrorHandler.hxx>
@@ -52,6 +57,7 @@
 #include <StepGeom_GeometricRepresentationContextAndGlobalUnitAssignedContext.hxx>
 #include <StepGeom_GeometricRepresentationItem.hxx>
 #include <StepGeom_GeomRepContextAndGlobUnitAssCtxAndGlobUncertaintyAssCtx.hxx>
+#include <StepGeom_SurfaceCurve.hxx>
 #include <StepRepr_GlobalUncertaintyAssignedContext.hxx>
 #include <StepRepr_GlobalUnitAssignedContext.hxx>
 #include <StepRepr_HArray1OfRepresentationItem.hxx>
@@ -74,7 +80,10 @@
 #include <StepShape_ContextDependentShapeRepresentation.hxx>
 #include <StepShape_EdgeBasedWireframeModel.hxx>
 #include <StepShape_EdgeBasedWireframeShapeRepresentation.hxx>
+#include <StepShape_EdgeCurve.hxx>
+#include <StepShape_EdgeLoop.hxx>
 #include <StepShape_FaceBasedSurfaceModel.hxx>
+#include <StepShape_FaceBound.hxx>
 #include <StepShape_FaceSurface.hxx>
 #include <StepShape_FacetedBrep.hxx>
 #include <StepShape_FacetedBrepAndBrepWithVoids.hxx>
@@ -85,6 +94,8 @@
 #include <StepShape_ManifoldSolidBrep.hxx>
 #include <StepShape_ManifoldSurfaceShapeRepresentation.hxx>
 #include <StepShape_NonManifoldSurfaceShapeRepresentation.hxx>
+#include <StepShape_OrientedClosedShell.hxx>
+#include <StepShape_OrientedEdge.hxx>
 #include <StepShape_ShapeDefinitionRepresentation.hxx>
 #include <StepShape_ShapeRepresentation.hxx>
 #include <StepShape_ShellBasedSurfaceModel.hxx>
@@ -99,6 +110,8 @@
 #include <StepToTopoDS_Tool.hxx>
 #include <StepToTopoDS_TranslateFace.hxx>
 #include <TColStd_HSequenceOfTransient.hxx>
+#include <TColStd_IndexedMapOfTransient.hxx>
+#include <TColStd_MapOfTransient.hxx>
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
@@ -203,6 +216,302 @@ namespace {
   // The better way is to pass this information via binder or via TopoDS_Shape itself, however,
   // this is very specific info to do so...
   Standard_Boolean NM_DETECTED = Standard_False;
+
+  //! Printer keeping the messages sent while a solid is translated in a parallel thread,
+  //! to pass them to the messenger of the main transient process in the order of items.
+  class STEPControl_BufferedPrinter : public Message_Printer
+  {
+  public:
+    STEPControl_BufferedPrinter() { myTraceLevel = Message_Trace; }
+
+    //! Sends the kept messages to the given messenger
+    void Flush (const Handle(Message_Messenger)& theMessenger) const
+    {
+      NCollection_Sequence<Message_Gravity>::Iterator aGravIt (myGravities);
+      for (NCollection_Sequence<TCollection_AsciiString>::Iterator aMsgIt (myMessages); aMsgIt.More(); aMsgIt.Next(), aGravIt.Next())
+      {
+        theMessenger->Send (aMsgIt.Value(), aGravIt.Value());
+      }
+    }
+
+    DEFINE_STANDARD_RTTI_INLINE(STEPControl_BufferedPrinter, Message_Printer)
+
+  protected:
+    virtual void send (const TCollection_AsciiString& theString,
+                       const Message_Gravity theGravity) const Standard_OVERRIDE
+    {
+      myMessages.Append (theString);
+      myGravities.Append (theGravity);
+    }
+
+  private:
+    mutable NCollection_Sequence<TCollection_AsciiString> myMessages;
+    mutable NCollection_Sequence<Message_Gravity>         myGravities;
+  };
+
+  //! Collects the 3D curves referenced by edges of the faces of the shell
+  void CollectShellCurves (const Handle(StepShape_ConnectedFaceSet)& theShell,
+                                  TColStd_IndexedMapOfTransient& theCurves)
+  {
+    if (theShell.IsNull())
+      return;
+    for (Standard_Integer i = 1; i <= theShell->NbCfsFaces(); i++)
+    {
+      Handle(StepShape_Face) aFace = theShell->CfsFacesValue (i);
+      if (aFace.IsNull() || aFace->Bounds().IsNull())
+        continue;
+      for (Standard_Integer j = 1; j <= aFace->NbBounds(); j++)
+      {
+        Handle(StepShape_FaceBound) aBound = aFace->BoundsValue (j);
+        Handle(StepShape_EdgeLoop) aLoop = aBound.IsNull() ? NULL : Handle(StepShape_EdgeLoop)::DownCast (aBound->Bound());
+        if (aLoop.IsNull() || aLoop->EdgeList().IsNull())
+          continue;
+        for (Standard_Integer k = 1; k <= aLoop->NbEdgeList(); k++)
+        {
+          Handle(StepShape_OrientedEdge) anOrEdge = aLoop->EdgeListValue (k);
+          Handle(StepShape_EdgeCurve) anEdge = anOrEdge.IsNull() ? NULL : Handle(StepShape_EdgeCurve)::DownCast (anOrEdge->EdgeElement());
+          if (anEdge.IsNull())
+            continue;
+          Handle(StepGeom_Curve) aCurve = anEdge->EdgeGeometry();
+          Handle(StepGeom_SurfaceCurve) aSurfCurve = Handle(StepGeom_SurfaceCurve)::DownCast (aCurve);
+          if (!aSurfCurve.IsNull())
+            aCurve = aSurfCurve->Curve3d();
+          if (!aCurve.IsNull())
+            theCurves.Add (aCurve);
+        }
+      }
+    }
+  }
+
+  //! Collects the 3D curves of edges of the solid; they are converted by
+  //! StepToTopoDS into Geom curves shared through the transient process
+  void CollectSolidCurves (const Handle(StepShape_ManifoldSolidBrep)& theSolid,
+                                  TColStd_IndexedMapOfTransient& theCurves)
+  {
+    CollectShellCurves (theSolid->Outer(), theCurves);
+    Handle(StepShape_BrepWithVoids) aBrepWithVoids = Handle(StepShape_BrepWithVoids)::DownCast (theSolid);
+    if (aBrepWithVoids.IsNull() || aBrepWithVoids->Voids().IsNull())
+      return;
+    for (Standard_Integer i = 1; i <= aBrepWithVoids->NbVoids(); i++)
+    {
+      Handle(StepShape_OrientedClosedShell) aVoid = aBrepWithVoids->VoidsValue (i);
+      if (!aVoid.IsNull())
+        CollectShellCurves (aVoid->ClosedShellElement(), theCurves);
+    }
+  }
+
+  //! Collects the shape representations used by the entity being transferred:
+  //! shapes of the product definition and its components in the assembly,
+  //! representations used by mapped items and related by non-assembly relationships
+  void CollectRepresentations (const Handle(Standard_Transient)& theStart,
+                               const Interface_Graph& theGraph,
+                                     TColStd_IndexedMapOfTransient& theReprs)
+  {
+    TColStd_IndexedMapOfTransient aQueue;
+    aQueue.Add(theStart);
+    for (Standard_Integer anIndex = 1; anIndex <= aQueue.Extent(); anIndex++)
+    {
+      const Handle(Standard_Transient) anEnt = aQueue(anIndex);
+      if (Handle(StepBasic_ProductDefinition) aPD = Handle(StepBasic_ProductDefinition)::DownCast(anEnt))
+      {
+        for (Interface_EntityIterator aSubs = theGraph.Sharings(aPD); aSubs.More(); aSubs.Next())
+        {
+          Handle(StepRepr_NextAssemblyUsageOccurrence) aNAUO = Handle(StepRepr_NextAssemblyUsageOccurrence)::DownCast(aSubs.Value());
+          if (!aNAUO.IsNull() && aNAUO->RelatingProductDefinition() == aPD)
+            aQueue.Add(aNAUO);
+          else if (aSubs.Value()->IsKind(STANDARD_TYPE(StepRepr_ProductDefinitionShape)))
+            aQueue.Add(aSubs.Value());
+        }
+      }
+      else if (Handle(StepRepr_NextAssemblyUsageOccurrence) aNAUO = Handle(StepRepr_NextAssemblyUsageOccurrence)::DownCast(anEnt))
+      {
+        if (!aNAUO->RelatedProductDefinition().IsNull())
+          aQueue.Add(aNAUO->RelatedProductDefinition());
+      }
+      else if (anEnt->IsKind(STANDARD_TYPE(StepRepr_ProductDefinitionShape)))
+      {
+        for (Interface_EntityIterator aSubs = theGraph.Sharings(anEnt); aSubs.More(); aSubs.Next())
+        {
+          if (aSubs.Value()->IsKind(STANDARD_TYPE(StepShape_ShapeDefinitionRepresentation)))
+            aQueue.Add(aSubs.Value());
+        }
+      }
+      else if (Handle(StepShape_ShapeDefinitionRepresentation) aSDR = Handle(StepShape_ShapeDefinitionRepresentation)::DownCast(anEnt))
+      {
+        if (!aSDR->UsedRepresentation().IsNull())
+          aQueue.Add(aSDR->UsedRepresentation());
+      }
+      else if (Handle(StepRepr_ShapeRepresentationRelationship) aSRR = Handle(StepRepr_ShapeRepresentationRelationship)::DownCast(anEnt))
+      {
+        if (!aSRR->Rep1().IsNull())
+          aQueue.Add(aSRR->Rep1());
+        if (!aSRR->Rep2().IsNull())
+          aQueue.Add(aSRR->Rep2());
+      }
+      else if (Handle(StepShape_ShapeRepresentation) aSR = Handle(StepShape_ShapeRepresentation)::DownCast(anEnt))
+      {
+        theReprs.Add(aSR);
+        for (Standard_Integer i = 1; i <= aSR->NbItems(); i++)
+        {
+          Handle(StepRepr_MappedItem) aMappedItem = Handle(StepRepr_MappedItem)::DownCast(aSR->ItemsValue(i));
+          if (!aMappedItem.IsNull() && !aMappedItem->MappingSource().IsNull()
+           && !aMappedItem->MappingSource()->MappedRepresentation().IsNull())
+            aQueue.Add(aMappedItem->MappingSource()->MappedRepresentation());
+        }
+        // relationships placing components of the assembly are followed through product definitions
+        for (Interface_EntityIterator aSubs = theGraph.Sharings(aSR); aSubs.More(); aSubs.Next())
+        {
+          if (!aSubs.Value()->IsKind(STANDARD_TYPE(StepRepr_ShapeRepresentationRelationship)))
+            continue;
+          Standard_Boolean isPlacement = Standard_False;
+          for (Interface_EntityIterator aSubs2 = theGraph.Sharings(aSubs.Value()); aSubs2.More() && !isPlacement; aSubs2.Next())
+            isPlacement = aSubs2.Value()->IsKind(STANDARD_TYPE(StepShape_ContextDependentShapeRepresentation));
+          if (!isPlacement)
+            aQueue.Add(aSubs.Value());
+        }
+      }
+    }
+  }
+
+  //! Unit factors and precision used to translate a representation
+  struct STEPControl_Units
+  {
+    Standard_Real LengthFactor;
+    Standard_Real PlaneAngleFactor;
+    Standard_Real SolidAngleFactor;
+    Standard_Real Precision;
+    Standard_Real MaxTol;
+
+    STEPControl_Units() : LengthFactor (1.), PlaneAngleFactor (1.), SolidAngleFactor (1.), Precision (0.), MaxTol (0.) {}
+
+    //! Takes current global factors and given precision
+    STEPControl_Units (const Standard_Real thePrecision, const Standard_Real theMaxTol)
+    : LengthFactor (StepData_GlobalFactors::Intance().LengthFactor()),
+      PlaneAngleFactor (StepData_GlobalFactors::Intance().PlaneAngleFactor()),
+      SolidAngleFactor (StepData_GlobalFactors::Intance().SolidAngleFactor()),
+      Precision (thePrecision),
+      MaxTol (theMaxTol)
+    {}
+
+    Standard_Boolean IsEqual (const STEPControl_Units& theOther) const
+    {
+      return LengthFactor == theOther.LengthFactor
+          && PlaneAngleFactor == theOther.PlaneAngleFactor
+          && SolidAngleFactor == theOther.SolidAngleFactor
+          && Precision == theOther.Precision
+          && MaxTol == theOther.MaxTol;
+    }
+  };
+
+  //! Keeps the units and precision of the actor, to restore them on destruction
+  class STEPControl_UnitsSentry
+  {
+  public:
+    STEPControl_UnitsSentry (Handle(StepRepr_Representation)& theContext,
+                             Standard_Real& thePrecision,
+                             Standard_Real& theMaxTol)
+    : myContext (theContext), myPrecision (thePrecision), myMaxTol (theMaxTol),
+      myOldContext (theContext), myOldUnits (thePrecision, theMaxTol)
+    {}
+
+    ~STEPControl_UnitsSentry()
+    {
+      StepData_GlobalFactors::Intance().InitializeFactors (myOldUnits.LengthFactor, myOldUnits.PlaneAngleFactor, myOldUnits.SolidAngleFactor);
+      myContext = myOldContext;
+      myPrecision = myOldUnits.Precision;
+      myMaxTol = myOldUnits.MaxTol;
+    }
+
+  private:
+    STEPControl_UnitsSentry& operator= (const STEPControl_UnitsSentry&) Standard_DELETE;
+
+  private:
+    Handle(StepRepr_Representation)& myContext;
+    Standard_Real& myPrecision;
+    Standard_Real& myMaxTol;
+    const Handle(StepRepr_Representation) myOldContext;
+    const STEPControl_Units myOldUnits;
+  };
+
+  //! Counts the nested calls of Transfer()
+  class STEPControl_LevelSentry
+  {
+  public:
+    STEPControl_LevelSentry (Standard_Integer& theLevel) : myLevel (theLevel) { ++myLevel; }
+    ~STEPControl_LevelSentry() { --myLevel; }
+
+  private:
+    STEPControl_LevelSentry& operator= (const STEPControl_LevelSentry&) Standard_DELETE;
+
+  private:
+    Standard_Integer& myLevel;
+  };
+
+  //! Functor translating solids (of one or several shape representations) in parallel threads.
+  //! Each item is translated into its own transient process, so that bindings
+  //! and checks can be merged into the main one later in the order of items.
+  class STEPControl_SolidTransferFunctor
+  {
+  public:
+    STEPControl_SolidTransferFunctor (const NCollection_Array1<Handle(StepShape_ManifoldSolidBrep)>& theItems,
+                                      const NCollection_Array1<Handle(Transfer_TransientProcess)>& theProcesses,
+                                      NCollection_Array1<Message_ProgressRange>& theRanges,
+                                      const Standard_Real thePrecision,
+                                      const Standard_Real theMaxTol)
+    : myItems (theItems),
+      myProcesses (theProcesses),
+      myRanges (theRanges),
+      myPrecision (thePrecision),
+      myMaxTol (theMaxTol)
+    {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const Handle(StepShape_ManifoldSolidBrep)& anItem = myItems.Value (theIndex);
+      const Handle(Transfer_TransientProcess)& aTP = myProcesses.Value (theIndex);
+      Message_ProgressRange& aRange = myRanges.ChangeValue (theIndex);
+      if (!aRange.More())
+        return;
+      StepToTopoDS_Builder aBuilder;
+      aBuilder.SetPrecision (myPrecision);
+      aBuilder.SetMaxTol (myMaxTol);
+      try
+      {
+        OCC_CATCH_SIGNALS
+        if (anItem->IsKind (STANDARD_TYPE(StepShape_FacetedBrep)))
+        {
+          aBuilder.Init (Handle(StepShape_FacetedBrep)::DownCast (anItem), aTP, aRange);
+        }
+        else if (anItem->IsKind (STANDARD_TYPE(StepShape_BrepWithVoids)))
+        {
+          aBuilder.Init (Handle(StepShape_BrepWithVoids)::DownCast (anItem), aTP, aRange);
+        }
+        else
+        {
+          aBuilder.Init (anItem, aTP, aRange);
+        }
+      }
+      catch (Standard_Failure const&)
+      {
+        aTP->AddFail (anItem, "Exception is raised. Entity was not translated.");
+        return;
+      }
+      if (aBuilder.IsDone())
+      {
+        TransferBRep::SetShapeResult (aTP, anItem, aBuilder.Value());
+      }
+    }
+
+  private:
+    STEPControl_SolidTransferFunctor& operator= (const STEPControl_SolidTransferFunctor&) Standard_DELETE;
+
+  private:
+    const NCollection_Array1<Handle(StepShape_ManifoldSolidBrep)>& myItems;
+    const NCollection_Array1<Handle(Transfer_TransientProcess)>&   myProcesses;
+    NCollection_Array1<Message_ProgressRange>&                     myRanges;
+    const Standard_Real myPrecision;
+    const Standard_Real myMaxTol;
+  };
 }
 
 // ============================================================================
@@ -212,7 +521,8 @@ namespace {
 
 STEPControl_ActorRead::STEPControl_ActorRead()
 : myPrecision(0.0),
-  myMaxTol(0.0)
+  myMaxTol(0.0),
+  myTransferLevel(0)
 {
 }
 
@@ -323,7 +633,30 @@ Handle(Transfer_Binder)  STEPControl_ActorRead::Transfer
   }
   // [END] Get version of preprocessor (to detect I-Deas case) (ssv; 23.11.2010)
   Standard_Boolean aTrsfUse = (Interface_Static::IVal("read.step.root.transformation") == 1);
-  return TransferShape(start, TP, Standard_True, aTrsfUse, theProgress);
+
+  // Transfer() is called recursively for sub-entities through TP;
+  // solids of all parts are prepared once, at the root level only
+  STEPControl_LevelSentry aLevel(myTransferLevel);
+  if (myTransferLevel > 1)
+    return TransferShape(start, TP, Standard_True, aTrsfUse, theProgress);
+
+  myPreparedItems.Clear();
+  NCollection_Sequence<Handle(StepRepr_Representation)> aUnits;
+  NCollection_Sequence<NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> > aSolids;
+  if (collectRootSolids(start, TP, aUnits, aSolids) == 0)
+    return TransferShape(start, TP, Standard_True, aTrsfUse, theProgress);
+
+  Message_ProgressScope aPS(theProgress, NULL, 2);
+  prepareRoot(aUnits, aSolids, TP, aPS.Next());
+  if (aPS.UserBreak())
+  {
+    myPreparedItems.Clear();
+    return Handle(Transfer_Binder)();
+  }
+  Handle(Transfer_Binder) aBinder = TransferShape(start, TP, Standard_True, aTrsfUse, aPS.Next());
+  // solids of representations not used by the root are dropped
+  myPreparedItems.Clear();
+  return aBinder;
 }
 
 
@@ -870,7 +1203,14 @@ Handle(TransferBRep_ShapeBinder) STEPControl_ActorRead::TransferEntity(
   // [END] Proceed with non-manifold topology (ssv; 12.11.2010)
 
   gp_Trsf aTrsf;
-  Message_ProgressScope aPSRoot(theProgress, "Sub-assembly", isManifold ? 1 : 2);
+  // Translate solids in parallel threads in advance (unless it is already done for the root);
+  // the results are taken in the loop below
+  NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> aSolids;
+  if (isManifold)
+    collectSolids(sr, TP, aSolids);
+  Message_ProgressScope aPSRoot(theProgress, "Sub-assembly", (isManifold ? 1 : 2) + (aSolids.IsEmpty() ? 0 : 1));
+  if (!aSolids.IsEmpty())
+    prepareItems(aSolids, TP, aPSRoot.Next());
   Message_ProgressScope aPS (aPSRoot.Next(), "Transfer", nb);
   TopTools_IndexedMapOfShape aCompoundedShapes;
   for (Standard_Integer i = 1; i <= nb && aPS.More(); i ++)
@@ -938,6 +1278,8 @@ Handle(TransferBRep_ShapeBinder) STEPControl_ActorRead::TransferEntity(
       }
     }
   }
+  for (Standard_Integer i = 1; i <= nb && !myPreparedItems.IsEmpty(); i++)
+    myPreparedItems.UnBind(sr->ItemsValue(i));
 
   // [BEGIN] Proceed with non-manifold topology (ssv; 12.11.2010)
   if (!isManifold) {
@@ -1417,7 +1759,33 @@ Handle(TransferBRep_ShapeBinder) STEPControl_ActorRead::TransferEntity
 
   const Standard_Boolean aReadTessellatedWhenNoBRepOnly = (Interface_Static::IVal("read.step.tessellated") == 2);
   Standard_Boolean aHasGeom = Standard_True;
-  try {
+  Standard_Boolean isBuilt = Standard_False;
+  Handle(Standard_Transient) aPrepared;
+  if (myPreparedItems.Find(start, aPrepared)) {
+    // Solid has been already translated by prepareItems(): take over its bindings
+    myPreparedItems.UnBind(start);
+    aPS.Next();
+    Handle(Transfer_TransientProcess) aPreparedTP = Handle(Transfer_TransientProcess)::DownCast(aPrepared);
+    Handle(STEPControl_BufferedPrinter) aPrinter =
+      Handle(STEPControl_BufferedPrinter)::DownCast(aPreparedTP->Messenger()->Printers().First());
+    aPrinter->Flush(TP->Messenger());
+    // Bindings are passed in the order they were made, as if the solid was translated here;
+    // the curves taken from the main transient process are skipped
+    for (Standard_Integer i = 1; i <= aPreparedTP->NbMapped(); i++) {
+      const Handle(Standard_Transient)& anEnt = aPreparedTP->Mapped(i);
+      const Handle(Transfer_Binder)& aBinder = aPreparedTP->MapItem(i);
+      if (anEnt == start) {
+        mappedShape = TransferBRep::ShapeResult(aBinder);
+        if (!mappedShape.IsNull())
+          continue;
+      }
+      else if (TP->Find(anEnt) == aBinder)
+        continue;
+      TP->Bind(anEnt, aBinder);
+    }
+    isBuilt = !mappedShape.IsNull();
+  }
+  else try {
     OCC_CATCH_SIGNALS
     Message_ProgressRange aRange = aPS.Next();
     if (start->IsKind(STANDARD_TYPE(StepShape_FacetedBrep))) {
@@ -1485,6 +1853,9 @@ Handle(TransferBRep_ShapeBinder) STEPControl_ActorRead::TransferEntity
   
   if (found && myShapeBuilder.IsDone()) {
     mappedShape = myShapeBuilder.Value();
+    isBuilt = Standard_True;
+  }
+  if (isBuilt) {
     // Apply ShapeFix (on manifold shapes only. Non-manifold topology is processed separately: ssv; 13.11.2010)
     if (isManifold && aHasGeom) 
     {
@@ -1948,6 +2319,199 @@ Standard_Boolean STEPControl_ActorRead::ComputeSRRWT (const Handle(StepRepr_Repr
   return ComputeTransformation ( Ax1, Ax2, SRR->Rep1(), SRR->Rep2(), TP, Trsf);
 }
 
+//=======================================================================
+//function : collectSolids
+//purpose  : 
+//=======================================================================
+
+void STEPControl_ActorRead::collectSolids (const Handle(StepShape_ShapeRepresentation)& sr,
+                                           const Handle(Transfer_TransientProcess)& TP,
+                                           NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)>& theSolids) const
+{
+  if (Interface_Static::IVal("read.step.parallel") != 1
+   || OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch() < 2)
+  {
+    return;
+  }
+
+  // Only manifold solids are taken: they are translated independently from each other
+  // within the units of the representation context
+  NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> aSolids;
+  TColStd_MapOfTransient aSolidsMap;
+  for (Standard_Integer i = 1; i <= sr->NbItems(); i++) {
+    Handle(StepShape_ManifoldSolidBrep) aSolid = Handle(StepShape_ManifoldSolidBrep)::DownCast(sr->ItemsValue(i));
+    if (!aSolid.IsNull() && !TP->IsBound(aSolid) && !myPreparedItems.IsBound(aSolid) && aSolidsMap.Add(aSolid))
+      aSolids.Append(aSolid);
+  }
+  if (aSolids.Length() > 1)
+    theSolids.Append(aSolids);
+}
+
+//=======================================================================
+//function : collectRootSolids
+//purpose  : 
+//=======================================================================
+
+Standard_Integer STEPControl_ActorRead::collectRootSolids (const Handle(Standard_Transient)& start,
+                                                           const Handle(Transfer_TransientProcess)& TP,
+                                                           NCollection_Sequence<Handle(StepRepr_Representation)>& theUnits,
+                                                           NCollection_Sequence<NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> >& theSolids)
+{
+  if (Interface_Static::IVal("read.step.parallel") != 1
+   || OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch() < 2
+   || !TP->HasGraph())
+  {
+    return 0;
+  }
+
+  // non-manifold representations are translated with the help of myNMTool, sequentially
+  const Standard_Boolean isNMMode = Interface_Static::IVal("read.step.nonmanifold") != 0;
+  if (isNMMode && myNMTool.IsIDEASCase() && Interface_Static::IVal("read.step.ideas") != 0)
+    return 0;
+
+  TColStd_IndexedMapOfTransient aReprs;
+  CollectRepresentations(start, TP->Graph(), aReprs);
+
+  // Units of each representation are computed into a silent transient process
+  // (the warnings are reported when the representation is translated);
+  // representations with the same units and precision form one group
+  Handle(Transfer_TransientProcess) aSilentTP = new Transfer_TransientProcess;
+  aSilentTP->SetTraceLevel(0);
+  STEPControl_UnitsSentry aUnitsSentry(mySRContext, myPrecision, myMaxTol);
+  NCollection_Sequence<STEPControl_Units> aGroupUnits;
+  TColStd_MapOfTransient aSolidsMap;
+  Standard_Integer aNbSolids = 0;
+  for (Standard_Integer i = 1; i <= aReprs.Extent(); i++) {
+    Handle(StepShape_ShapeRepresentation) sr = Handle(StepShape_ShapeRepresentation)::DownCast(aReprs(i));
+    if (isNMMode && sr->IsKind(STANDARD_TYPE(StepShape_NonManifoldSurfaceShapeRepresentation)))
+      continue;
+    NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> aSolids;
+    for (Standard_Integer j = 1; j <= sr->NbItems(); j++) {
+      Handle(StepShape_ManifoldSolidBrep) aSolid = Handle(StepShape_ManifoldSolidBrep)::DownCast(sr->ItemsValue(j));
+      if (!aSolid.IsNull() && !TP->IsBound(aSolid) && aSolidsMap.Add(aSolid))
+        aSolids.Append(aSolid);
+    }
+    if (aSolids.IsEmpty())
+      continue;
+
+    PrepareUnits(sr, aSilentTP);
+    const STEPControl_Units aUnits (myPrecision, myMaxTol);
+    Standard_Integer aGroup = 1;
+    for (; aGroup <= aGroupUnits.Length() && !aGroupUnits(aGroup).IsEqual(aUnits); aGroup++) {}
+    if (aGroup > aGroupUnits.Length()) {
+      aGroupUnits.Append(aUnits);
+      theUnits.Append(sr);
+      theSolids.Append(NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)>());
+    }
+    aNbSolids += aSolids.Length();
+    theSolids.ChangeValue(aGroup).Append(aSolids);
+  }
+
+  if (aNbSolids < 2) {
+    theUnits.Clear();
+    theSolids.Clear();
+    return 0;
+  }
+  return aNbSolids;
+}
+
+//=======================================================================
+//function : prepareRoot
+//purpose  : 
+//=======================================================================
+
+void STEPControl_ActorRead::prepareRoot (const NCollection_Sequence<Handle(StepRepr_Representation)>& theUnits,
+                                         const NCollection_Sequence<NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> >& theSolids,
+                                         const Handle(Transfer_TransientProcess)& TP,
+                                         const Message_ProgressRange& theProgress)
+{
+  Handle(Transfer_TransientProcess) aSilentTP = new Transfer_TransientProcess;
+  aSilentTP->SetTraceLevel(0);
+  STEPControl_UnitsSentry aUnitsSentry(mySRContext, myPrecision, myMaxTol);
+
+  Standard_Integer aNbSolids = 0;
+  for (Standard_Integer i = 1; i <= theSolids.Length(); i++)
+    aNbSolids += theSolids(i).Length();
+  Message_ProgressScope aPS(theProgress, "Translate solids", aNbSolids);
+  for (Standard_Integer i = 1; i <= theSolids.Length() && aPS.More(); i++) {
+    PrepareUnits(theUnits(i), aSilentTP);
+    prepareItems(theSolids(i), TP, aPS.Next(theSolids(i).Length()));
+  }
+
+}
+
+//=======================================================================
+//function : prepareItems
+//purpose  : Translates solids in parallel threads
+//=======================================================================
+
+void STEPControl_ActorRead::prepareItems (const NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)>& theSolids,
+                                          const Handle(Transfer_TransientProcess)& TP,
+                                          const Message_ProgressRange& theProgress)
+{
+  const Standard_Integer aNbSolids = theSolids.Length();
+  NCollection_Array1<Handle(StepShape_ManifoldSolidBrep)> anItems(0, aNbSolids - 1);
+  NCollection_Array1<TColStd_IndexedMapOfTransient> aCurves(0, aNbSolids - 1);
+  TColStd_IndexedMapOfTransient anAllCurves;
+  TColStd_MapOfTransient aSharedCurves;
+  for (Standard_Integer i = 0; i < aNbSolids; i++) {
+    anItems(i) = theSolids(i + 1);
+    CollectSolidCurves(anItems(i), aCurves(i));
+    for (Standard_Integer j = 1; j <= aCurves(i).Extent(); j++) {
+      // a curve already met belongs to one of the previous solids
+      const Standard_Integer aNbCurves = anAllCurves.Extent();
+      if (anAllCurves.Add(aCurves(i)(j)) <= aNbCurves)
+        aSharedCurves.Add(aCurves(i)(j));
+    }
+  }
+
+  // Curves shared by several solids are converted here, in the main transient process,
+  // as the first of these solids would do in sequential mode, so that all solids refer
+  // to the same geometry; failed curves are left for the solids to report them
+  for (Standard_Integer i = 1; i <= anAllCurves.Extent(); i++) {
+    Handle(StepGeom_Curve) aCurve = Handle(StepGeom_Curve)::DownCast(anAllCurves(i));
+    if (!aSharedCurves.Contains(aCurve) || !TP->FindTransient(aCurve).IsNull())
+      continue;
+    try {
+      OCC_CATCH_SIGNALS
+      Handle(Geom_Curve) aGeomCurve = StepToGeom::MakeCurve(aCurve);
+      if (!aGeomCurve.IsNull())
+        TP->BindTransient(aCurve, aGeomCurve);
+    }
+    catch (Standard_Failure const&) {
+    }
+  }
+
+  // Each solid is translated into its own transient process, which sees the curves already
+  // converted in the main one; messages are kept to be sent in the order of items
+  NCollection_Array1<Handle(Transfer_TransientProcess)> aProcesses(0, aNbSolids - 1);
+  for (Standard_Integer i = 0; i < aNbSolids; i++) {
+    Handle(Transfer_TransientProcess) aTP = new Transfer_TransientProcess;
+    aTP->SetMessenger(new Message_Messenger(new STEPControl_BufferedPrinter));
+    aTP->SetTraceLevel(TP->TraceLevel());
+    aTP->SetModel(TP->Model());
+    if (TP->HasGraph())
+      aTP->SetGraph(TP->HGraph());
+    for (Standard_Integer j = 1; j <= aCurves(i).Extent(); j++) {
+      if (!TP->FindTransient(aCurves(i)(j)).IsNull())
+        aTP->Bind(aCurves(i)(j), TP->Find(aCurves(i)(j)));
+    }
+    aProcesses(i) = aTP;
+  }
+
+  Message_ProgressScope aPS(theProgress, "Translate solids", aNbSolids);
+  NCollection_Array1<Message_ProgressRange> aRanges(0, aNbSolids - 1);
+  for (Standard_Integer i = 0; i < aNbSolids; i++)
+    aRanges(i) = aPS.Next();
+  STEPControl_SolidTransferFunctor aFunctor(anItems, aProcesses, aRanges, myPrecision, myMaxTol);
+  OSD_Parallel::For(0, aNbSolids, aFunctor);
+  if (aPS.UserBreak())
+    return;
+
+  for (Standard_Integer i = 0; i < aNbSolids; i++)
+    myPreparedItems.Bind(anItems(i), aProcesses(i));
+}
+
 //=======================================================================
 // Method  : closeIDEASShell
 // Purpose : Attempts to close the passed Shell with the passed closing
@@ -26,6 +26,8 @@
 #include <TopTools_ListOfShape.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <Message_ProgressRange.hxx>
+#include <TColStd_DataMapOfTransientTransient.hxx>
+#include <NCollection_Sequence.hxx>
 
 class StepRepr_Representation;
 class Standard_Transient;
@@ -46,6 +48,7 @@ class StepShape_FaceSurface;
 class TopoDS_Shell;
 class TopoDS_Compound;
 class StepRepr_ConstructiveGeometryRepresentationRelationship;
+class StepShape_ManifoldSolidBrep;
 
 
 class STEPControl_ActorRead;
@@ -179,10 +182,42 @@ private:
 
   Standard_EXPORT void computeIDEASClosings (const TopoDS_Compound& comp, TopTools_IndexedDataMapOfShapeListOfShape& shellClosingMap);
 
+  //! Collects manifold solids of the representation which are not translated yet
+  //! and can be translated in parallel threads (see "read.step.parallel").
+  Standard_EXPORT void collectSolids (const Handle(StepShape_ShapeRepresentation)& sr,
+                                      const Handle(Transfer_TransientProcess)& TP,
+                                      NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)>& theSolids) const;
+
+  //! Collects the solids of all shape representations reachable from the root entity
+  //! (parts of the assembly) which can be translated in parallel threads,
+  //! grouped by units and precision; theUnits receives one representation per group
+  //! defining its units. Returns the number of solids collected.
+  Standard_EXPORT Standard_Integer collectRootSolids (const Handle(Standard_Transient)& start,
+                                                      const Handle(Transfer_TransientProcess)& TP,
+                                                      NCollection_Sequence<Handle(StepRepr_Representation)>& theUnits,
+                                                      NCollection_Sequence<NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> >& theSolids);
+
+  //! Translates the groups of solids collected by collectRootSolids() in parallel threads,
+  //! each group with its own units; current units are restored afterwards.
+  Standard_EXPORT void prepareRoot (const NCollection_Sequence<Handle(StepRepr_Representation)>& theUnits,
+                                    const NCollection_Sequence<NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)> >& theSolids,
+                                    const Handle(Transfer_TransientProcess)& TP,
+                                    const Message_ProgressRange& theProgress);
+
+  //! Translates the solids into separate transient processes in parallel threads,
+  //! with the current units and precision; the results are picked up by
+  //! TransferEntity() for each solid.
+  //! Curves shared by several solids are converted in TP beforehand.
+  Standard_EXPORT void prepareItems (const NCollection_Sequence<Handle(StepShape_ManifoldSolidBrep)>& theSolids,
+                                     const Handle(Transfer_TransientProcess)& TP,
+                                     const Message_ProgressRange& theProgress);
+
   StepToTopoDS_NMTool myNMTool;
   Standard_Real myPrecision;
   Standard_Real myMaxTol;
   Handle(StepRepr_Representation) mySRContext;
+  TColStd_DataMapOfTransientTransient myPreparedItems;
+  Standard_Integer myTransferLevel;
 
 
 };
@@ -259,6 +259,23 @@ STEPControl_Controller::STEPControl_Controller ()
     Interface_Static::Init("step", "write.step.tessellated", '&', "eval OnNoBRep"); // 2
     Interface_Static::SetCVal("write.step.tessellated", "OnNoBRep");
 
+    // Parallel parsing of the DATA section of STEP file: Off by default
+    Interface_Static::Init("step", "read.step.parallel", 'e', "");
+    Interface_Static::Init("step", "read.step.parallel", '&', "enum 0");
+    Interface_Static::Init("step", "read.step.parallel", '&', "eval Off");      // 0
+    Interface_Static::Init("step", "read.step.parallel", '&', "eval On");       // 1
+    Interface_Static::SetCVal("read.step.parallel", "Off");
+
+    // Minimal size (in kilobytes) of the DATA section piece parsed by one thread
+    Interface_Static::Init("step", "read.step.parallel.chunk", 'i', "1024");
+
+    // Parallel formatting of entities when writing STEP file: Off by default
+    Interface_Static::Init("step", "write.step.parallel", 'e', "");
+    Interface_Static::Init("step", "write.step.parallel", '&', "enum 0");
+    Interface_Static::Init("step", "write.step.parallel", '&', "eval Off");     // 0
+    Interface_Static::Init("step", "write.step.parallel", '&', "eval On");      // 1
+    Interface_Static::SetCVal("write.step.parallel", "Off");
+
     Standard_STATIC_ASSERT((int)Resource_FormatType_CP850 - (int)Resource_FormatType_CP1250 == 18); // "Error: Invalid Codepage Enumeration"
 
     init = Standard_True;
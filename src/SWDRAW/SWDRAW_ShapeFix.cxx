@@ -396,10 +396,10 @@ static Standard_Integer fixshape (Draw_Interpretor& di, Standard_Integer argc, c
 {
   Handle(ShapeExtend_MsgRegistrator) msg = new ShapeExtend_MsgRegistrator;
   Handle(ShapeFix_Shape) sfs = new ShapeFix_Shape;
-  sfs->SetMsgRegistrator ( msg );
   
   Standard_CString res = 0;
   Standard_Integer par = 0, mess=0;
+  Standard_Boolean isParallel = Standard_False;
   for ( Standard_Integer i=1; i < argc; i++ )
   {
     if (strlen(argv[i]) == 2 &&
@@ -438,6 +438,11 @@ static Standard_Integer fixshape (Draw_Interpretor& di, Standard_Integer argc, c
       sfs->FixWireTool()->SetMaxTailWidth(Draw::Atof(argv[i]));
       sfs->FixWireTool()->FixTailMode() = 1;
     }
+    else if (!strcmp(argv[i], "-parallel"))
+    {
+      isParallel = Standard_True;
+      continue;
+    }
     else
     {
       switch ( par ) {
@@ -456,7 +461,7 @@ static Standard_Integer fixshape (Draw_Interpretor& di, Standard_Integer argc, c
 
   if ( par <2 ) {
     di << "Use: " << argv[0] << " result shape [tolerance [max_tolerance]] [switches]\n"
-      "[-maxtaila <degrees>] [-maxtailw <width>]\n";
+      "[-maxtaila <degrees>] [-maxtailw <width>] [-parallel]\n";
     di << "Switches allow to tune parameters of ShapeFix\n"; 
     di << "The following syntax is used: <symbol><parameter>\n"; 
     di << "- symbol may be - to set parameter off, + to set on or * to set default\n"; 
@@ -470,9 +475,15 @@ static Standard_Integer fixshape (Draw_Interpretor& di, Standard_Integer argc, c
     di << "  i - FixSelfIntersectionMode\n"; 
     di << "  n - FixNotchedEdgesMode\n"; 
     di << "For enhanced message output, use switch '+?'\n"; 
+    di << "Use -parallel to fix faces in parallel (in single thread with '+?')\n";
     return 1;
   }
 
+  // messages are collected only if requested, as they prevent parallel fixing
+  if ( mess || !isParallel )
+    sfs->SetMsgRegistrator ( msg );
+  sfs->SetParallel ( isParallel );
+
   Handle(Draw_ProgressIndicator) aProgress = new Draw_ProgressIndicator (di, 1);
   sfs->Perform (aProgress->Start());
   DBRep::Set (res,sfs->Shape());
@@ -846,7 +857,7 @@ static Standard_Integer connectedges(Draw_Interpretor& di, Standard_Integer n, c
 		   __FILE__,reface,g);
   theCommands.Add ("fixshape",
 "res shape [preci [maxpreci]] [{switches}]\n"
-"  [-maxtaila <degrees>] [-maxtailw <width>]",
+"  [-maxtaila <degrees>] [-maxtailw <width>] [-parallel]",
 		   __FILE__,fixshape,g);
 //  theCommands.Add ("testfill","result edge1 edge2",
 //		   __FILE__,XSHAPE_testfill,g);
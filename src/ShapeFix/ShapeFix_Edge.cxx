@@ -68,6 +68,20 @@ ShapeFix_Edge::ShapeFix_Edge()
   myProjector = new ShapeConstruct_ProjectCurveOnSurface;
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Edge) ShapeFix_Edge::Copy() const
+{
+  Handle(ShapeFix_Edge) aCopy = new ShapeFix_Edge (*this);
+  aCopy->myProjector = new ShapeConstruct_ProjectCurveOnSurface;
+  aCopy->myProjector->BuildCurveMode() = myProjector->BuildCurveMode();
+  aCopy->myProjector->AdjustOverDegenMode() = myProjector->AdjustOverDegenMode();
+  return aCopy;
+}
+
 //=======================================================================
 //function : Projector
 //purpose  : 
@@ -54,6 +54,10 @@ public:
   
   //! Empty constructor
   Standard_EXPORT ShapeFix_Edge();
+
+  //! Returns the copy of the tool with the same parameters
+  //! and its own projector, which can be used in another thread.
+  Standard_EXPORT virtual Handle(ShapeFix_Edge) Copy() const;
   
   //! Returns the projector used for recomputing missing pcurves
   //! Can be used for adjusting parameters of projector
@@ -135,6 +135,19 @@ ShapeFix_Face::ShapeFix_Face(const TopoDS_Face &face)
   Init( face );
 }
 
+//=======================================================================
+//function : Copy
+//purpose  : 
+//=======================================================================
+
+Handle(ShapeFix_Face) ShapeFix_Face::Copy() const
+{
+  Handle(ShapeFix_Face) aCopy = new ShapeFix_Face (*this);
+  aCopy->myFixWire = myFixWire->Copy();
+  aCopy->mySurf.Nullify();
+  return aCopy;
+}
+
 //=======================================================================
 //function : ClearModes
 //purpose  : 
@@ -60,6 +60,11 @@ public:
   
   //! Creates a tool and loads a face
   Standard_EXPORT ShapeFix_Face(const TopoDS_Face& face);
+
+  //! Returns the copy of the tool with the same modes and parameters
+  //! and its own tools for fixing wires and edges, which can be used
+  //! in another thread. The face should be loaded into the copy anew.
+  Standard_EXPORT virtual Handle(ShapeFix_Face) Copy() const;
   
   //! Sets all modes to default
   Standard_EXPORT virtual void ClearModes();
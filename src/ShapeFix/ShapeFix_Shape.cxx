@@ -17,6 +17,10 @@
 
 #include <BRep_Builder.hxx>
 #include <Message_ProgressScope.hxx>
+#include <NCollection_Array1.hxx>
+#include <NCollection_DataMap.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <ShapeBuild_ReShape.hxx>
 #include <ShapeFix.hxx>
 #include <ShapeFix_Edge.hxx>
@@ -25,16 +29,165 @@
 #include <ShapeFix_Solid.hxx>
 #include <ShapeFix_Wire.hxx>
 #include <Standard_Type.hxx>
+#include <TColStd_ListOfInteger.hxx>
+#include <TColStd_MapOfInteger.hxx>
 #include <TopAbs_ShapeEnum.hxx>
+#include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Iterator.hxx>
 #include <TopoDS_Shape.hxx>
 #include <TopoDS_Wire.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 IMPLEMENT_STANDARD_RTTIEXT(ShapeFix_Shape,ShapeFix_Root)
 
+namespace
+{
+  //=======================================================================
+  //function : collectFaces
+  //purpose  : Collects the faces to be fixed in the same way as they are
+  //           visited by ShapeFix_Shape::Perform(); the faces to be fixed
+  //           as free ones are marked
+  //=======================================================================
+  static void collectFaces (const TopoDS_Shape&               theShape,
+                            const Handle(ShapeBuild_ReShape)& theContext,
+                            const Standard_Boolean            theToFixSolids,
+                            const Standard_Boolean            theToFixShells,
+                            const Standard_Boolean            theToFixFreeFaces,
+                            TopTools_MapOfShape&              theVisited,
+                            TopTools_IndexedMapOfShape&       theFaces,
+                            TColStd_MapOfInteger&             theFreeFaces)
+  {
+    const TopoDS_Shape aShape = theContext->Apply (theShape);
+    if (aShape.IsNull())
+    {
+      return;
+    }
+    switch (aShape.ShapeType())
+    {
+      case TopAbs_COMPOUND:
+      case TopAbs_COMPSOLID:
+      {
+        for (TopoDS_Iterator anIter (aShape); anIter.More(); anIter.Next())
+        {
+          TopoDS_Shape aSubShapeNullLoc = anIter.Value();
+          aSubShapeNullLoc.Location (TopLoc_Location());
+          if (theVisited.Add (aSubShapeNullLoc))
+          {
+            collectFaces (anIter.Value(), theContext, theToFixSolids, theToFixShells,
+                          theToFixFreeFaces, theVisited, theFaces, theFreeFaces);
+          }
+        }
+        break;
+      }
+      case TopAbs_SOLID:
+      case TopAbs_SHELL:
+      {
+        if (!(aShape.ShapeType() == TopAbs_SOLID ? theToFixSolids : theToFixShells))
+        {
+          break;
+        }
+        for (TopExp_Explorer aShellExp (aShape, TopAbs_SHELL); aShellExp.More(); aShellExp.Next())
+        {
+          for (TopoDS_Iterator anIter (theContext->Apply (aShellExp.Current())); anIter.More(); anIter.Next())
+          {
+            if (anIter.Value().ShapeType() == TopAbs_FACE)
+            {
+              theFaces.Add (anIter.Value());
+            }
+          }
+        }
+        break;
+      }
+      case TopAbs_FACE:
+      {
+        if (theToFixFreeFaces && !theFaces.Contains (aShape))
+        {
+          theFreeFaces.Add (theFaces.Add (aShape));
+        }
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  //=======================================================================
+  //class   : ShapeFix_FaceFunctor
+  //purpose : Fixes the faces of one group of independent faces,
+  //          each thread uses its own face tool and context
+  //=======================================================================
+  class ShapeFix_FaceFunctor
+  {
+  public:
+    ShapeFix_FaceFunctor (const NCollection_Vector<Standard_Integer>&   theGroup,
+                          const NCollection_Array1<TopoDS_Shape>&       theFaces,
+                          const TColStd_MapOfInteger&                   theFreeFaces,
+                          const NCollection_Array1<Handle(ShapeFix_Face)>& theTools,
+                          const NCollection_Array1<Handle(ShapeBuild_ReShape)>& theContexts,
+                          NCollection_Array1<Standard_Boolean>&         theIsDone)
+    : myGroup (theGroup),
+      myFaces (theFaces),
+      myFreeFaces (theFreeFaces),
+      myTools (theTools),
+      myContexts (theContexts),
+      myIsDone (theIsDone)
+    {}
+
+    void operator() (const Standard_Integer theThreadIndex,
+                     const Standard_Integer theIndex) const
+    {
+      const Standard_Integer aFaceIndex = myGroup.Value (theIndex);
+      const TopoDS_Shape& aFace = myFaces.Value (aFaceIndex);
+      if (aFace.IsNull())
+      {
+        return;
+      }
+
+      const Handle(ShapeFix_Face)& aTool = myTools.Value (theThreadIndex);
+      const Handle(ShapeBuild_ReShape)& aContext = myContexts.Value (theThreadIndex);
+      aTool->SetContext (aContext);
+      aTool->FixWireTool()->SetContext (aContext);
+      aTool->FixWireTool()->FixEdgeTool()->SetContext (aContext);
+
+      // free faces are fixed with modification of topology and
+      // removal of small area wires allowed, as in ShapeFix_Shape::Perform()
+      Standard_Boolean& aTopoMode = aTool->FixWireTool()->ModifyTopologyMode();
+      Standard_Integer& aSmallAreaWireMode = aTool->FixSmallAreaWireMode();
+      const Standard_Boolean aSavTopoMode = aTopoMode;
+      const Standard_Integer aSavSmallAreaWireMode = aSmallAreaWireMode;
+      if (myFreeFaces.Contains (aFaceIndex))
+      {
+        aTopoMode = Standard_True;
+        if (aSmallAreaWireMode == -1)
+        {
+          aSmallAreaWireMode = Standard_True;
+        }
+      }
+      aTool->Init (TopoDS::Face (aFace));
+      if (aTool->Perform())
+      {
+        myIsDone.ChangeValue (theThreadIndex) = Standard_True;
+      }
+      aTopoMode = aSavTopoMode;
+      aSmallAreaWireMode = aSavSmallAreaWireMode;
+    }
+
+  private:
+    ShapeFix_FaceFunctor& operator= (const ShapeFix_FaceFunctor&);
+
+  private:
+    const NCollection_Vector<Standard_Integer>&           myGroup;
+    const NCollection_Array1<TopoDS_Shape>&               myFaces;
+    const TColStd_MapOfInteger&                           myFreeFaces;
+    const NCollection_Array1<Handle(ShapeFix_Face)>&      myTools;
+    const NCollection_Array1<Handle(ShapeBuild_ReShape)>& myContexts;
+    NCollection_Array1<Standard_Boolean>&                 myIsDone;
+  };
+}
+
 //=======================================================================
 //function : ShapeFix_Shape
 //purpose  : 
@@ -49,6 +202,7 @@ ShapeFix_Shape::ShapeFix_Shape()
   myFixSameParameterMode = -1;
   myFixVertexPositionMode =0;
   myFixVertexTolMode = -1;
+  myIsParallel = Standard_False;
   myFixSolid = new ShapeFix_Solid;
 }
 
@@ -68,6 +222,7 @@ ShapeFix_Shape::ShapeFix_Shape(const TopoDS_Shape& shape)
   myFixSolid = new ShapeFix_Solid;
   myFixVertexPositionMode =0;
   myFixVertexTolMode = -1;
+  myIsParallel = Standard_False;
   Init(shape);
 }
 
@@ -128,10 +283,29 @@ Standard_Boolean ShapeFix_Shape::Perform(const Message_ProgressRange& theProgres
 
   st = S.ShapeType();
 
+  // In parallel mode the faces are fixed at once for the whole shape,
+  // then fixing of faces is switched off for the following stages
+  const Standard_Boolean isParallel = myIsParallel &&
+    (st == TopAbs_COMPOUND || st == TopAbs_COMPSOLID || st == TopAbs_SOLID || st == TopAbs_SHELL);
+
   // Open progress indication scope for the following fix stages:
+  // - Fix of faces in parallel mode;
   // - Fix on Solid or Shell;
   // - Fix same parameterization;
-  Message_ProgressScope aPS(theProgress, "Fixing stage", 2);
+  Message_ProgressScope aPS(theProgress, "Fixing stage", isParallel ? 3 : 2);
+
+  Standard_Integer savFixFaceMode = myFixFaceMode;
+  Standard_Integer savFixShellFaceMode = FixShellTool()->FixFaceMode();
+  if ( isParallel ) {
+    if ( FixFaces (S, aPS.Next()) )
+      status = Standard_True;
+    if ( !aPS.More() )
+      return Standard_False; // aborted execution
+
+    myIsParallel = Standard_False;
+    myFixFaceMode = Standard_False;
+    FixShellTool()->FixFaceMode() = Standard_False;
+  }
 
   switch ( st ) {
   case TopAbs_COMPOUND:  
@@ -229,6 +403,11 @@ Standard_Boolean ShapeFix_Shape::Perform(const Message_ProgressRange& theProgres
   case TopAbs_SHAPE :    
   default           : break;
   }
+  if ( isParallel ) {
+    myIsParallel = Standard_True;
+    myFixFaceMode = savFixFaceMode;
+    FixShellTool()->FixFaceMode() = savFixShellFaceMode;
+  }
   if (!aPS.More())
     return Standard_False; // aborted execution
 
@@ -271,6 +450,174 @@ Standard_Boolean ShapeFix_Shape::Perform(const Message_ProgressRange& theProgres
   return status;
 }  
 
+//=======================================================================
+//function : FixFaces
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean ShapeFix_Shape::FixFaces (const TopoDS_Shape& theShape,
+                                           const Message_ProgressRange& theProgress)
+{
+  Handle(ShapeFix_Shell) aFixShell = FixShellTool();
+  const Standard_Boolean isToFixShellFaces = NeedFix (aFixShell->FixFaceMode());
+  TopTools_MapOfShape aVisited;
+  for (TopTools_MapOfShape::Iterator anIter (myMapFixingShape); anIter.More(); anIter.Next())
+  {
+    aVisited.Add (anIter.Value());
+  }
+  TopTools_IndexedMapOfShape aFaceMap;
+  TColStd_MapOfInteger aFreeFaces;
+  collectFaces (theShape, Context(),
+                isToFixShellFaces && NeedFix (myFixSolidMode) && NeedFix (myFixSolid->FixShellMode()),
+                isToFixShellFaces && NeedFix (myFixShellMode),
+                NeedFix (myFixFaceMode),
+                aVisited, aFaceMap, aFreeFaces);
+  const Standard_Integer aNbFaces = aFaceMap.Extent();
+  if (aNbFaces == 0)
+  {
+    return Standard_False;
+  }
+
+  // Split the faces into groups so that the faces of one group have no
+  // common vertices and edges and thus can be fixed independently.
+  // Each face gets the least group not used by the preceding adjacent faces.
+  // The sub-shapes are compared without location, as the fixes modify the
+  // shared TEdge and TVertex whatever location they are used with.
+  NCollection_Array1<Standard_Integer> aFaceGroups (1, aNbFaces);
+  NCollection_Vector<NCollection_Vector<Standard_Integer> > aGroups;
+  Standard_Integer aMaxGroupSize = 0;
+  NCollection_DataMap<TopoDS_Shape, TColStd_ListOfInteger, TopTools_ShapeMapHasher> aSubShapeFaces;
+  for (Standard_Integer aFaceIt = 1; aFaceIt <= aNbFaces; ++aFaceIt)
+  {
+    TopTools_IndexedMapOfShape aSubShapes;
+    for (TopExp_Explorer anEdgeExp (aFaceMap (aFaceIt), TopAbs_EDGE); anEdgeExp.More(); anEdgeExp.Next())
+    {
+      aSubShapes.Add (anEdgeExp.Current().Located (TopLoc_Location()));
+    }
+    for (TopExp_Explorer aVertexExp (aFaceMap (aFaceIt), TopAbs_VERTEX); aVertexExp.More(); aVertexExp.Next())
+    {
+      aSubShapes.Add (aVertexExp.Current().Located (TopLoc_Location()));
+    }
+
+    TColStd_MapOfInteger aUsedGroups;
+    for (Standard_Integer aSubIt = 1; aSubIt <= aSubShapes.Extent(); ++aSubIt)
+    {
+      const TColStd_ListOfInteger* anAdjFaces = aSubShapeFaces.Seek (aSubShapes (aSubIt));
+      if (anAdjFaces == NULL)
+      {
+        continue;
+      }
+      for (TColStd_ListOfInteger::Iterator anAdjIt (*anAdjFaces); anAdjIt.More(); anAdjIt.Next())
+      {
+        aUsedGroups.Add (aFaceGroups (anAdjIt.Value()));
+      }
+    }
+    Standard_Integer aGroup = 0;
+    while (aUsedGroups.Contains (aGroup))
+    {
+      ++aGroup;
+    }
+    aFaceGroups (aFaceIt) = aGroup;
+    if (aGroup == aGroups.Length())
+    {
+      aGroups.Appended();
+    }
+    aGroups.ChangeValue (aGroup).Append (aFaceIt);
+    aMaxGroupSize = Max (aMaxGroupSize, aGroups.Value (aGroup).Length());
+
+    for (Standard_Integer aSubIt = 1; aSubIt <= aSubShapes.Extent(); ++aSubIt)
+    {
+      TColStd_ListOfInteger* anAdjFaces = aSubShapeFaces.ChangeSeek (aSubShapes (aSubIt));
+      if (anAdjFaces == NULL)
+      {
+        anAdjFaces = aSubShapeFaces.Bound (aSubShapes (aSubIt), TColStd_ListOfInteger());
+      }
+      anAdjFaces->Append (aFaceIt);
+    }
+  }
+
+  // Prepare the tools, the messages can be sent only from the single thread
+  const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+  const Standard_Integer aNbThreads = MsgRegistrator().IsNull()
+                                    ? Min (aMaxGroupSize, aThreadPool->NbDefaultThreadsToLaunch())
+                                    : 1;
+  NCollection_Array1<Handle(ShapeFix_Face)> aTools (0, aNbThreads - 1);
+  NCollection_Array1<Handle(ShapeBuild_ReShape)> aContexts (0, aNbThreads - 1);
+  NCollection_Array1<Standard_Boolean> anIsDone (0, aNbThreads - 1);
+  anIsDone.Init (Standard_False);
+  if (aNbThreads > 1)
+  {
+    for (Standard_Integer aThreadIt = 0; aThreadIt < aNbThreads; ++aThreadIt)
+    {
+      aTools (aThreadIt) = aFixShell->FixFaceTool()->Copy();
+      aContexts (aThreadIt) = new ShapeBuild_ReShape;
+      aContexts (aThreadIt)->ModeConsiderLocation() = Context()->ModeConsiderLocation();
+    }
+  }
+  else
+  {
+    aTools (0) = aFixShell->FixFaceTool();
+    aContexts (0) = Context();
+  }
+
+  NCollection_Array1<TopoDS_Shape> aFaces (1, aNbFaces);
+  Message_ProgressScope aPS (theProgress, "Fixing faces", aGroups.Length());
+  for (Standard_Integer aGroupIt = 0; aGroupIt < aGroups.Length() && aPS.More(); ++aGroupIt, aPS.Next())
+  {
+    // take into account the fixes of the faces of the previous groups
+    const NCollection_Vector<Standard_Integer>& aGroup = aGroups.Value (aGroupIt);
+    for (NCollection_Vector<Standard_Integer>::Iterator aGroupFaceIt (aGroup); aGroupFaceIt.More(); aGroupFaceIt.Next())
+    {
+      const Standard_Integer aFaceIndex = aGroupFaceIt.Value();
+      TopoDS_Shape aFace = Context()->Apply (aFaceMap (aFaceIndex));
+      if (aFace.IsNull() || aFace.ShapeType() != TopAbs_FACE)
+      {
+        aFace.Nullify();
+      }
+      aFaces (aFaceIndex) = aFace;
+    }
+
+    ShapeFix_FaceFunctor aFunctor (aGroup, aFaces, aFreeFaces, aTools, aContexts, anIsDone);
+    const Standard_Integer aNbGroupThreads = Min (aGroup.Length(), aNbThreads);
+    if (aNbGroupThreads > 1)
+    {
+      OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbGroupThreads);
+      aLauncher.Perform (0, aGroup.Length(), aFunctor);
+    }
+    else
+    {
+      for (Standard_Integer anIndex = 0; anIndex < aGroup.Length(); ++anIndex)
+      {
+        aFunctor (0, anIndex);
+      }
+    }
+
+    // merge the replacements made by the threads
+    if (aNbThreads > 1)
+    {
+      for (Standard_Integer aThreadIt = 0; aThreadIt < aNbThreads; ++aThreadIt)
+      {
+        Context()->Append (*aContexts (aThreadIt));
+        aContexts (aThreadIt)->Clear();
+      }
+    }
+  }
+  if (!aPS.More())
+  {
+    return Standard_False; // aborted execution
+  }
+
+  // restore the context of the face tool
+  aFixShell->FixFaceTool()->SetContext (Context());
+
+  Standard_Boolean isDone = Standard_False;
+  for (Standard_Integer aThreadIt = 0; aThreadIt < aNbThreads; ++aThreadIt)
+  {
+    isDone = isDone || anIsDone (aThreadIt);
+  }
+  return isDone;
+}
+
 //=======================================================================
 //function : SameParameter
 //purpose  : 
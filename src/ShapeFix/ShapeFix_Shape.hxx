@@ -129,6 +129,17 @@ public:
   //! after performing all fixes
     Standard_Integer& FixVertexTolMode();
 
+  //! Sets the flag for fixing of faces in parallel, by default False.
+  //! In parallel mode the faces of shells and solids, as well as the
+  //! free faces, are fixed by ShapeFix_Face before the fixes of shells
+  //! and solids. The faces having no common vertices and edges are
+  //! processed concurrently, each thread with its own copy of the face
+  //! tool and own context, merged into the common context afterwards.
+  //! The fixes are run in a single thread if message registrator is set.
+  void SetParallel (const Standard_Boolean theIsParallel) { myIsParallel = theIsParallel; }
+
+  //! Returns the flag for fixing of faces in parallel.
+  Standard_Boolean IsParallel() const { return myIsParallel; }
 
 
 
@@ -143,6 +154,12 @@ protected:
   Standard_EXPORT void SameParameter (const TopoDS_Shape& shape, const Standard_Boolean enforce,
                                       const Message_ProgressRange& theProgress = Message_ProgressRange());
 
+  //! Fixes the faces of the passed shape (faces of shells and solids
+  //! and free faces, as defined by the modes) in parallel.
+  //! Returns True if some face has been fixed.
+  Standard_EXPORT Standard_Boolean FixFaces (const TopoDS_Shape& theShape,
+                                             const Message_ProgressRange& theProgress = Message_ProgressRange());
+
   TopoDS_Shape myResult;
   Handle(ShapeFix_Solid) myFixSolid;
   TopTools_MapOfShape myMapFixingShape;
@@ -154,6 +171,7 @@ protected:
   Standard_Integer myFixVertexPositionMode;
   Standard_Integer myFixVertexTolMode;
   Standard_Integer myStatus;
+  Standard_Boolean myIsParallel;
 
 
 private:
@@ -97,6 +97,11 @@ public:
   //! Create new object with default flags and prepare it for use
   //! (Loads analyzer with all the data for the wire and face)
   Standard_EXPORT ShapeFix_Wire(const TopoDS_Wire& wire, const TopoDS_Face& face, const Standard_Real prec);
+
+  //! Returns the copy of the tool with the same modes and parameters
+  //! and its own analyzer and tool for fixing edges, which can be used
+  //! in another thread. The wire should be loaded into the copy anew.
+  Standard_EXPORT virtual Handle(ShapeFix_Wire) Copy() const;
   
   //! Sets all modes to default
   Standard_EXPORT void ClearModes();
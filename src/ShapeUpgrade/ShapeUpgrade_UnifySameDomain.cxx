@@ -43,11 +43,14 @@
 #include <GeomConvert.hxx>
 #include <GeomConvert_ApproxSurface.hxx>
 #include <GeomConvert_CompCurveToBSplineCurve.hxx>
+#include <GeomAdaptor_Surface.hxx>
 #include <GeomLib_IsPlanarSurface.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Lin.hxx>
 #include <IntPatch_ImpImpIntersection.hxx>
+#include <NCollection_Vector.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <ShapeAnalysis_Edge.hxx>
 #include <ShapeAnalysis_WireOrder.hxx>
 #include <ShapeAnalysis_Surface.hxx>
@@ -65,6 +68,7 @@
 #include <TColGeom_HArray1OfBSplineCurve.hxx>
 #include <TColGeom_SequenceOfSurface.hxx>
 #include <TColStd_Array1OfReal.hxx>
+#include <TColStd_ListOfInteger.hxx>
 #include <TColStd_MapOfInteger.hxx>
 #include <TColStd_SequenceOfBoolean.hxx>
 #include <TopExp.hxx>
@@ -1270,63 +1274,76 @@ static Standard_Boolean GetNormalToSurface(const TopoDS_Face& theFace,
   return Standard_True;
 }
 
+namespace
+{
+  //! Data of the surface of the face used to compare it with the surfaces of other faces.
+  struct FaceSurfaceData
+  {
+    Handle(Geom_Surface) Surface;  //!< located surface of the face without trimming
+    GeomAbs_SurfaceType  Type;     //!< type of elementary surface, GeomAbs_OtherSurface for others
+    Standard_Boolean     IsPlanar; //!< the surface is planar with the linear tolerance
+    gp_Pln               Plane;    //!< the plane of planar surface
+    Standard_Boolean     IsDone;   //!< the data is computed
+
+    FaceSurfaceData()
+    : Type (GeomAbs_OtherSurface),
+      IsPlanar (Standard_False),
+      IsDone (Standard_False)
+    {}
+  };
+
+  //! Result of comparison of the surfaces of two faces.
+  enum SurfacesState
+  {
+    SurfacesState_Different, //!< the faces are not lying on the same surface
+    SurfacesState_Same,      //!< the faces are lying on the same surface
+    SurfacesState_SamePlane  //!< the faces are lying on the same plane
+  };
+}
+
 //=======================================================================
-//function : IsSameDomain
+//function : ComputeSurfaceData
 //purpose  : 
 //=======================================================================
-static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
-                                     const TopoDS_Face& aCheckedFace,
-                                     const Standard_Real theLinTol,
-                                     const Standard_Real theAngTol,
-                                     ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane& theFacePlaneMap)
+static void ComputeSurfaceData(const TopoDS_Face& theFace,
+                               const Standard_Real theLinTol,
+                               FaceSurfaceData& theData)
 {
-  //checking the same handles
-  TopLoc_Location L1, L2;
-  Handle(Geom_Surface) S1, S2;
+  theData.Surface = ClearRts(BRep_Tool::Surface(theFace));
 
-  S1 = BRep_Tool::Surface(aFace,L1);
-  S2 = BRep_Tool::Surface(aCheckedFace,L2);
+  // all kinds of surfaces are checked for planarity, including b-spline and bezier
+  GeomLib_IsPlanarSurface aPlanarityChecker(theData.Surface, theLinTol);
+  theData.IsPlanar = aPlanarityChecker.IsPlanar();
+  if (theData.IsPlanar)
+    theData.Plane = aPlanarityChecker.Plan();
 
-  if (S1 == S2 && L1 == L2)
-    return Standard_True;
+  if (theData.Surface->IsKind(STANDARD_TYPE(Geom_ElementarySurface)))
+    theData.Type = GeomAdaptor_Surface(theData.Surface).GetType();
 
-  S1 = BRep_Tool::Surface(aFace);
-  S2 = BRep_Tool::Surface(aCheckedFace);
-
-  S1 = ClearRts(S1);
-  S2 = ClearRts(S2);
-
-  //Handle(Geom_OffsetSurface) aGOFS1, aGOFS2;
-  //aGOFS1 = Handle(Geom_OffsetSurface)::DownCast(S1);
-  //aGOFS2 = Handle(Geom_OffsetSurface)::DownCast(S2);
-  //if (!aGOFS1.IsNull()) S1 = aGOFS1->BasisSurface();
-  //if (!aGOFS2.IsNull()) S2 = aGOFS2->BasisSurface();
-
-  // case of two planar surfaces:
-  // all kinds of surfaces checked, including b-spline and bezier
-  GeomLib_IsPlanarSurface aPlanarityChecker1(S1, theLinTol);
-  if (aPlanarityChecker1.IsPlanar()) {
-    GeomLib_IsPlanarSurface aPlanarityChecker2(S2, theLinTol);
-    if (aPlanarityChecker2.IsPlanar()) {
-      gp_Pln aPln1 = aPlanarityChecker1.Plan();
-      gp_Pln aPln2 = aPlanarityChecker2.Plan();
-
-      if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol) &&
-        aPln1.Distance(aPln2) < theLinTol)
-      {
-        Handle(Geom_Plane) aPlaneOfFaces;
-        if (theFacePlaneMap.IsBound(aFace))
-          aPlaneOfFaces = theFacePlaneMap(aFace);
-        else if (theFacePlaneMap.IsBound(aCheckedFace))
-          aPlaneOfFaces = theFacePlaneMap(aCheckedFace);
-        else
-          aPlaneOfFaces = new Geom_Plane(aPln1);
+  theData.IsDone = Standard_True;
+}
 
-        theFacePlaneMap.Bind(aFace, aPlaneOfFaces);
-        theFacePlaneMap.Bind(aCheckedFace, aPlaneOfFaces);
-        
-        return Standard_True;
-      }
+//=======================================================================
+//function : CompareSurfaces
+//purpose  : 
+//=======================================================================
+static SurfacesState CompareSurfaces(const FaceSurfaceData& theData1,
+                                     const FaceSurfaceData& theData2,
+                                     const Standard_Real theLinTol,
+                                     const Standard_Real theAngTol)
+{
+  Handle(Geom_Surface) S1 = theData1.Surface;
+  Handle(Geom_Surface) S2 = theData2.Surface;
+
+  // case of two planar surfaces
+  if (theData1.IsPlanar && theData2.IsPlanar) {
+    const gp_Pln& aPln1 = theData1.Plane;
+    const gp_Pln& aPln2 = theData2.Plane;
+
+    if (aPln1.Position().Direction().IsParallel(aPln2.Position().Direction(), theAngTol) &&
+      aPln1.Distance(aPln2) < theLinTol)
+    {
+      return SurfacesState_SamePlane;
     }
   }
 
@@ -1336,6 +1353,10 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
   if (S1->IsKind(STANDARD_TYPE(Geom_ElementarySurface)) &&
       S2->IsKind(STANDARD_TYPE(Geom_ElementarySurface)))
   {
+    // the tangent faces are reported for the surfaces of the same type only
+    if (theData1.Type != theData2.Type)
+      return SurfacesState_Different;
+
     Handle(GeomAdaptor_Surface) aGA1 = new GeomAdaptor_Surface(S1);
     Handle(GeomAdaptor_Surface) aGA2 = new GeomAdaptor_Surface(S2);
 
@@ -1345,12 +1366,12 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
     try {
       IntPatch_ImpImpIntersection anIIInt(aGA1, aTT1, aGA2, aTT2, theLinTol, theLinTol);
       if (!anIIInt.IsDone() || anIIInt.IsEmpty())
-        return Standard_False;
+        return SurfacesState_Different;
 
-      return anIIInt.TangentFaces();
+      return anIIInt.TangentFaces() ? SurfacesState_Same : SurfacesState_Different;
     }
     catch (Standard_Failure const&) {
-      return Standard_False;
+      return SurfacesState_Different;
     }
   }
 
@@ -1372,14 +1393,205 @@ static Standard_Boolean IsSameDomain(const TopoDS_Face& aFace,
           gp_Vec aVec12 (aLoc1, aLoc2);
           if (aVec12.SquareMagnitude() < theLinTol*theLinTol ||
               aVec12.IsParallel(aDir1, Precision::Angular())) {
-            return Standard_True;
+            return SurfacesState_Same;
           }
         }
       }
     }
   }
 
-  return Standard_False;
+  return SurfacesState_Different;
+}
+
+namespace
+{
+  //! Compares the surfaces of the faces of the shape.
+  //! The data of the surface of each face (its planarity and type) is computed
+  //! once and reused by all comparisons of the face. In parallel mode the data
+  //! of all faces and the comparisons of the pairs of faces given in advance
+  //! are computed in parallel threads; the other pairs are compared on demand.
+  class FacesComparator
+  {
+  public:
+
+    FacesComparator (const TopoDS_Shape& theShape,
+                     const Standard_Real theLinTol,
+                     const Standard_Real theAngTol)
+    : myLinTol (theLinTol),
+      myAngTol (theAngTol)
+    {
+      TopExp::MapShapes (theShape, TopAbs_FACE, myFaces);
+      myData.Resize (1, Max (myFaces.Extent(), 1), Standard_False);
+      myFacePairs.Resize (1, Max (myFaces.Extent(), 1), Standard_False);
+    }
+
+    //! Adds the pair of faces of the shape to be compared in advance.
+    //! The pair is not ordered, i.e. the pairs (F1, F2) and (F2, F1) are compared once.
+    void AddPair (const TopoDS_Shape& theFace1,
+                  const TopoDS_Shape& theFace2)
+    {
+      const Standard_Integer anIndexF1 = myFaces.FindIndex (theFace1);
+      const Standard_Integer anIndexF2 = myFaces.FindIndex (theFace2);
+      const Standard_Integer anIndex1 = Min (anIndexF1, anIndexF2);
+      const Standard_Integer anIndex2 = Max (anIndexF1, anIndexF2);
+      if (anIndex1 == 0 || anIndex1 == anIndex2 || findPair (anIndex1, anIndex2))
+        return;
+
+      myFacePairs (anIndex1).Append (myPairs.Length());
+      Pair& aPair = myPairs.Appended();
+      aPair.Face1 = anIndex1;
+      aPair.Face2 = anIndex2;
+      aPair.State = SurfacesState_Different;
+    }
+
+    //! Computes the data of all faces and compares the added pairs of faces in parallel.
+    void Perform()
+    {
+      if (myPairs.IsEmpty())
+        return;
+
+      const Handle(OSD_ThreadPool)& aThreadPool = OSD_ThreadPool::DefaultPool();
+      {
+        SurfaceDataFunctor aFunctor (*this);
+        const Standard_Integer aNbThreads = Min (myFaces.Extent(), aThreadPool->NbDefaultThreadsToLaunch());
+        OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+        aLauncher.Perform (1, myFaces.Extent() + 1, aFunctor);
+      }
+      {
+        ComparisonFunctor aFunctor (*this);
+        const Standard_Integer aNbThreads = Min (myPairs.Length(), aThreadPool->NbDefaultThreadsToLaunch());
+        OSD_ThreadPool::Launcher aLauncher (*aThreadPool, aNbThreads);
+        aLauncher.Perform (0, myPairs.Length(), aFunctor);
+      }
+    }
+
+    //! Returns true if the faces are lying on the same surface.
+    //! The common plane of the faces lying on the same plane is bound to both faces in the map.
+    Standard_Boolean IsSameDomain (const TopoDS_Face& aFace,
+                                   const TopoDS_Face& aCheckedFace,
+                                   ShapeUpgrade_UnifySameDomain::DataMapOfFacePlane& theFacePlaneMap)
+    {
+      //checking the same handles
+      TopLoc_Location L1, L2;
+      const Handle(Geom_Surface)& S1 = BRep_Tool::Surface(aFace,L1);
+      const Handle(Geom_Surface)& S2 = BRep_Tool::Surface(aCheckedFace,L2);
+
+      if (S1 == S2 && L1 == L2)
+        return Standard_True;
+
+      const Standard_Integer anIndex1 = myFaces.FindIndex (aFace);
+      const Standard_Integer anIndex2 = myFaces.FindIndex (aCheckedFace);
+      // the surfaces are compared in the order of the pairs compared in advance
+      // to get the same result in both modes
+      const Standard_Integer aMinIndex = Min (anIndex1, anIndex2);
+      const Standard_Integer aMaxIndex = Max (anIndex1, anIndex2);
+      const Pair* aPair = findPair (aMinIndex, aMaxIndex);
+      const SurfacesState aState = aPair ? aPair->State :
+        CompareSurfaces (surfaceData (aMinIndex), surfaceData (aMaxIndex), myLinTol, myAngTol);
+
+      if (aState == SurfacesState_SamePlane)
+      {
+        Handle(Geom_Plane) aPlaneOfFaces;
+        if (theFacePlaneMap.IsBound(aFace))
+          aPlaneOfFaces = theFacePlaneMap(aFace);
+        else if (theFacePlaneMap.IsBound(aCheckedFace))
+          aPlaneOfFaces = theFacePlaneMap(aCheckedFace);
+        else
+          aPlaneOfFaces = new Geom_Plane(surfaceData (anIndex1).Plane);
+
+        theFacePlaneMap.Bind(aFace, aPlaneOfFaces);
+        theFacePlaneMap.Bind(aCheckedFace, aPlaneOfFaces);
+      }
+      return aState != SurfacesState_Different;
+    }
+
+  private:
+
+    //! Pair of faces compared in advance.
+    struct Pair
+    {
+      Standard_Integer Face1;
+      Standard_Integer Face2;
+      SurfacesState    State;
+    };
+
+    //! Functor for parallel computation of the data of the faces.
+    class SurfaceDataFunctor
+    {
+    public:
+      SurfaceDataFunctor (FacesComparator& theComparator)
+      : myComparator (theComparator)
+      {}
+
+      void operator() (Standard_Integer /*theThreadIndex*/, Standard_Integer theIndex) const
+      {
+        myComparator.surfaceData (theIndex);
+      }
+
+    private:
+      SurfaceDataFunctor& operator= (const SurfaceDataFunctor&) Standard_DELETE;
+
+    private:
+      FacesComparator& myComparator;
+    };
+
+    //! Functor for parallel comparison of the pairs of faces.
+    class ComparisonFunctor
+    {
+    public:
+      ComparisonFunctor (FacesComparator& theComparator)
+      : myComparator (theComparator)
+      {}
+
+      void operator() (Standard_Integer /*theThreadIndex*/, Standard_Integer theIndex) const
+      {
+        Pair& aPair = myComparator.myPairs.ChangeValue (theIndex);
+        aPair.State = CompareSurfaces (myComparator.myData (aPair.Face1),
+                                       myComparator.myData (aPair.Face2),
+                                       myComparator.myLinTol, myComparator.myAngTol);
+      }
+
+    private:
+      ComparisonFunctor& operator= (const ComparisonFunctor&) Standard_DELETE;
+
+    private:
+      FacesComparator& myComparator;
+    };
+
+  private:
+
+    //! Returns the data of the face with the given index, computes it on first call.
+    const FaceSurfaceData& surfaceData (const Standard_Integer theIndex)
+    {
+      FaceSurfaceData& aData = myData.ChangeValue (theIndex);
+      if (!aData.IsDone)
+        ComputeSurfaceData (TopoDS::Face (myFaces (theIndex)), myLinTol, aData);
+      return aData;
+    }
+
+    //! Returns the pair of faces compared in advance or NULL.
+    //! The indices of the faces are expected in ascending order.
+    const Pair* findPair (const Standard_Integer theIndex1,
+                          const Standard_Integer theIndex2) const
+    {
+      TColStd_ListIteratorOfListOfInteger anIt (myFacePairs (theIndex1));
+      for (; anIt.More(); anIt.Next())
+      {
+        const Pair& aPair = myPairs (anIt.Value());
+        if (aPair.Face2 == theIndex2)
+          return &aPair;
+      }
+      return NULL;
+    }
+
+  private:
+    TopTools_IndexedMapOfShape                 myFaces;
+    NCollection_Array1<FaceSurfaceData>        myData;
+    NCollection_Array1<TColStd_ListOfInteger>  myFacePairs; //!< indices of pairs by the lower index of their faces
+    NCollection_Vector<Pair>                   myPairs;
+    Standard_Real                              myLinTol;
+    Standard_Real                              myAngTol;
+  };
 }
 
 //=======================================================================
@@ -2554,6 +2766,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain()
     myConcatBSplines (Standard_False),
     myAllowInternal (Standard_False),
     mySafeInputMode(Standard_True),
+    myIsParallel(Standard_False),
     myHistory(new BRepTools_History)
 {
   myContext = new ShapeBuild_ReShape;
@@ -2576,6 +2789,7 @@ ShapeUpgrade_UnifySameDomain::ShapeUpgrade_UnifySameDomain(const TopoDS_Shape& a
     myConcatBSplines (ConcatBSplines),
     myAllowInternal (Standard_False),
     mySafeInputMode (Standard_True),
+    myIsParallel (Standard_False),
     myShape (aShape),
     myHistory(new BRepTools_History)
 {
@@ -2733,6 +2947,53 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
   TopTools_IndexedDataMapOfShapeListOfShape aMapEdgeFaces;
   TopExp::MapShapesAndAncestors(theInpShape, TopAbs_EDGE, TopAbs_FACE, aMapEdgeFaces);
 
+  // tool comparing the surfaces of the faces
+  FacesComparator aFacesComparator(theInpShape, myLinTol, myAngTol);
+  if (myIsParallel && OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch() > 1)
+  {
+    // compare in advance the adjacent faces which may be unified
+    for (Standard_Integer i = 1; i <= aMapEdgeFaces.Extent(); i++) {
+      const TopoDS_Edge& edge = TopoDS::Edge(aMapEdgeFaces.FindKey(i));
+      if (BRep_Tool::Degenerated(edge))
+        continue;
+
+      const TopTools_ListOfShape& aGList = theGMapEdgeFaces.FindFromKey(edge);
+      if (!myAllowInternal &&
+          (aGList.Extent() != 2 || myKeepShapes.Contains(edge) || theFreeBoundMap.Contains(edge)))
+        continue;
+
+      const TopTools_ListOfShape& aList = aMapEdgeFaces(i);
+      if (aList.Extent() < 2)
+        continue;
+
+      Standard_Real f, l;
+      BRep_Tool::Range(edge, f, l);
+      Standard_Real aTMid = (f + l) * .5;
+
+      TopTools_ListIteratorOfListOfShape anIter1(aList);
+      for (; anIter1.More(); anIter1.Next()) {
+        const TopoDS_Face& aFace1 = TopoDS::Face(anIter1.Value());
+        gp_Dir aDN1;
+        Standard_Boolean bCheckNormals = GetNormalToSurface(aFace1, edge, aTMid, aDN1);
+        // each unordered pair of faces is visited once
+        TopTools_ListIteratorOfListOfShape anIter2 = anIter1;
+        for (anIter2.Next(); anIter2.More(); anIter2.Next()) {
+          const TopoDS_Face& aFace2 = TopoDS::Face(anIter2.Value());
+          if (aFace2.IsSame(aFace1))
+            continue;
+
+          gp_Dir aDN2;
+          if (bCheckNormals && GetNormalToSurface(aFace2, edge, aTMid, aDN2) &&
+              aDN1.Angle(aDN2) > myAngTol)
+            continue;
+
+          aFacesComparator.AddPair(aFace1, aFace2);
+        }
+      }
+    }
+    aFacesComparator.Perform();
+  }
+
   // map of processed shapes
   TopTools_MapOfShape aProcessed;
 
@@ -2835,7 +3096,7 @@ void ShapeUpgrade_UnifySameDomain::IntUnifyFaces(const TopoDS_Shape& theInpShape
           }
         }
         //
-        if (IsSameDomain(aFace,aCheckedFace, myLinTol, myAngTol, myFacePlaneMap)) {
+        if (aFacesComparator.IsSameDomain(aFace, aCheckedFace, myFacePlaneMap)) {
 
           if (AddOrdinaryEdges(edges, aCheckedFace, dummy, RemovedEdges)) {
             // sequence edges is modified
@@ -130,6 +130,22 @@ public:
     myAngTol = (theValue < Precision::Angular() ? Precision::Angular() : theValue);
   }
 
+  //! Sets the flag for comparison of the surfaces of the faces in parallel.
+  //! The data of the surfaces of all faces and the comparisons of the adjacent
+  //! faces are computed in advance in parallel threads, while the faces are
+  //! grouped and merged sequentially, thus the result and the history are the
+  //! same as in sequential mode. Default value is false.
+  void SetParallel(const Standard_Boolean theIsParallel)
+  {
+    myIsParallel = theIsParallel;
+  }
+
+  //! Returns the flag for comparison of the surfaces of the faces in parallel.
+  Standard_Boolean IsParallel() const
+  {
+    return myIsParallel;
+  }
+
   //! Performs unification and builds the resulting shape.
   Standard_EXPORT void Build();
   
@@ -215,6 +231,7 @@ private:
   Standard_Boolean myConcatBSplines;
   Standard_Boolean myAllowInternal;
   Standard_Boolean mySafeInputMode;
+  Standard_Boolean myIsParallel;
   TopoDS_Shape myShape;
   Handle(ShapeBuild_ReShape) myContext;
   TopTools_MapOfShape myKeepShapes;
@@ -20,6 +20,7 @@
 #include <Standard.hxx>
 #include <Standard_Type.hxx>
 #include <Resource_FormatType.hxx>
+#include <Standard_Mutex.hxx>
 
 #include <Interface_IndexedMapOfAsciiString.hxx>
 #include <TColStd_DataMapOfIntegerInteger.hxx>
@@ -366,6 +367,7 @@ private:
   Standard_Integer thenbscop;
   Handle(Interface_Check) thecheck;
   Resource_FormatType mySourceCodePage;
+  mutable Standard_Mutex myMutex; //!< protects global check when records are read by several threads
 
 
 };
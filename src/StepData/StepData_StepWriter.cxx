@@ -20,6 +20,7 @@
 #include <Interface_InterfaceMismatch.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_ReportEntity.hxx>
+#include <OSD_Parallel.hxx>
 #include <Standard_Transient.hxx>
 #include <StepData_ESDescr.hxx>
 #include <StepData_FieldList.hxx>
@@ -36,6 +37,7 @@
 #include <TCollection_HAsciiString.hxx>
 
 #include <stdio.h>
+#include <vector>
 #define StepLong 72
 // StepLong : longueur maxi d une ligne de fichier Step
 
@@ -163,6 +165,139 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
 {
   StepData_WriterLib lib(protocol);
 
+  sendHeader (lib, headeronly);
+  if (headeronly) return;
+
+//  Data : Comme Header mais avec des Idents ... sinon le code est le meme
+  SendData();
+  sendGlobalChecks();
+
+//  ....                Sortie des Entites une par une                ....
+
+  Standard_Integer nb = themodel->NbEntities();
+  for (Standard_Integer i = 1 ; i <= nb; i ++) {
+//    Liste principale : on n envoie pas les Entites dans un Scope
+//    Elles le seront par l intermediaire du Scope qui les contient
+    if (!thescopebeg.IsNull()) {  if (thescopenext->Value(i) != 0) continue;  }
+    SendEntity (i,lib);
+  }
+
+  EndSec();
+  EndFile();
+}
+
+
+namespace
+{
+  //! Number of entities sent to the stream at once
+  const Standard_Integer THE_STREAM_BLOCK_SIZE = 4096;
+
+  //! Number of entities formatted by one task in parallel mode
+  const Standard_Integer THE_STREAM_CHUNK_SIZE = 256;
+
+  //! Functor formatting a chunk of entities of a block by its own writer
+  class StepData_SendEntitiesFunctor
+  {
+  public:
+    StepData_SendEntitiesFunctor (std::vector<StepData_StepWriter>& theWriters,
+                                  const StepData_WriterLib& theLib,
+                                  const Handle(TColStd_HArray1OfInteger)& theScopeNext,
+                                  const Standard_Integer theFirst,
+                                  const Standard_Integer theLast)
+    : myWriters (theWriters), myLib (theLib), myScopeNext (theScopeNext),
+      myFirst (theFirst), myLast (theLast) {}
+
+    void operator() (const Standard_Integer theChunk) const
+    {
+      const Standard_Integer aFirst = myFirst + theChunk * THE_STREAM_CHUNK_SIZE;
+      const Standard_Integer aLast  = Min (aFirst + THE_STREAM_CHUNK_SIZE - 1, myLast);
+      StepData_StepWriter& aWriter = myWriters[theChunk];
+      for (Standard_Integer i = aFirst; i <= aLast; i ++) {
+        if (!myScopeNext.IsNull() && myScopeNext->Value(i) != 0) continue;
+        aWriter.SendEntity (i, myLib);
+      }
+    }
+
+  private:
+    std::vector<StepData_StepWriter>& myWriters;
+    const StepData_WriterLib& myLib;
+    Handle(TColStd_HArray1OfInteger) myScopeNext;
+    Standard_Integer myFirst;
+    Standard_Integer myLast;
+  };
+}
+
+//=======================================================================
+//function : SendModel
+//purpose  : 
+//=======================================================================
+
+Standard_Boolean StepData_StepWriter::SendModel (const Handle(StepData_Protocol)& protocol,
+                                                 Standard_OStream& S,
+                                                 const Standard_Boolean theIsParallel)
+{
+  StepData_WriterLib lib(protocol);
+
+  sendHeader (lib, Standard_False);
+  SendData();
+  sendGlobalChecks();
+  flushLines (S);
+
+//  Entities are sent by blocks : the text of a block is written then forgotten
+  const Standard_Integer nb = themodel->NbEntities();
+  const Standard_Boolean isParallel = theIsParallel && nb > THE_STREAM_CHUNK_SIZE;
+  for (Standard_Integer first = 1; first <= nb && S.good(); first += THE_STREAM_BLOCK_SIZE) {
+    const Standard_Integer last = Min (first + THE_STREAM_BLOCK_SIZE - 1, nb);
+    if (!isParallel) {
+      for (Standard_Integer i = first; i <= last; i ++) {
+        if (!thescopebeg.IsNull()) {  if (thescopenext->Value(i) != 0) continue;  }
+        SendEntity (i,lib);
+      }
+      flushLines (S);
+      continue;
+    }
+
+//  Each chunk of the block is formatted by a separate writer with the same settings,
+//  the text of an entity does not depend on the entities sent before it
+    const Standard_Integer nbChunks = (last - first) / THE_STREAM_CHUNK_SIZE + 1;
+    std::vector<StepData_StepWriter> aWriters;
+    aWriters.reserve (nbChunks);
+    for (Standard_Integer ichunk = 0; ichunk < nbChunks; ichunk ++) {
+      aWriters.push_back (StepData_StepWriter (themodel));
+      StepData_StepWriter& aWriter = aWriters.back();
+      aWriter.thelabmode   = thelabmode;
+      aWriter.thetypmode   = thetypmode;
+      aWriter.thefloatw    = thefloatw;
+      aWriter.theindent    = theindent;
+      aWriter.thesect      = thesect;
+      aWriter.thescopebeg  = thescopebeg;
+      aWriter.thescopeend  = thescopeend;
+      aWriter.thescopenext = thescopenext;
+    }
+    StepData_SendEntitiesFunctor aFunctor (aWriters, lib, thescopenext, first, last);
+    OSD_Parallel::For (0, nbChunks, aFunctor);
+    for (Standard_Integer ichunk = 0; ichunk < nbChunks; ichunk ++) {
+      aWriters[ichunk].flushLines (S);
+      thechecks.Merge (aWriters[ichunk].thechecks);
+    }
+  }
+
+  EndSec();
+  EndFile();
+  flushLines (S);
+  S << std::flush;
+  return S.good();
+}
+
+
+//=======================================================================
+//function : sendHeader
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::sendHeader (const StepData_WriterLib& lib,
+                                      const Standard_Boolean headeronly)
+{
   if (!headeronly)
     thefile->Append (new TCollection_HAsciiString("ISO-10303-21;"));
   SendHeader();
@@ -197,11 +332,16 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
     EndEntity ();
   }
   EndSec();
-  if (headeronly) return;
+}
 
-//  Data : Comme Header mais avec des Idents ... sinon le code est le meme
-  SendData();
 
+//=======================================================================
+//function : sendGlobalChecks
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::sendGlobalChecks ()
+{
 // ....                    Erreurs Globales (silya)                    ....
 
   Handle(Interface_Check) achglob = themodel->GlobalCheck();
@@ -215,19 +355,6 @@ void StepData_StepWriter::SendModel(const Handle(StepData_Protocol)& protocol,
     Comment(Standard_False);
     NewLine(Standard_False);
   }
-
-//  ....                Sortie des Entites une par une                ....
-
-  Standard_Integer nb = themodel->NbEntities();
-  for (Standard_Integer i = 1 ; i <= nb; i ++) {
-//    Liste principale : on n envoie pas les Entites dans un Scope
-//    Elles le seront par l intermediaire du Scope qui les contient
-    if (!thescopebeg.IsNull()) {  if (thescopenext->Value(i) != 0) continue;  }
-    SendEntity (i,lib);
-  }
-
-  EndSec();
-  EndFile();
 }
 
 
@@ -1155,3 +1282,17 @@ Standard_Boolean StepData_StepWriter::Print (Standard_OStream& S)
   return  isGood;
   
 }
+
+
+//=======================================================================
+//function : flushLines
+//purpose  : 
+//=======================================================================
+
+void StepData_StepWriter::flushLines (Standard_OStream& S)
+{
+  Standard_Integer nb = thefile->Length();
+  for (Standard_Integer i = 1; i <= nb && S.good(); i ++)
+    S << thefile->Value(i)->ToCString() << "\n";
+  thefile->Clear();
+}
@@ -97,6 +97,17 @@ public:
   //! (used to Dump the Header of a StepModel)
   Standard_EXPORT void SendModel (const Handle(StepData_Protocol)& protocol, const Standard_Boolean headeronly = Standard_False);
   
+  //! Sends the complete Model as above, but writes the text to the
+  //! stream <S> progressively, by blocks of entities, instead of
+  //! keeping the whole file in memory (lines already recorded, for
+  //! instance by file modifiers, are written first).
+  //! If <theIsParallel> is True, the entities of a block are formatted
+  //! by several threads; the text is the same as in sequential mode.
+  //! Returns True if the stream is still good after writing
+  Standard_EXPORT Standard_Boolean SendModel (const Handle(StepData_Protocol)& protocol,
+                                              Standard_OStream& S,
+                                              const Standard_Boolean theIsParallel = Standard_False);
+  
   //! Begins model header
   Standard_EXPORT void SendHeader();
   
@@ -278,6 +289,15 @@ protected:
 
 private:
 
+  //! sends the Header section (preceded by the file start if
+  //! <headeronly> is False), common to both forms of SendModel
+  Standard_EXPORT void sendHeader (const StepData_WriterLib& lib, const Standard_Boolean headeronly);
+
+  //! sends global fail messages recorded at read time, if any
+  Standard_EXPORT void sendGlobalChecks();
+
+  //! writes recorded lines on the stream <S> and forgets them
+  Standard_EXPORT void flushLines (Standard_OStream& S);
   
   //! adds a string to current line; first flushes it if full
   //! (72 char); more allows to ask a reserve at end of line : flush
@@ -22,6 +22,7 @@
 #include <Interface_InterfaceError.hxx>
 #include <Interface_ParamType.hxx>
 #include <Interface_Protocol.hxx>
+#include <Interface_Static.hxx>
 
 #include <StepData_FileRecognizer.hxx>
 #include <StepData_Protocol.hxx>
@@ -36,12 +37,29 @@
 #include <Message_Messenger.hxx>
 
 #include <OSD_FileSystem.hxx>
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
 #include <OSD_Timer.hxx>
 
 #include "step.tab.hxx"
 
+#include <TCollection_ExtendedString.hxx>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include <stdio.h>
 
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
 #ifdef OCCT_DEBUG
 #define CHRONOMESURE
 #endif
@@ -55,6 +73,481 @@ void StepFile_Interrupt(Standard_CString theErrorMessage, const Standard_Boolean
   sout << "**** ERR StepFile : " << theErrorMessage << "    ****" << std::endl;
 }
 
+namespace
+{
+  //! Synthetic header and trailer used to make a standalone Part 21 text
+  //! from a piece of the DATA section.
+  static const char THE_CHUNK_PREFIX[] = "ISO-10303-21;\nHEADER;\nENDSEC;\nDATA;\n";
+  static const char THE_CHUNK_SUFFIX[] = "\nENDSEC;\nEND-ISO-10303-21;\n";
+
+  //! Returns minimal size of the DATA section piece processed by one thread
+  //! (parameter "read.step.parallel.chunk", in kilobytes; 1 MB when not defined).
+  static size_t minChunkSize()
+  {
+    const Standard_Integer aSizeKb = Interface_Static::IsPresent ("read.step.parallel.chunk")
+                                   ? Interface_Static::IVal ("read.step.parallel.chunk")
+                                   : 1024;
+    return (size_t )Max (aSizeKb, 1) * 1024;
+  }
+
+  //! Read-only stream buffer presenting a sequence of memory blocks
+  //! as one contiguous input (no data is copied).
+  class StepFile_BlocksBuffer : public std::streambuf
+  {
+  public:
+
+    StepFile_BlocksBuffer() : myCurrent (0) {}
+
+    //! Appends memory block to the end of the input.
+    void Append (const char* theData, const size_t theSize)
+    {
+      if (theSize > 0)
+      {
+        myBlocks.push_back (std::make_pair (theData, theSize));
+      }
+    }
+
+  protected:
+
+    virtual int_type underflow() Standard_OVERRIDE
+    {
+      if (gptr() < egptr())
+      {
+        return traits_type::to_int_type (*gptr());
+      }
+      if (myCurrent >= myBlocks.size())
+      {
+        return traits_type::eof();
+      }
+      char* aData = const_cast<char*> (myBlocks[myCurrent].first);
+      setg (aData, aData, aData + myBlocks[myCurrent].second);
+      ++myCurrent;
+      return traits_type::to_int_type (*gptr());
+    }
+
+  private:
+    std::vector< std::pair<const char*, size_t> > myBlocks;
+    size_t myCurrent;
+  };
+
+  //! Checks that the text ending at position theEnd (excluded) is the keyword theKey
+  //! (case insensitive) not preceded by other identifier characters.
+  static Standard_Boolean isKeyword (const char* theBuf,
+                                     const size_t theEnd,
+                                     const char* theKey)
+  {
+    const size_t aLen = strlen (theKey);
+    if (theEnd < aLen)
+    {
+      return Standard_False;
+    }
+    const size_t aStart = theEnd - aLen;
+    for (size_t anIter = 0; anIter < aLen; ++anIter)
+    {
+      if (toupper ((unsigned char )theBuf[aStart + anIter]) != theKey[anIter])
+      {
+        return Standard_False;
+      }
+    }
+    if (aStart == 0)
+    {
+      return Standard_True;
+    }
+    const char aPrev = theBuf[aStart - 1];
+    return !(isalnum ((unsigned char )aPrev) || aPrev == '_' || aPrev == '!' || aPrev == '-');
+  }
+
+  //! Computes offsets splitting the DATA section of STEP text into (up to) theNbChunks
+  //! parts at entity boundaries, i.e. at "#n=" starting a new entity after ';'.
+  //! The scan follows the lexical rules of step.lex for comments and quoted strings,
+  //! so that separators inside them are ignored.
+  //! @param theBuf    [in]  STEP text
+  //! @param theSize   [in]  size of the text
+  //! @param theNbChunks [in] requested number of parts
+  //! @param theBounds [out] offsets of the beginning of 2nd, 3rd, ... parts
+  //! @return FALSE if text cannot be split safely (no complete DATA section, scopes, syntax problems)
+  static Standard_Boolean splitDataSection (const char* theBuf,
+                                            const size_t theSize,
+                                            const Standard_Integer theNbChunks,
+                                            std::vector<size_t>& theBounds)
+  {
+    enum { ScanState_Code, ScanState_Text, ScanState_Comment } aState = ScanState_Code;
+    Standard_Integer aDepth = 0;
+    Standard_Boolean isInData = Standard_False, isPending = Standard_False;
+    size_t aDataStart = 0, aTarget = 0;
+    theBounds.clear();
+    for (size_t aPos = 0; aPos < theSize; ++aPos)
+    {
+      const char aChar = theBuf[aPos];
+      if (aState == ScanState_Comment)
+      {
+        if (aChar == '*' && aPos + 1 < theSize && theBuf[aPos + 1] == '/')
+        {
+          aState = ScanState_Code;
+          ++aPos;
+        }
+        continue;
+      }
+      if (aState == ScanState_Text)
+      {
+        if (aChar == '\'')
+        {
+          // the string is closed by apostrophe followed by comma or closing parenthesis
+          size_t aNext = aPos + 1;
+          while (aNext < theSize
+              && (theBuf[aNext] == ' ' || theBuf[aNext] == '"' || theBuf[aNext] == '\n' || theBuf[aNext] == '\r'))
+          {
+            ++aNext;
+          }
+          if (aNext < theSize && (theBuf[aNext] == ',' || theBuf[aNext] == ')'))
+          {
+            aState = ScanState_Code;
+          }
+        }
+        continue;
+      }
+
+      switch (aChar)
+      {
+        case '/':
+        {
+          if (aPos + 1 < theSize && theBuf[aPos + 1] == '*')
+          {
+            aState = ScanState_Comment;
+            ++aPos;
+          }
+          break;
+        }
+        case '\'':
+        {
+          aState = ScanState_Text;
+          break;
+        }
+        case '(':
+        {
+          ++aDepth;
+          break;
+        }
+        case ')':
+        {
+          if (--aDepth < 0)
+          {
+            return Standard_False;
+          }
+          break;
+        }
+        case '&':
+        {
+          // records of the scope should be processed together
+          if (isInData)
+          {
+            return Standard_False;
+          }
+          break;
+        }
+        case ';':
+        {
+          if (aDepth != 0)
+          {
+            return Standard_False;
+          }
+          if (!isInData)
+          {
+            if (isKeyword (theBuf, aPos, "DATA"))
+            {
+              isInData = Standard_True;
+              aDataStart = aPos + 1;
+              aTarget = aDataStart + (theSize - aDataStart) / theNbChunks;
+            }
+          }
+          else if (isKeyword (theBuf, aPos, "ENDSEC"))
+          {
+            return !theBounds.empty();
+          }
+          else if (aPos >= aTarget)
+          {
+            isPending = Standard_True;
+          }
+          break;
+        }
+        case '#':
+        {
+          if (isPending)
+          {
+            theBounds.push_back (aPos);
+            isPending = Standard_False;
+            if ((Standard_Integer )theBounds.size() + 1 >= theNbChunks)
+            {
+              aTarget = theSize;
+            }
+            else
+            {
+              aTarget = aDataStart + (theSize - aDataStart) * (theBounds.size() + 1) / theNbChunks;
+            }
+          }
+          break;
+        }
+      }
+    }
+    // ENDSEC of the DATA section has not been found
+    return Standard_False;
+  }
+
+  //! Runs Flex scanner and Bison parser over the stream filling the data model.
+  //! @return result of the parser (0 on success)
+  static int parseStream (std::istream* theStream,
+                          StepFile_ReadData& theDataModel)
+  {
+    step::scanner aScanner (&theDataModel, theStream);
+    aScanner.yyrestart (theStream);
+    step::parser aParser (&aScanner);
+    return aParser.parse();
+  }
+
+  //! Functor parsing one part of the DATA section in a thread.
+  class StepFile_ParseChunkFunctor
+  {
+  public:
+
+    StepFile_ParseChunkFunctor (const char* theBuf,
+                                const size_t theSize,
+                                const std::vector<size_t>& theBounds,
+                                std::vector< std::shared_ptr<StepFile_ReadData> >& theDataModels,
+                                std::vector<Standard_Integer>& theStatus)
+    : myBuf (theBuf),
+      mySize (theSize),
+      myBounds (theBounds),
+      myDataModels (theDataModels),
+      myStatus (theStatus) {}
+
+    void operator() (const Standard_Integer theIndex) const
+    {
+      const size_t aStart = theIndex == 0 ? 0 : myBounds[theIndex - 1];
+      const size_t anEnd  = theIndex == (Standard_Integer )myBounds.size() ? mySize : myBounds[theIndex];
+      StepFile_BlocksBuffer aBuffer;
+      if (theIndex != 0)
+      {
+        aBuffer.Append (THE_CHUNK_PREFIX, sizeof(THE_CHUNK_PREFIX) - 1);
+      }
+      aBuffer.Append (myBuf + aStart, anEnd - aStart);
+      if (theIndex != (Standard_Integer )myBounds.size())
+      {
+        aBuffer.Append (THE_CHUNK_SUFFIX, sizeof(THE_CHUNK_SUFFIX) - 1);
+      }
+      std::istream aStream (&aBuffer);
+      StepFile_ReadData& aDataModel = *myDataModels[theIndex];
+      try
+      {
+        OCC_CATCH_SIGNALS
+        const int aState = parseStream (&aStream, aDataModel);
+        // any syntax problem leads to serial re-reading of the whole file
+        // to get exactly the same error recovery and messages
+        myStatus[theIndex] = (aState == 0 && aDataModel.GetLastError() == NULL) ? 0 : 1;
+      }
+      catch (Standard_Failure const&)
+      {
+        myStatus[theIndex] = 1;
+      }
+    }
+
+  private:
+    StepFile_ParseChunkFunctor& operator= (const StepFile_ParseChunkFunctor&);
+
+  private:
+    const char* myBuf;
+    const size_t mySize;
+    const std::vector<size_t>& myBounds;
+    std::vector< std::shared_ptr<StepFile_ReadData> >& myDataModels;
+    std::vector<Standard_Integer>& myStatus;
+  };
+
+  //! Read-only memory mapping of the whole file.
+  //! The mapped text is backed by the file itself (system page cache)
+  //! rather than by process heap; this only saves the whole-text buffer
+  //! needed by parallel parsing, as token texts are still copied
+  //! into the character pages of the data models by the scanner.
+  class StepFile_MappedFile
+  {
+  public:
+
+    StepFile_MappedFile()
+    : myData (NULL),
+      mySize (0)
+  #if defined(_WIN32)
+    , myFile (INVALID_HANDLE_VALUE),
+      myMapping (NULL)
+  #endif
+    {}
+
+    ~StepFile_MappedFile() { Close(); }
+
+    //! Maps the file; returns FALSE if file cannot be mapped (caller should fall back to stream reading).
+    Standard_Boolean Open (const char* theName)
+    {
+      Close();
+    #if defined(_WIN32) && !defined(OCCT_UWP)
+      const TCollection_ExtendedString aNameW (theName, Standard_True);
+      myFile = CreateFileW (aNameW.ToWideString(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+      LARGE_INTEGER aSize;
+      if (myFile == INVALID_HANDLE_VALUE
+      || !GetFileSizeEx (myFile, &aSize)
+      ||  aSize.QuadPart <= 0
+      ||  (unsigned long long )aSize.QuadPart > (unsigned long long )(size_t )-1)
+      {
+        Close();
+        return Standard_False;
+      }
+      myMapping = CreateFileMappingW (myFile, NULL, PAGE_READONLY, 0, 0, NULL);
+      void* aData = myMapping != NULL ? MapViewOfFile (myMapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+      if (aData == NULL)
+      {
+        Close();
+        return Standard_False;
+      }
+      myData = (const char* )aData;
+      mySize = (size_t )aSize.QuadPart;
+      return Standard_True;
+    #elif !defined(_WIN32)
+      const int aFile = open (theName, O_RDONLY);
+      if (aFile == -1)
+      {
+        return Standard_False;
+      }
+      struct stat aStat;
+      if (fstat (aFile, &aStat) != 0
+       || !S_ISREG(aStat.st_mode)
+       || aStat.st_size <= 0)
+      {
+        close (aFile);
+        return Standard_False;
+      }
+      void* aData = mmap (NULL, (size_t )aStat.st_size, PROT_READ, MAP_PRIVATE, aFile, 0);
+      // mapping remains valid after closing the descriptor
+      close (aFile);
+      if (aData == MAP_FAILED)
+      {
+        return Standard_False;
+      }
+    #if defined(MADV_SEQUENTIAL)
+      madvise (aData, (size_t )aStat.st_size, MADV_SEQUENTIAL);
+    #endif
+      myData = (const char* )aData;
+      mySize = (size_t )aStat.st_size;
+      return Standard_True;
+    #else
+      (void )theName;
+      return Standard_False;
+    #endif
+    }
+
+    //! Releases the mapping.
+    void Close()
+    {
+    #if defined(_WIN32)
+      if (myData != NULL)
+      {
+        UnmapViewOfFile (myData);
+      }
+      if (myMapping != NULL)
+      {
+        CloseHandle (myMapping);
+        myMapping = NULL;
+      }
+      if (myFile != INVALID_HANDLE_VALUE)
+      {
+        CloseHandle (myFile);
+        myFile = INVALID_HANDLE_VALUE;
+      }
+    #else
+      if (myData != NULL)
+      {
+        munmap ((void* )myData, mySize);
+      }
+    #endif
+      myData = NULL;
+      mySize = 0;
+    }
+
+    //! Returns mapped text.
+    const char* Data() const { return myData; }
+
+    //! Returns size of the mapped text.
+    size_t Size() const { return mySize; }
+
+  private:
+    StepFile_MappedFile (const StepFile_MappedFile& );
+    StepFile_MappedFile& operator= (const StepFile_MappedFile& );
+
+  private:
+    const char* myData;
+    size_t      mySize;
+  #if defined(_WIN32)
+    HANDLE      myFile;
+    HANDLE      myMapping;
+  #endif
+  };
+
+  //! Reads the whole stream into memory buffer.
+  static Standard_Boolean readWholeStream (std::istream& theStream,
+                                           std::vector<char>& theBuffer)
+  {
+    const size_t aBlockSize = 16 * 1024 * 1024;
+    size_t aSize = 0;
+    for (;;)
+    {
+      theBuffer.resize (aSize + aBlockSize);
+      theStream.read (&theBuffer[aSize], aBlockSize);
+      aSize += (size_t )theStream.gcount();
+      if (!theStream.good())
+      {
+        break;
+      }
+    }
+    theBuffer.resize (aSize);
+    return !theStream.bad();
+  }
+
+  //! Parses STEP text in memory, splitting its DATA section between threads when possible.
+  //! Data models are filled in the order of records in the text.
+  //! @return result of the parser (0 on success)
+  static int parseBuffer (const char* theBuf,
+                          const size_t theSize,
+                          std::vector< std::shared_ptr<StepFile_ReadData> >& theDataModels)
+  {
+    const char*  aBuf  = theBuf;
+    const size_t aSize = theSize;
+    const Standard_Integer aNbThreads = OSD_ThreadPool::DefaultPool()->NbDefaultThreadsToLaunch();
+    const Standard_Integer aNbChunks  = Min (aNbThreads, (Standard_Integer )(aSize / minChunkSize()));
+    std::vector<size_t> aBounds;
+    if (aNbChunks > 1
+     && splitDataSection (aBuf, aSize, aNbChunks, aBounds))
+    {
+      const Standard_Integer aNbParts = (Standard_Integer )aBounds.size() + 1;
+      std::vector<Standard_Integer> aStatus (aNbParts, 1);
+      theDataModels.clear();
+      for (Standard_Integer aPartIter = 0; aPartIter < aNbParts; ++aPartIter)
+      {
+        theDataModels.push_back (std::make_shared<StepFile_ReadData>());
+      }
+      StepFile_ParseChunkFunctor aFunctor (aBuf, aSize, aBounds, theDataModels, aStatus);
+      OSD_Parallel::For (0, aNbParts, aFunctor);
+      if (std::find (aStatus.begin(), aStatus.end(), 1) == aStatus.end())
+      {
+        return 0;
+      }
+    }
+
+    // serial processing of the whole text
+    theDataModels.clear();
+    theDataModels.push_back (std::make_shared<StepFile_ReadData>());
+    StepFile_BlocksBuffer aBuffer;
+    aBuffer.Append (aBuf, aSize);
+    std::istream aStream (&aBuffer);
+    return parseStream (&aStream, *theDataModels.front());
+  }
+}
+
 static Standard_Integer StepFile_Read (const char* theName,
                                        std::istream* theIStream,
                                        const Handle(StepData_StepModel)& theStepModel,
@@ -62,16 +555,25 @@ static Standard_Integer StepFile_Read (const char* theName,
                                        const Handle(StepData_FileRecognizer)& theRecogHeader,
                                        const Handle(StepData_FileRecognizer)& theRecogData)
 {
+  // in parallel mode the whole file text is needed in memory and its DATA section
+  // is parsed by several threads, each one filling its own data model;
+  // the file is mapped into memory when possible, otherwise it is read into a buffer
+  const Standard_Boolean isParallel = Interface_Static::IVal ("read.step.parallel") == 1;
+  StepFile_MappedFile aMappedFile;
+  const Standard_Boolean isMapped = isParallel
+                                 && theIStream == nullptr
+                                 && aMappedFile.Open (theName);
+
   // if stream is not provided, open file stream here
   std::istream* aStreamPtr = theIStream;
   std::shared_ptr<std::istream> aFileStream;
-  if (aStreamPtr == nullptr)
+  if (aStreamPtr == nullptr && !isMapped)
   {
     const Handle(OSD_FileSystem)& aFileSystem = OSD_FileSystem::DefaultFileSystem();
     aFileStream = aFileSystem->OpenIStream (theName, std::ios::in | std::ios::binary);
     aStreamPtr = aFileStream.get();
   }
-  if (aStreamPtr == nullptr || aStreamPtr->fail())
+  if (!isMapped && (aStreamPtr == nullptr || aStreamPtr->fail()))
   {
     return -1;
   }
@@ -85,16 +587,30 @@ static Standard_Integer StepFile_Read (const char* theName,
   Message_Messenger::StreamBuffer sout = Message::SendTrace();
   sout << "      ...    Step File Reading : '" << theName << "'";
 
-  StepFile_ReadData aFileDataModel;
+  std::vector< std::shared_ptr<StepFile_ReadData> > aDataModels;
   try {
     OCC_CATCH_SIGNALS
     int aLetat = 0;
-    step::scanner aScanner(&aFileDataModel, aStreamPtr);
-    aScanner.yyrestart(aStreamPtr);
-    step::parser aParser(&aScanner);
-    aLetat = aParser.parse();
+    if (isMapped)
+    {
+      aLetat = parseBuffer (aMappedFile.Data(), aMappedFile.Size(), aDataModels);
+    }
+    else if (isParallel)
+    {
+      std::vector<char> aBuffer;
+      if (!readWholeStream (*aStreamPtr, aBuffer))
+      {
+        return -1;
+      }
+      aLetat = parseBuffer (aBuffer.empty() ? "" : &aBuffer.front(), aBuffer.size(), aDataModels);
+    }
+    else
+    {
+      aDataModels.push_back (std::make_shared<StepFile_ReadData>());
+      aLetat = parseStream (aStreamPtr, *aDataModels.front());
+    }
     if (aLetat != 0) {
-      StepFile_Interrupt(aFileDataModel.GetLastError(), Standard_True);
+      StepFile_Interrupt(aDataModels.back()->GetLastError(), Standard_True);
       return 1;
     }
   }
@@ -103,6 +619,8 @@ static Standard_Integer StepFile_Read (const char* theName,
                         << anException << "    ...";
     return 1;
   }
+  // all token texts are already copied into the character pages of the data models
+  aMappedFile.Close();
 
 #ifdef CHRONOMESURE
   c.Show(sout);
@@ -110,26 +628,41 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   sout << "      ...    STEP File   Read    ...\n";
 
-  Standard_Integer nbhead, nbrec, nbpar;
-  aFileDataModel.GetFileNbR (&nbhead,&nbrec,&nbpar);  // renvoi par lex/yacc
+  Standard_Integer nbhead = 0, nbrec = 0, nbpar = 0;
+  for (size_t aModelIter = 0; aModelIter < aDataModels.size(); ++aModelIter)
+  {
+    Standard_Integer aNbHead, aNbRec, aNbPar;
+    aDataModels[aModelIter]->GetFileNbR (&aNbHead,&aNbRec,&aNbPar);  // renvoi par lex/yacc
+    nbhead += aNbHead;
+    nbrec  += aNbRec;
+    nbpar  += aNbPar;
+  }
   Handle(StepData_StepReaderData) undirec =
     new StepData_StepReaderData(nbhead,nbrec,nbpar, theStepModel->SourceCodePage());  // creation tableau de records
-  for ( Standard_Integer nr = 1; nr <= nbrec; nr ++) {
-    int nbarg; char* ident; char* typrec = 0;
-    aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
-    undirec->SetRecord (nr, ident, typrec, nbarg);
-
-    if (nbarg>0) {
-      Interface_ParamType typa; char* val;
-      while(aFileDataModel.GetArgDescription (&typa, &val) == 1) {
-        undirec->AddStepParam (nr, val, typa);
+  Standard_Integer nr = 0;
+  for (size_t aModelIter = 0; aModelIter < aDataModels.size(); ++aModelIter)
+  {
+    StepFile_ReadData& aFileDataModel = *aDataModels[aModelIter];
+    const Standard_Integer aNbRec = aFileDataModel.GetNbRecord();
+    for (Standard_Integer aRecIter = 1; aRecIter <= aNbRec; aRecIter++) {
+      ++nr;
+      int nbarg; char* ident; char* typrec = 0;
+      aFileDataModel.GetRecordDescription(&ident, &typrec, &nbarg);
+      undirec->SetRecord (nr, ident, typrec, nbarg);
+
+      if (nbarg>0) {
+        Interface_ParamType typa; char* val;
+        while(aFileDataModel.GetArgDescription (&typa, &val) == 1) {
+          undirec->AddStepParam (nr, val, typa);
+        }
       }
+      undirec->InitParams(nr);
+      aFileDataModel.NextRecord();
     }
-    undirec->InitParams(nr);
-    aFileDataModel.NextRecord();
-  }
 
-  aFileDataModel.ErrorHandle(undirec->GlobalCheck());
+    aFileDataModel.ErrorHandle(undirec->GlobalCheck());
+    aFileDataModel.ClearRecorder(1);
+  }
   Standard_Integer anFailsCount = undirec->GlobalCheck()->NbFails();
   if (anFailsCount > 0)
   {
@@ -137,8 +670,6 @@ static Standard_Integer StepFile_Read (const char* theName,
       << anFailsCount << " ****";
   }
 
-  aFileDataModel.ClearRecorder(1);
-
   sout << "      ... Step File loaded  ...\n";
   sout << "   " << undirec->NbRecords() << " records (entities,sub-lists,scopes), " << nbpar << " parameters";
 
@@ -150,6 +681,7 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   StepData_StepReaderTool readtool (undirec, theProtocol);
   readtool.SetErrorHandle (Standard_True);
+  readtool.SetParallel (isParallel);
 
   readtool.PrepareHeader(theRecogHeader);  // Header. reco nul -> pour Protocol
   readtool.Prepare(theRecogData);          // Data.   reco nul -> pour Protocol
@@ -162,7 +694,10 @@ static Standard_Integer StepFile_Read (const char* theName,
 
   readtool.LoadModel(theStepModel);
   if (theStepModel->Protocol().IsNull()) theStepModel->SetProtocol (theProtocol);
-  aFileDataModel.ClearRecorder(2);
+  for (size_t aModelIter = 0; aModelIter < aDataModels.size(); ++aModelIter)
+  {
+    aDataModels[aModelIter]->ClearRecorder(2);
+  }
   anFailsCount = undirec->GlobalCheck()->NbFails() - anFailsCount;
   if (anFailsCount > 0)
   {
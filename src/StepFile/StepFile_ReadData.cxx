@@ -251,7 +251,9 @@ void StepFile_ReadData::CreateNewText(const char* theNewText, int theLenText)
     strcpy(myResText + (int)strlen(anOldResText), theNewText);
     return;
   }
-  strcpy(myResText, theNewText);
+  // length is known from the scanner, no need to search for the terminating zero
+  memcpy(myResText, theNewText, theLenText);
+  myResText[theLenText] = '\0';
 }
 
 //=======================================================================
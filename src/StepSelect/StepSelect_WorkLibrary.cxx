@@ -19,6 +19,7 @@
 #include <Interface_EntityIterator.hxx>
 #include <Interface_Macros.hxx>
 #include <Interface_ReportEntity.hxx>
+#include <Interface_Static.hxx>
 #include <Message.hxx>
 #include <Message_Messenger.hxx>
 #include <OSD_FileSystem.hxx>
@@ -113,13 +114,13 @@ Standard_Boolean  StepSelect_WorkLibrary::WriteFile
 //    sout << std::flush;
   }
 
-//  Envoi
-  SW.SendModel(stepro);
+//  Envoi : the text is written to the stream progressively
+  sout<<" Write ";
+  const Standard_Boolean isParallel = (Interface_Static::IVal("write.step.parallel") == 1);
+  Standard_Boolean isGood = SW.SendModel (stepro, *aStream, isParallel);
   Interface_CheckIterator chl = SW.CheckList();
   for (chl.Start(); chl.More(); chl.Next())
     ctx.CCheck(chl.Number())->GetMessages(chl.Value());
-  sout<<" Write ";
-  Standard_Boolean isGood = SW.Print (*aStream);                 
   sout<<" Done"<<std::endl;
       
   errno = 0;